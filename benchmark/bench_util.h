@@ -0,0 +1,52 @@
+#ifndef TINYSTL_BENCHMARK_BENCH_UTIL_H_
+#define TINYSTL_BENCHMARK_BENCH_UTIL_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace bench {
+
+// 防止编译器把被测代码当作无用代码消除
+template <class T>
+inline void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static volatile const T* sink;
+  sink = &value;
+#endif
+}
+
+// 运行 f 并返回每次操作的平均纳秒数
+template <class F>
+double ns_per_op(std::size_t ops, F&& f) {
+  auto start = std::chrono::steady_clock::now();
+  f();
+  auto stop = std::chrono::steady_clock::now();
+  double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+  return ops == 0 ? 0.0 : ns / static_cast<double>(ops);
+}
+
+// 生成 n 个互不相同的随机 64 位键
+inline std::vector<std::uint64_t> random_keys(std::size_t n,
+                                              std::uint64_t seed = 42) {
+  std::mt19937_64 rng(seed);
+  std::vector<std::uint64_t> keys(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    // 低位放序号保证唯一，高位随机
+    keys[i] = (rng() << 32) ^ static_cast<std::uint64_t>(i);
+  }
+  return keys;
+}
+
+inline void print_header(const char* title) {
+  std::printf("\n=== %s ===\n", title);
+}
+
+}  // namespace bench
+
+#endif  // TINYSTL_BENCHMARK_BENCH_UTIL_H_
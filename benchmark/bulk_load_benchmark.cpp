@@ -0,0 +1,75 @@
+// 比较 unordered_map 的几种装载方式（每个元素耗时）：
+//   emplace loop：不预留空间，逐个 emplace
+//   range ctor  ：范围构造，走批量插入（一次扩容 + 预取桶槽）
+//   insert_bulk ：批量插入并用多个线程计算哈希值
+// 默认 4M 个元素，可通过第一个命令行参数指定
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <mystl/unordered_map.h>
+
+#include "bench_util.h"
+
+namespace {
+
+template <class K>
+void run(const char* title, const std::vector<std::pair<K, std::uint64_t>>& rows) {
+  using map_type = mystl::unordered_map<K, std::uint64_t>;
+  std::printf("%s\n", title);
+
+  double loop_ns = bench::ns_per_op(rows.size(), [&] {
+    map_type map;
+    for (const auto& row : rows) {
+      map.emplace(row.first, row.second);
+    }
+    bench::do_not_optimize(map.size());
+  });
+  std::printf("  emplace loop      %7.1f ns\n", loop_ns);
+
+  double range_ns = bench::ns_per_op(rows.size(), [&] {
+    map_type map(rows.begin(), rows.end());
+    bench::do_not_optimize(map.size());
+  });
+  std::printf("  range ctor        %7.1f ns\n", range_ns);
+
+  unsigned threads = std::thread::hardware_concurrency();
+  if (threads > 1) {
+    double bulk_ns = bench::ns_per_op(rows.size(), [&] {
+      map_type map;
+      map.insert_bulk(rows.begin(), rows.end(), threads);
+      bench::do_not_optimize(map.size());
+    });
+    std::printf("  insert_bulk x%-3u %7.1f ns\n", threads, bulk_ns);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4000000;
+
+  bench::print_header("unordered_map 批量装载");
+  std::vector<std::uint64_t> keys = bench::random_keys(n);
+  std::printf("n=%zu, threads=%u\n", n, std::thread::hardware_concurrency());
+
+  std::vector<std::pair<std::uint64_t, std::uint64_t>> int_rows;
+  int_rows.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    int_rows.emplace_back(keys[i], i);
+  }
+  run("uint64 keys", int_rows);
+  int_rows = {};
+
+  std::vector<std::pair<std::string, std::uint64_t>> str_rows;
+  str_rows.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    str_rows.emplace_back("user:" + std::to_string(keys[i]), i);
+  }
+  run("string keys", str_rows);
+  return 0;
+}
@@ -0,0 +1,117 @@
+// 比较全局互斥锁保护的 unordered_map 与分片加锁的 concurrent_unordered_map
+// 在不同线程数下的吞吐（百万次操作/秒）：
+//   read-heavy ：90% find，10% insert_or_assign
+//   write-heavy：50% insert_or_assign，50% erase
+// 线程数从 1 倍增到硬件线程数。键空间默认 1M，可通过第一个命令行参数指定
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <mystl/concurrent_unordered_map.h>
+#include <mystl/unordered_map.h>
+
+#include "bench_util.h"
+
+namespace {
+
+constexpr std::size_t ops_per_thread = 1000000;
+
+// 全局锁基线：与原先用法一致
+class locked_map {
+ public:
+  bool find(std::uint64_t k) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return map_.find(k) != map_.end();
+  }
+  void assign(std::uint64_t k, std::uint64_t v) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_.insert_or_assign(k, v);
+  }
+  void erase(std::uint64_t k) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_.erase(k);
+  }
+
+ private:
+  mutable std::mutex mutex_;
+  mystl::unordered_map<std::uint64_t, std::uint64_t> map_;
+};
+
+class sharded_map {
+ public:
+  bool find(std::uint64_t k) const { return map_.contains(k); }
+  void assign(std::uint64_t k, std::uint64_t v) { map_.insert_or_assign(k, v); }
+  void erase(std::uint64_t k) { map_.erase(k); }
+
+ private:
+  mystl::concurrent_unordered_map<std::uint64_t, std::uint64_t> map_;
+};
+
+// read_percent% 的操作为 find，其余一半写入一半删除（read-heavy 时全部写入）
+template <class Map>
+double run(unsigned threads, std::size_t key_space, unsigned read_percent,
+           bool erase_half) {
+  Map map;
+  for (std::size_t k = 0; k < key_space; k += 2) {
+    map.assign(k, k);
+  }
+  std::vector<std::thread> pool;
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned t = 0; t < threads; ++t) {
+    pool.emplace_back([&map, t, key_space, read_percent, erase_half] {
+      std::mt19937_64 rng(t + 1);
+      std::size_t hits = 0;
+      for (std::size_t i = 0; i < ops_per_thread; ++i) {
+        std::uint64_t r = rng();
+        std::uint64_t k = r % key_space;
+        unsigned op = static_cast<unsigned>((r >> 40) % 100);
+        if (op < read_percent) {
+          hits += map.find(k);
+        } else if (erase_half && (op & 1)) {
+          map.erase(k);
+        } else {
+          map.assign(k, i);
+        }
+      }
+      bench::do_not_optimize(hits);
+    });
+  }
+  for (std::thread& th : pool) {
+    th.join();
+  }
+  double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                             start)
+                   .count();
+  return static_cast<double>(threads * ops_per_thread) / sec / 1e6;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::size_t key_space =
+      argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+  unsigned max_threads = std::max(1u, std::thread::hardware_concurrency());
+
+  bench::print_header("并发哈希表吞吐（Mops/s）");
+  std::printf("keys=%zu, ops/thread=%zu, hardware threads=%u\n", key_space,
+              ops_per_thread, max_threads);
+  std::printf("%8s %16s %16s %16s %16s\n", "threads", "read mutex",
+              "read sharded", "write mutex", "write sharded");
+  for (unsigned threads = 1;; threads = std::min(threads * 2, max_threads)) {
+    std::printf("%8u %16.2f %16.2f %16.2f %16.2f\n", threads,
+                run<locked_map>(threads, key_space, 90, false),
+                run<sharded_map>(threads, key_space, 90, false),
+                run<locked_map>(threads, key_space, 0, true),
+                run<sharded_map>(threads, key_space, 0, true));
+    if (threads == max_threads) {
+      break;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,70 @@
+// 查找大多不命中时，布隆过滤器前置的 filtered_unordered_map 与
+// unordered_map 的比较：表中 n 个随机键，查找命中比例分别为 0%、1%、50%。
+// 默认 4M 个元素，可通过第一个命令行参数指定。
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include <mystl/filtered_unordered_map.h>
+#include <mystl/unordered_map.h>
+
+#include "bench_util.h"
+
+namespace {
+
+// 查找序列：每 100 个中 hit_percent 个为表中的键，其余为不存在的键
+std::vector<std::uint64_t> make_queries(const std::vector<std::uint64_t>& keys,
+                                        int hit_percent) {
+  std::vector<std::uint64_t> misses = bench::random_keys(keys.size(), 7);
+  std::vector<std::uint64_t> queries(keys.size());
+  for (std::size_t i = 0; i < queries.size(); ++i) {
+    bool hit = static_cast<int>(i % 100) < hit_percent;
+    // 不存在的键用另一个种子生成，与表中的键重合的概率可以忽略
+    queries[i] = hit ? keys[(i * 7919) % keys.size()] : misses[i];
+  }
+  return queries;
+}
+
+template <class Map>
+double lookup_ns(const Map& map, const std::vector<std::uint64_t>& queries) {
+  std::size_t found = 0;
+  double ns = bench::ns_per_op(queries.size(), [&] {
+    for (std::uint64_t q : queries) {
+      found += map.contains(q);
+    }
+  });
+  bench::do_not_optimize(found);
+  return ns;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4000000;
+
+  bench::print_header("不命中为主的查找：布隆过滤器前置 vs unordered_map");
+  std::vector<std::uint64_t> keys = bench::random_keys(n);
+  mystl::unordered_map<std::uint64_t, std::uint64_t> plain;
+  mystl::filtered_unordered_map<std::uint64_t, std::uint64_t> filtered(n, 0.01);
+  plain.reserve(n);
+  for (std::uint64_t k : keys) {
+    plain.emplace(k, k);
+    filtered.emplace(k, k);
+  }
+  std::printf("n=%zu  filter %zu KiB, %u hashes\n", n,
+              filtered.stats().filter_bytes / 1024,
+              filtered.stats().filter_hashes);
+  for (int hit_percent : {0, 1, 50}) {
+    std::vector<std::uint64_t> queries = make_queries(keys, hit_percent);
+    filtered.reset_stats();
+    double plain_ns = lookup_ns(plain, queries);
+    double filtered_ns = lookup_ns(filtered, queries);
+    mystl::filter_stats s = filtered.stats();
+    std::printf("  hit %2d%%  unordered_map %6.1f ns  filtered %6.1f ns  "
+                "filtered-out %5.1f%%  false positives %.3f%%\n",
+                hit_percent, plain_ns, filtered_ns, s.filter_hit_rate * 100,
+                s.observed_false_positive_rate * 100);
+  }
+  return 0;
+}
@@ -0,0 +1,85 @@
+// 比较 unordered_map 逐个 find 与 find_batch（分阶段预取）的查找吞吐
+// 表要明显大于末级缓存才能体现预取的作用，默认 16M 个元素，
+// 可通过第一个命令行参数指定元素个数，例如：find_batch_benchmark 1000000
+// 每次调用的键数太少时没有可重叠的未命中，还会打断跨调用的乱序执行，
+// 因此 batch 小于内部分组（16）时可能比逐个 find 更慢
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include <mystl/unordered_map.h>
+
+#include "bench_util.h"
+
+namespace {
+
+using map_type = mystl::unordered_map<std::uint64_t, std::uint64_t>;
+
+void run_find_loop(const map_type& map,
+                   const std::vector<std::uint64_t>& probes) {
+  std::uint64_t sum = 0;
+  double ns = bench::ns_per_op(probes.size(), [&] {
+    for (std::uint64_t k : probes) {
+      auto it = map.find(k);
+      if (it != map.end()) {
+        sum += it->second;
+      }
+    }
+  });
+  bench::do_not_optimize(sum);
+  std::printf("  find loop         %7.2f ns\n", ns);
+}
+
+void run_find_batch(const map_type& map,
+                    const std::vector<std::uint64_t>& probes,
+                    std::size_t batch) {
+  std::vector<map_type::const_iterator> out(batch);
+  std::uint64_t sum = 0;
+  double ns = bench::ns_per_op(probes.size(), [&] {
+    for (std::size_t i = 0; i < probes.size(); i += batch) {
+      std::size_t n = std::min(batch, probes.size() - i);
+      map.find_batch(probes.data() + i, n, out.data());
+      for (std::size_t j = 0; j < n; ++j) {
+        if (out[j] != map.end()) {
+          sum += out[j]->second;
+        }
+      }
+    }
+  });
+  bench::do_not_optimize(sum);
+  std::printf("  find_batch %-6zu %7.2f ns\n", batch, ns);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 16000000;
+
+  bench::print_header("unordered_map 批量查找（每次查找耗时）");
+  std::vector<std::uint64_t> keys = bench::random_keys(n);
+  map_type map;
+  map.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    map.emplace(keys[i], i);
+  }
+  std::printf("n=%zu, buckets=%zu\n", n, map.bucket_count());
+
+  // 命中与未命中各半，打乱顺序以免访问模式被硬件预取器猜中
+  const std::size_t probe_count = std::min<std::size_t>(n, 4000000);
+  std::vector<std::uint64_t> probes;
+  probes.reserve(probe_count);
+  std::mt19937_64 rng(7);
+  for (std::size_t i = 0; i < probe_count; ++i) {
+    probes.push_back(i % 2 == 0 ? keys[rng() % n] : rng());
+  }
+
+  run_find_loop(map, probes);
+  const std::size_t batches[] = {1, 4, 8, 16, 32, 64, 256, 1024};
+  for (std::size_t batch : batches) {
+    run_find_batch(map, probes, batch);
+  }
+  return 0;
+}
@@ -0,0 +1,91 @@
+// 比较只读配置表的三种实现：unordered_map、flat_hash_map 与 frozen_map
+// （最小完美哈希，一次定位、一次比较）。输出构造耗时、命中与未命中查找耗时，
+// 以及每个元素占用的字节数（frozen_map 为元素数组加 pilot 表）。
+// 默认 1M 个整数键，可通过第一个命令行参数指定；字符串键为其 1/4
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <mystl/flat_hash_map.h>
+#include <mystl/frozen_map.h>
+#include <mystl/unordered_map.h>
+
+#include "bench_util.h"
+
+namespace {
+
+template <class Map, class K>
+void run_lookups(const char* name, const Map& map, double build_ns,
+                 const std::vector<K>& keys, const std::vector<K>& misses) {
+  std::uint64_t sum = 0;
+  double hit_ns = bench::ns_per_op(keys.size(), [&] {
+    for (const K& k : keys) {
+      sum += map.find(k)->second;
+    }
+  });
+  double miss_ns = bench::ns_per_op(misses.size(), [&] {
+    for (const K& k : misses) {
+      sum += map.count(k);
+    }
+  });
+  bench::do_not_optimize(sum);
+  std::printf("  %-14s build %7.2f ns  hit %7.2f ns  miss %7.2f ns\n", name,
+              build_ns, hit_ns, miss_ns);
+}
+
+template <class K>
+void run_all(const std::vector<K>& keys, const std::vector<K>& misses) {
+  mystl::unordered_map<K, std::uint64_t> source;
+  double build_ns = bench::ns_per_op(keys.size(), [&] {
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+      source.emplace(keys[i], i);
+    }
+  });
+  run_lookups("unordered_map", source, build_ns, keys, misses);
+
+  mystl::flat_hash_map<K, std::uint64_t> flat;
+  build_ns = bench::ns_per_op(keys.size(), [&] {
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+      flat.emplace(keys[i], i);
+    }
+  });
+  run_lookups("flat_hash_map", flat, build_ns, keys, misses);
+
+  mystl::frozen_map<K, std::uint64_t> frozen;
+  build_ns = bench::ns_per_op(keys.size(), [&] {
+    frozen = mystl::frozen_map<K, std::uint64_t>(source);
+  });
+  run_lookups("frozen_map", frozen, build_ns, keys, misses);
+  std::printf("  frozen_map: %.2f B/元素（元素 %zu B + pilot %.2f B）\n",
+              sizeof(typename decltype(frozen)::value_type) +
+                  4.0 * frozen.bucket_count() / frozen.size(),
+              sizeof(typename decltype(frozen)::value_type),
+              4.0 * frozen.bucket_count() / frozen.size());
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+  bench::print_header("只读查找：unordered_map / flat_hash_map / frozen_map");
+  std::vector<std::uint64_t> keys = bench::random_keys(2 * n);
+  std::vector<std::uint64_t> misses(keys.begin() + n, keys.end());
+  keys.resize(n);
+  std::printf("uint64_t -> uint64_t, n=%zu\n", n);
+  run_all(keys, misses);
+
+  std::size_t sn = n / 4;
+  std::vector<std::string> skeys, smisses;
+  skeys.reserve(sn);
+  smisses.reserve(sn);
+  for (std::size_t i = 0; i < sn; ++i) {
+    skeys.push_back("service.config." + std::to_string(keys[i]));
+    smisses.push_back("service.config." + std::to_string(misses[i]));
+  }
+  std::printf("string -> uint64_t, n=%zu\n", sn);
+  run_all(skeys, smisses);
+  return 0;
+}
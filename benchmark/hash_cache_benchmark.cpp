@@ -0,0 +1,90 @@
+// 比较 unordered_map 在三种哈希值缓存策略下的节点大小与插入、查找耗时
+//   full       ：节点保存完整哈希值（默认）
+//   fingerprint：节点保存 32 位指纹
+//   none       ：不保存，需要时重新计算
+// 整数键（恒等哈希）看 none 省下的内存是否以可接受的速度代价换来；
+// 字符串键看指纹是否保留了比较键之前的快速拒绝。
+// 默认整数键 2M 个、字符串键 500K 个，可通过第一个命令行参数指定整数键个数
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <mystl/unordered_map.h>
+
+#include "bench_util.h"
+
+namespace {
+
+template <class K, class Cache>
+using cache_map =
+    mystl::unordered_map<K, std::uint64_t, std::hash<K>, std::equal_to<K>,
+                         std::allocator<std::pair<const K, std::uint64_t>>,
+                         mystl::hash_default_bucket_policy, Cache>;
+
+template <class K, class Cache>
+void run(const char* name, const std::vector<K>& keys,
+         const std::vector<K>& misses) {
+  cache_map<K, Cache> map;
+  double insert_ns = bench::ns_per_op(keys.size(), [&] {
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+      map.emplace(keys[i], i);
+    }
+  });
+
+  std::uint64_t sum = 0;
+  double hit_ns = bench::ns_per_op(keys.size(), [&] {
+    for (const K& k : keys) {
+      sum += map.find(k)->second;
+    }
+  });
+  double miss_ns = bench::ns_per_op(misses.size(), [&] {
+    for (const K& k : misses) {
+      sum += map.count(k);
+    }
+  });
+  bench::do_not_optimize(sum);
+
+  mystl::hash_table_stats s = map.stats();
+  std::printf(
+      "  %-12s node %3zu B  insert %7.2f ns  hit %7.2f ns  miss %7.2f ns\n",
+      name, s.node_bytes / s.size, insert_ns, hit_ns, miss_ns);
+}
+
+template <class K>
+void run_all(const std::vector<K>& keys, const std::vector<K>& misses) {
+  run<K, mystl::hash_cache_full>("full", keys, misses);
+  run<K, mystl::hash_cache_fingerprint>("fingerprint", keys, misses);
+  run<K, mystl::hash_cache_none>("none", keys, misses);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000000;
+
+  bench::print_header("unordered_map 哈希值缓存策略对比（每次操作耗时）");
+  std::vector<std::uint64_t> keys = bench::random_keys(2 * n);
+  std::vector<std::uint64_t> misses(keys.begin() + n, keys.end());
+  keys.resize(n);
+  std::printf("uint64_t -> uint64_t, n=%zu\n", n);
+  run_all(keys, misses);
+
+  // 公共前缀较长的字符串：键比较代价高，快速拒绝的价值更明显
+  std::size_t sn = n / 4;
+  std::vector<std::string> skeys, smisses;
+  skeys.reserve(sn);
+  smisses.reserve(sn);
+  for (std::size_t i = 0; i < sn; ++i) {
+    skeys.push_back("/usr/share/tinystl/objects/" + std::to_string(keys[i]));
+    smisses.push_back("/usr/share/tinystl/objects/" +
+                      std::to_string(misses[i]));
+  }
+  std::printf("string -> uint64_t, n=%zu\n", sn);
+  run_all(skeys, smisses);
+  return 0;
+}
@@ -0,0 +1,105 @@
+// 比较 unordered_map 在各桶数策略下的插入与查找吞吐
+//   default    ：与标准库一致，2 的幂用掩码（reset 时判断），否则取模
+//   default-2^k：同上，但 rehash 到 2 的幂，走掩码分支
+//   prime      ：预计算质数表 + 乘法快速取模
+//   power2     ：2 的幂桶数，混合哈希后取掩码
+//   mask       ：2 的幂桶数，直接取掩码，哈希函数为 mystl::hash
+// 小表（64、1000 个元素）完全放得进 L1，主要反映哈希值到桶下标这一步的代价
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <mystl/functional.h>
+#include <mystl/unordered_map.h>
+
+#include "bench_util.h"
+
+namespace {
+
+template <class Policy, class Hash>
+using policy_map =
+    mystl::unordered_map<std::uint64_t, std::uint64_t, Hash,
+                         std::equal_to<std::uint64_t>,
+                         std::allocator<std::pair<const std::uint64_t,
+                                                  std::uint64_t>>,
+                         Policy>;
+
+template <class Policy, class Hash = std::hash<std::uint64_t>>
+void run(const char* name, const std::vector<std::uint64_t>& keys,
+         const std::vector<std::uint64_t>& misses, int rounds,
+         bool power2_buckets = false) {
+  policy_map<Policy, Hash> map;
+  if (power2_buckets) {
+    std::size_t bc = 2;
+    while (bc < keys.size()) {
+      bc <<= 1;
+    }
+    map.rehash(bc);
+  }
+  double insert_ns = bench::ns_per_op(keys.size(), [&] {
+    for (std::uint64_t k : keys) {
+      map[k] = k;
+    }
+  });
+
+  std::uint64_t sum = 0;
+  double hit_ns = bench::ns_per_op(keys.size() * rounds, [&] {
+    for (int r = 0; r < rounds; ++r) {
+      for (std::uint64_t k : keys) {
+        sum += map.find(k)->second;
+      }
+    }
+  });
+  double miss_ns = bench::ns_per_op(misses.size() * rounds, [&] {
+    for (int r = 0; r < rounds; ++r) {
+      for (std::uint64_t k : misses) {
+        sum += map.count(k);
+      }
+    }
+  });
+  bench::do_not_optimize(sum);
+
+  std::printf(
+      "  %-11s buckets=%-10zu insert %7.2f ns  hit %7.2f ns  miss %7.2f ns\n",
+      name, map.bucket_count(), insert_ns, hit_ns, miss_ns);
+}
+
+void run_all(const char* title, const std::vector<std::uint64_t>& keys,
+             const std::vector<std::uint64_t>& misses) {
+  std::printf("%s, n=%zu\n", title, keys.size());
+  // 每组约 2M 次查找
+  int rounds =
+      static_cast<int>(std::max<std::size_t>(3, 2000000 / keys.size()));
+  run<mystl::hash_default_bucket_policy>("default", keys, misses, rounds);
+  run<mystl::hash_default_bucket_policy>("default-2^k", keys, misses, rounds,
+                                         true);
+  run<mystl::hash_prime_bucket_policy>("prime", keys, misses, rounds);
+  run<mystl::hash_power2_bucket_policy>("power2", keys, misses, rounds);
+  run<mystl::hash_mask_bucket_policy, mystl::hash<std::uint64_t>>(
+      "mask", keys, misses, rounds);
+}
+
+}  // namespace
+
+int main() {
+  bench::print_header("unordered_map 桶数策略对比（每次操作耗时）");
+  const std::size_t sizes[] = {64, 1000, 100000, 2000000};
+  for (std::size_t n : sizes) {
+    std::vector<std::uint64_t> sequential(n), strided(n), misses(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      sequential[i] = i;
+      strided[i] = i * 64;  // 等步长键：掩码策略若不混合哈希会严重冲突
+      misses[i] = (n + i) * 64 + 1;  // 不在任何一组键中
+    }
+    std::vector<std::uint64_t> random = bench::random_keys(n);
+
+    run_all("sequential keys", sequential, misses);
+    run_all("strided keys (x64)", strided, misses);
+    run_all("random keys", random, misses);
+  }
+  return 0;
+}
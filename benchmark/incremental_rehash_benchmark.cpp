@@ -0,0 +1,52 @@
+// 比较一次性 rehash 与渐进式 rehash 下单次插入的延迟分布
+// 逐个插入 n 个随机键（不预留空间），记录每次插入耗时，输出平均、
+// p99.9 与最大值。默认 8M 个元素，可通过第一个命令行参数指定。
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include <mystl/unordered_map.h>
+
+#include "bench_util.h"
+
+namespace {
+
+using map_type = mystl::unordered_map<std::uint64_t, std::uint64_t>;
+
+void run(const char* name, const std::vector<std::uint64_t>& keys,
+         bool incremental) {
+  map_type map;
+  map.set_incremental_rehash(incremental);
+  std::vector<double> latency(keys.size());
+  double total_ns = bench::ns_per_op(keys.size(), [&] {
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+      auto start = std::chrono::steady_clock::now();
+      map.emplace(keys[i], i);
+      auto stop = std::chrono::steady_clock::now();
+      latency[i] =
+          std::chrono::duration<double, std::nano>(stop - start).count();
+    }
+  });
+  bench::do_not_optimize(map.size());
+
+  std::sort(latency.begin(), latency.end());
+  double p999 = latency[latency.size() * 999 / 1000];
+  std::printf("  %-12s avg %8.1f ns  p99.9 %8.1f ns  max %10.3f ms\n", name,
+              total_ns, p999, latency.back() / 1e6);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 8000000;
+
+  bench::print_header("unordered_map 插入延迟：一次性 rehash 与渐进式 rehash");
+  std::vector<std::uint64_t> keys = bench::random_keys(n);
+  std::printf("n=%zu\n", n);
+  run("one-shot", keys, false);
+  run("incremental", keys, true);
+  return 0;
+}
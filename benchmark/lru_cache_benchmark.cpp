@@ -0,0 +1,133 @@
+// lru_cache 与手写的 unordered_map + std::list LRU 的比较：
+// 键服从近似 Zipf 分布（热点集中），命中则读取，未命中则写入。
+// 输出每次访问的平均耗时与命中率；再在同一访问序列中穿插一次性
+// 扫描，比较 LRU 与 TinyLFU 准入的命中率。
+// 默认容量 64K、访问 4M 次，可通过第一个命令行参数指定访问次数。
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <list>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <mystl/lru_cache.h>
+
+#include "bench_util.h"
+
+namespace {
+
+// 手写的 LRU：每个元素一个链表节点和一个哈希表节点
+class list_lru {
+ public:
+  explicit list_lru(std::size_t capacity) : capacity_(capacity) {
+    index_.reserve(capacity + 1);
+  }
+
+  std::uint64_t* get(std::uint64_t k) {
+    auto it = index_.find(k);
+    if (it == index_.end()) {
+      return nullptr;
+    }
+    order_.splice(order_.begin(), order_, it->second);
+    return &it->second->second;
+  }
+
+  void put(std::uint64_t k, std::uint64_t v) {
+    auto it = index_.find(k);
+    if (it != index_.end()) {
+      it->second->second = v;
+      order_.splice(order_.begin(), order_, it->second);
+      return;
+    }
+    order_.emplace_front(k, v);
+    index_.emplace(k, order_.begin());
+    if (order_.size() > capacity_) {
+      index_.erase(order_.back().first);
+      order_.pop_back();
+    }
+  }
+
+ private:
+  using order_list = std::list<std::pair<std::uint64_t, std::uint64_t>>;
+
+  std::size_t capacity_;
+  order_list order_;
+  std::unordered_map<std::uint64_t, order_list::iterator> index_;
+};
+
+// 近似 Zipf(1) 分布：对数均匀采样
+std::vector<std::uint64_t> zipf_keys(std::size_t n, std::size_t universe,
+                                     std::uint64_t seed) {
+  std::mt19937_64 rng(seed);
+  std::uniform_real_distribution<double> u(0.0, std::log(double(universe)));
+  std::vector<std::uint64_t> keys(n);
+  for (std::uint64_t& k : keys) {
+    k = static_cast<std::uint64_t>(std::exp(u(rng)));
+  }
+  return keys;
+}
+
+template <class Cache>
+double run(Cache& cache, const std::vector<std::uint64_t>& keys,
+           std::size_t& hits) {
+  hits = 0;
+  double ns = bench::ns_per_op(keys.size(), [&] {
+    for (std::uint64_t k : keys) {
+      if (std::uint64_t* v = cache.get(k)) {
+        hits += *v == k;
+      } else {
+        cache.put(k, k);
+      }
+    }
+  });
+  bench::do_not_optimize(hits);
+  return ns;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4000000;
+  const std::size_t capacity = 1 << 16;
+  const std::size_t universe = 1 << 22;
+
+  bench::print_header("LRU 缓存：lru_cache vs unordered_map + std::list");
+  std::vector<std::uint64_t> keys = zipf_keys(n, universe, 1);
+  std::size_t hits = 0;
+  {
+    list_lru cache(capacity);
+    double ns = run(cache, keys, hits);
+    std::printf("  %-24s %6.1f ns/access  hit %5.1f%%\n", "unordered_map+list",
+                ns, 100.0 * hits / n);
+  }
+  {
+    mystl::lru_cache<std::uint64_t, std::uint64_t> cache(capacity);
+    double ns = run(cache, keys, hits);
+    std::printf("  %-24s %6.1f ns/access  hit %5.1f%%\n", "lru_cache", ns,
+                100.0 * hits / n);
+  }
+
+  bench::print_header("穿插一次性扫描：LRU vs TinyLFU 准入");
+  std::vector<std::uint64_t> mixed;
+  mixed.reserve(n + n / 2);
+  std::uint64_t scan = universe;
+  for (std::size_t i = 0; i < n; ++i) {
+    mixed.push_back(keys[i]);
+    if (i % 2 == 0) {
+      mixed.push_back(scan++);
+    }
+  }
+  for (mystl::cache_admission admission :
+       {mystl::cache_admission::always, mystl::cache_admission::tiny_lfu}) {
+    mystl::lru_cache<std::uint64_t, std::uint64_t> cache(capacity, admission);
+    double ns = run(cache, mixed, hits);
+    std::printf("  %-24s %6.1f ns/access  hit %5.1f%%\n",
+                admission == mystl::cache_admission::always ? "lru"
+                                                            : "lru+tiny_lfu",
+                ns, 100.0 * hits / mixed.size());
+  }
+  return 0;
+}
@@ -0,0 +1,115 @@
+// 比较两种启动方式：从平铺的键值文件重建 unordered_map，与 mmap 打开快照
+// 后直接查找（mapped_hash_map）。分别输出“可以开始服务”的耗时，以及之后
+// 一批随机查找的耗时（快照的查找包含首次访问页面的缺页）。
+// 默认 10M 个元素，可通过第一个命令行参数指定；文件写在当前目录
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <mystl/mapped_hash_map.h>
+#include <mystl/unordered_map.h>
+
+#include "bench_util.h"
+
+namespace {
+
+using map_type = mystl::unordered_map<std::uint64_t, std::uint64_t>;
+using view_type = mystl::mapped_hash_map<std::uint64_t, std::uint64_t>;
+
+struct kv_record {
+  std::uint64_t key;
+  std::uint64_t value;
+};
+
+double elapsed_ms(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+// 基线：读入整个文件后逐个插入
+map_type rebuild(const char* path) {
+  std::FILE* f = std::fopen(path, "rb");
+  std::vector<kv_record> records;
+  kv_record buf[4096];
+  std::size_t got;
+  while ((got = std::fread(buf, sizeof(kv_record), 4096, f)) > 0) {
+    records.insert(records.end(), buf, buf + got);
+  }
+  std::fclose(f);
+  map_type map;
+  map.reserve(records.size());
+  for (const kv_record& r : records) {
+    map.emplace(r.key, r.value);
+  }
+  return map;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+  const char* flat_path = "mapped_hash_map_benchmark.flat";
+  const char* snap_path = "mapped_hash_map_benchmark.snap";
+
+  bench::print_header("启动：重建 unordered_map 与 mmap 快照");
+  std::vector<std::uint64_t> keys = bench::random_keys(n);
+  {
+    map_type map;
+    map.reserve(n);
+    std::FILE* f = std::fopen(flat_path, "wb");
+    for (std::size_t i = 0; i < n; ++i) {
+      kv_record r{keys[i], i};
+      std::fwrite(&r, sizeof(r), 1, f);
+      map.emplace(keys[i], i);
+    }
+    std::fclose(f);
+    auto start = std::chrono::steady_clock::now();
+    mystl::write_hash_snapshot(map, snap_path);
+    std::printf("n=%zu, 写快照 %.1f ms\n", n, elapsed_ms(start));
+  }
+
+  // 查找一批随机的已有键
+  const std::size_t probe_count = std::min<std::size_t>(n, 1000000);
+  std::vector<std::uint64_t> probes(probe_count);
+  std::mt19937_64 rng(7);
+  for (std::uint64_t& p : probes) {
+    p = keys[rng() % n];
+  }
+
+  {
+    auto start = std::chrono::steady_clock::now();
+    map_type map = rebuild(flat_path);
+    double ready = elapsed_ms(start);
+    std::uint64_t sum = 0;
+    double ns = bench::ns_per_op(probes.size(), [&] {
+      for (std::uint64_t k : probes) {
+        sum += map.find(k)->second;
+      }
+    });
+    bench::do_not_optimize(sum);
+    std::printf("  rebuild  ready %10.3f ms  find %7.2f ns\n", ready, ns);
+  }
+  {
+    auto start = std::chrono::steady_clock::now();
+    view_type view(snap_path);
+    double ready = elapsed_ms(start);
+    std::uint64_t sum = 0;
+    double ns = bench::ns_per_op(probes.size(), [&] {
+      for (std::uint64_t k : probes) {
+        sum += *view.find(k);
+      }
+    });
+    bench::do_not_optimize(sum);
+    std::printf("  mmap     ready %10.3f ms  find %7.2f ns\n", ready, ns);
+  }
+
+  std::remove(flat_path);
+  std::remove(snap_path);
+  return 0;
+}
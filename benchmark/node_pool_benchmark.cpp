@@ -0,0 +1,67 @@
+// 比较 unordered_map 使用 std::allocator 与 node_pool_allocator 时的
+// 插入/删除吞吐：
+//   fill ：从空表插入 n 个键
+//   churn：表保持 n 个元素，反复删除一个旧键、插入一个新键
+//   clear：析构前清空整张表
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <mystl/__memory/node_pool_allocator.h>
+#include <mystl/unordered_map.h>
+
+#include "bench_util.h"
+
+namespace {
+
+using value_type = std::pair<const std::uint64_t, std::uint64_t>;
+
+template <class Alloc>
+using alloc_map =
+    mystl::unordered_map<std::uint64_t, std::uint64_t, std::hash<std::uint64_t>,
+                         std::equal_to<std::uint64_t>, Alloc>;
+
+template <class Alloc>
+void run(const char* name, const std::vector<std::uint64_t>& keys) {
+  const std::size_t n = keys.size() / 2;
+  alloc_map<Alloc> map;
+  map.reserve(n);
+
+  double fill_ns = bench::ns_per_op(n, [&] {
+    for (std::size_t i = 0; i < n; ++i) {
+      map.emplace(keys[i], i);
+    }
+  });
+
+  // 滑动窗口：删除最旧的键，插入一个新键，元素个数保持不变
+  const std::size_t churn_ops = keys.size() - n;
+  double churn_ns = bench::ns_per_op(churn_ops, [&] {
+    for (std::size_t i = 0; i < churn_ops; ++i) {
+      map.erase(keys[i]);
+      map.emplace(keys[n + i], i);
+    }
+  });
+  bench::do_not_optimize(map.size());
+
+  double clear_ns = bench::ns_per_op(n, [&] { map.clear(); });
+
+  std::printf("  %-8s fill %7.2f ns  churn %7.2f ns  clear %7.2f ns\n", name,
+              fill_ns, churn_ns, clear_ns);
+}
+
+}  // namespace
+
+int main() {
+  bench::print_header("unordered_map 节点分配器对比（每次操作耗时）");
+  const std::size_t sizes[] = {10000, 100000, 1000000};
+  for (std::size_t n : sizes) {
+    std::vector<std::uint64_t> keys = bench::random_keys(2 * n);
+    std::printf("n=%zu\n", n);
+    run<std::allocator<value_type>>("std", keys);
+    run<mystl::node_pool_allocator<value_type>>("pool", keys);
+  }
+  return 0;
+}
@@ -0,0 +1,62 @@
+// 并行 rehash / clear 的扩展性：同一张表分别用 1、2、4、8 个线程
+// 把桶数扩大 4 倍，再清空。输出每个元素的平均耗时与相对单线程的加速比。
+// 默认 4M 个元素，可通过第一个命令行参数指定；硬件线程数少于
+// 请求的线程数时加速比不会继续增长。
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include <mystl/unordered_map.h>
+
+#include "bench_util.h"
+
+namespace {
+
+using map_type = mystl::unordered_map<std::uint64_t, std::uint64_t>;
+
+struct result {
+  double rehash_ns;
+  double clear_ns;
+};
+
+result run(const std::vector<std::uint64_t>& keys, unsigned threads) {
+  map_type map;
+  map.reserve(keys.size());
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    map.emplace(keys[i], i);
+  }
+  mystl::parallel_policy policy(threads);
+  std::size_t target = map.bucket_count() * 4;
+  result r;
+  r.rehash_ns =
+      bench::ns_per_op(keys.size(), [&] { map.rehash(target, policy); });
+  bench::do_not_optimize(map.bucket_count());
+  r.clear_ns = bench::ns_per_op(keys.size(), [&] { map.clear(policy); });
+  bench::do_not_optimize(map.size());
+  return r;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4000000;
+
+  bench::print_header("unordered_map 并行 rehash / clear 扩展性");
+  std::vector<std::uint64_t> keys = bench::random_keys(n);
+  std::printf("n=%zu  hardware_concurrency=%u\n", n,
+              std::thread::hardware_concurrency());
+  result base{};
+  for (unsigned threads : {1u, 2u, 4u, 8u}) {
+    result r = run(keys, threads);
+    if (threads == 1) {
+      base = r;
+    }
+    std::printf("  threads=%u  rehash %6.1f ns/elem (x%.2f)  "
+                "clear %6.1f ns/elem (x%.2f)\n",
+                threads, r.rehash_ns, base.rehash_ns / r.rehash_ns, r.clear_ns,
+                base.clear_ns / r.clear_ns);
+  }
+  return 0;
+}
@@ -0,0 +1,157 @@
+// 读多写少：读者线程数从 1 倍增到硬件线程数，比较读吞吐（百万次查找/秒）
+//   shared_mutex：std::shared_mutex 保护的 unordered_map，每次查找取共享锁
+//   sharded     ：concurrent_unordered_map（分片读写锁）
+//   rcu         ：rcu_unordered_map，每次查找一个读区间
+// 测试期间另有一个写者每 100ms 更新一次。表默认 100K 个元素，
+// 可通过第一个命令行参数指定
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+#include <mystl/concurrent_unordered_map.h>
+#include <mystl/rcu_unordered_map.h>
+#include <mystl/unordered_map.h>
+
+#include "bench_util.h"
+
+namespace {
+
+using key_type = std::uint64_t;
+constexpr std::size_t lookups_per_reader = 2000000;
+
+class shared_mutex_map {
+ public:
+  struct reader {
+    shared_mutex_map* self;
+    bool find(key_type k) {
+      std::shared_lock<std::shared_mutex> lock(self->mutex_);
+      return self->map_.find(k) != self->map_.end();
+    }
+  };
+  reader register_reader() { return reader{this}; }
+  void fill(const std::vector<key_type>& keys) {
+    for (key_type k : keys) {
+      assign(k, k);
+    }
+  }
+  void assign(key_type k, key_type v) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    map_.insert_or_assign(k, v);
+  }
+
+ private:
+  std::shared_mutex mutex_;
+  mystl::unordered_map<key_type, key_type> map_;
+};
+
+class sharded_map {
+ public:
+  struct reader {
+    sharded_map* self;
+    bool find(key_type k) { return self->map_.contains(k); }
+  };
+  reader register_reader() { return reader{this}; }
+  void fill(const std::vector<key_type>& keys) {
+    for (key_type k : keys) {
+      assign(k, k);
+    }
+  }
+  void assign(key_type k, key_type v) { map_.insert_or_assign(k, v); }
+
+ private:
+  mystl::concurrent_unordered_map<key_type, key_type> map_;
+};
+
+class rcu_map {
+ public:
+  using map_type = mystl::rcu_unordered_map<key_type, key_type>;
+  struct reader {
+    map_type::reader r;
+    bool find(key_type k) {
+      auto s = r.read();
+      return s.find(k) != nullptr;
+    }
+  };
+  reader register_reader() { return reader{map_.register_reader()}; }
+  // 每次写入都会拷贝整张表，预填充合并为一次 update
+  void fill(const std::vector<key_type>& keys) {
+    map_.update([&](map_type::map_type& m) {
+      for (key_type k : keys) {
+        m.insert_or_assign(k, k);
+      }
+    });
+  }
+  void assign(key_type k, key_type v) { map_.insert_or_assign(k, v); }
+
+ private:
+  map_type map_;
+};
+
+template <class Map>
+double run(unsigned readers, const std::vector<key_type>& keys) {
+  Map map;
+  map.fill(keys);
+  std::atomic<bool> stop{false};
+  std::thread writer([&] {
+    std::size_t i = 0;
+    while (!stop.load(std::memory_order_relaxed)) {
+      map.assign(keys[i % keys.size()], i);
+      ++i;
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+  });
+
+  std::vector<std::thread> pool;
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned t = 0; t < readers; ++t) {
+    pool.emplace_back([&map, &keys, t] {
+      auto reader = map.register_reader();
+      std::mt19937_64 rng(t + 1);
+      std::size_t hits = 0;
+      for (std::size_t i = 0; i < lookups_per_reader; ++i) {
+        hits += reader.find(keys[rng() % keys.size()]);
+      }
+      bench::do_not_optimize(hits);
+    });
+  }
+  for (std::thread& th : pool) {
+    th.join();
+  }
+  double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                             start)
+                   .count();
+  stop = true;
+  writer.join();
+  return static_cast<double>(readers * lookups_per_reader) / sec / 1e6;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000;
+  unsigned max_threads = std::max(1u, std::thread::hardware_concurrency());
+
+  bench::print_header("读多写少哈希表的读吞吐（Mops/s）");
+  std::vector<key_type> keys = bench::random_keys(n);
+  std::printf("n=%zu, lookups/reader=%zu, hardware threads=%u\n", n,
+              lookups_per_reader, max_threads);
+  std::printf("%8s %14s %14s %14s\n", "readers", "shared_mutex", "sharded",
+              "rcu");
+  for (unsigned readers = 1;; readers = std::min(readers * 2, max_threads)) {
+    std::printf("%8u %14.2f %14.2f %14.2f\n", readers,
+                run<shared_mutex_map>(readers, keys),
+                run<sharded_map>(readers, keys), run<rcu_map>(readers, keys));
+    if (readers == max_threads) {
+      break;
+    }
+  }
+  return 0;
+}
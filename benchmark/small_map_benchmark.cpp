@@ -0,0 +1,74 @@
+// 模拟每个请求创建一个小映射：构造、插入 k 个元素、查找若干次、析构。
+// 比较 unordered_map、flat_hash_map 与 small_unordered_map<K, V, 8>
+// 在 k = 2、4、8（内联）和 16（已迁移）时每个请求的耗时。
+// 默认 200K 个请求，可通过第一个命令行参数指定
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <mystl/flat_hash_map.h>
+#include <mystl/small_unordered_map.h>
+#include <mystl/unordered_map.h>
+
+#include "bench_util.h"
+
+namespace {
+
+constexpr int kLookupsPerRequest = 16;
+
+template <class Map, class K>
+double run(std::size_t requests, const std::vector<K>& keys) {
+  std::uint64_t sum = 0;
+  const std::size_t k = keys.size();
+  double ns = bench::ns_per_op(requests, [&] {
+    for (std::size_t r = 0; r < requests; ++r) {
+      Map map;
+      for (std::size_t i = 0; i < k; ++i) {
+        map.emplace(keys[i], r + i);
+      }
+      for (int j = 0; j < kLookupsPerRequest; ++j) {
+        auto it = map.find(keys[(r + j) % k]);
+        sum += it->second;
+      }
+    }
+  });
+  bench::do_not_optimize(sum);
+  return ns;
+}
+
+template <class K>
+void run_all(const char* name, std::size_t requests,
+             const std::vector<K>& all_keys) {
+  std::printf("%s\n", name);
+  for (std::size_t k : {2, 4, 8, 16}) {
+    std::vector<K> keys(all_keys.begin(), all_keys.begin() + k);
+    double u = run<mystl::unordered_map<K, std::uint64_t>>(requests, keys);
+    double f = run<mystl::flat_hash_map<K, std::uint64_t>>(requests, keys);
+    double s =
+        run<mystl::small_unordered_map<K, std::uint64_t, 8>>(requests, keys);
+    std::printf(
+        "  k=%-3zu unordered_map %8.1f ns  flat_hash_map %8.1f ns  "
+        "small_unordered_map %8.1f ns\n",
+        k, u, f, s);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::size_t requests =
+      argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200000;
+
+  bench::print_header("每个请求：构造 + 插入 k 个 + 查找 16 次 + 析构");
+  std::vector<std::uint64_t> keys = bench::random_keys(16);
+  run_all("uint64_t -> uint64_t", requests, keys);
+
+  std::vector<std::string> skeys;
+  for (std::uint64_t k : keys) {
+    skeys.push_back("x-header-" + std::to_string(k % 1000));
+  }
+  run_all("string -> uint64_t", requests, skeys);
+  return 0;
+}
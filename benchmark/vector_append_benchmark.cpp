@@ -0,0 +1,152 @@
+// 比较 mystl::vector 与 std::vector 的追加吞吐量：
+//   push_back(const T&)、push_back(T&&)、emplace_back，以及 reserve 之后的追加；
+//   另测一次中间位置的范围 insert。
+// 元素类型：int、长字符串（mystl::string 可平凡重定位，std::string 走移动）、
+// 256 字节的大结构体。默认每轮追加 1M 个元素，可通过第一个命令行参数指定
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <mystl/string.h>
+#include <mystl/vector.h>
+
+#include "bench_util.h"
+
+namespace {
+
+struct Large {
+  std::uint64_t words[32];
+};
+
+Large make_large(std::size_t i) {
+  Large l{};
+  l.words[0] = i;
+  l.words[31] = i * 3;
+  return l;
+}
+
+// 所有生成函数都返回新对象，push_back 走右值重载
+template <class T>
+struct maker;
+
+template <>
+struct maker<int> {
+  static int make(std::size_t i) { return static_cast<int>(i); }
+};
+
+template <>
+struct maker<Large> {
+  static Large make(std::size_t i) { return make_large(i); }
+};
+
+// 40 个字符，超过两种字符串的短字符串容量，每个元素都有一次堆分配
+template <>
+struct maker<std::string> {
+  static std::string make(std::size_t i) {
+    return std::string(40, static_cast<char>('a' + i % 26));
+  }
+};
+
+template <>
+struct maker<mystl::string> {
+  static mystl::string make(std::size_t i) {
+    return mystl::string(40, static_cast<char>('a' + i % 26));
+  }
+};
+
+enum class mode { copy, move, emplace, reserved };
+
+template <class Vec>
+double append(std::size_t n, mode m, const typename Vec::value_type& sample) {
+  using T = typename Vec::value_type;
+  std::size_t sink = 0;
+  double ns = bench::ns_per_op(n, [&] {
+    Vec v;
+    if (m == mode::reserved) {
+      v.reserve(n);
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      switch (m) {
+        case mode::copy:
+          v.push_back(sample);
+          break;
+        case mode::emplace:
+          v.emplace_back(maker<T>::make(i));
+          break;
+        default:
+          v.push_back(maker<T>::make(i));
+          break;
+      }
+    }
+    sink += v.size();
+    bench::do_not_optimize(v.data());
+  });
+  bench::do_not_optimize(sink);
+  return ns;
+}
+
+// 在中间位置一次插入 n 个元素
+template <class Vec>
+double range_insert(std::size_t n, const Vec& src) {
+  std::size_t sink = 0;
+  const int rounds = 10;
+  double ns = bench::ns_per_op(n * rounds, [&] {
+    for (int r = 0; r < rounds; ++r) {
+      Vec v(src.begin(), src.begin() + 16);
+      v.insert(v.begin() + 8, src.begin(), src.end());
+      sink += v.size();
+    }
+  });
+  bench::do_not_optimize(sink);
+  return ns;
+}
+
+template <class MyVec, class StdVec>
+void run(const char* name, std::size_t n) {
+  using MyT = typename MyVec::value_type;
+  using StdT = typename StdVec::value_type;
+  MyT my_sample = maker<MyT>::make(7);
+  StdT std_sample = maker<StdT>::make(7);
+
+  std::printf("%s\n", name);
+  const struct {
+    const char* label;
+    mode m;
+  } modes[] = {{"push_back(const T&)", mode::copy},
+               {"push_back(T&&)", mode::move},
+               {"emplace_back", mode::emplace},
+               {"reserve + push_back", mode::reserved}};
+  for (const auto& c : modes) {
+    double my = append<MyVec>(n, c.m, my_sample);
+    double st = append<StdVec>(n, c.m, std_sample);
+    std::printf("  %-22s mystl %7.2f ns  std %7.2f ns\n", c.label, my, st);
+  }
+
+  MyVec my_src;
+  StdVec std_src;
+  for (std::size_t i = 0; i < n / 10; ++i) {
+    my_src.push_back(maker<MyT>::make(i));
+    std_src.push_back(maker<StdT>::make(i));
+  }
+  double my = range_insert(n / 10, my_src);
+  double st = range_insert(n / 10, std_src);
+  std::printf("  %-22s mystl %7.2f ns  std %7.2f ns\n", "range insert (middle)",
+              my, st);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+  bench::print_header("vector 追加吞吐量（每个元素的纳秒数）");
+  run<mystl::vector<int>, std::vector<int>>("int", n);
+  run<mystl::vector<mystl::string>, std::vector<mystl::string>>(
+      "mystl::string（40 字节）", n);
+  run<mystl::vector<std::string>, std::vector<std::string>>(
+      "std::string（40 字节）", n);
+  run<mystl::vector<Large>, std::vector<Large>>("256 字节结构体", n / 4);
+  return 0;
+}
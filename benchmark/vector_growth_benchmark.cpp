@@ -0,0 +1,71 @@
+// 大 vector<uint64_t> 逐个 push_back 增长到 N MiB 的耗时与峰值内存：
+//   mystl::vector 对平凡拷贝的类型使用 allocator::reallocate（realloc，
+//   glibc 对大块使用 mremap），std::vector 每次扩容分配新块、复制、释放旧块。
+// 峰值内存（ru_maxrss）是整个进程的历史最大值，因此每次只测一种容器：
+//   vector_growth_benchmark mystl [MiB]
+//   vector_growth_benchmark std [MiB]
+// 默认 600 MiB：最终容量取整到 1 GiB，最后一次扩容时新旧两块都已部分驻留
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include <mystl/vector.h>
+
+#include "bench_util.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#define TINYSTL_BENCH_HAS_RUSAGE 1
+#endif
+
+namespace {
+
+// 峰值常驻内存（MiB），不支持的平台返回 0
+double peak_rss_mib() {
+#ifdef TINYSTL_BENCH_HAS_RUSAGE
+  rusage ru{};
+  getrusage(RUSAGE_SELF, &ru);
+#if defined(__APPLE__)
+  return static_cast<double>(ru.ru_maxrss) / (1024.0 * 1024.0);
+#else
+  return static_cast<double>(ru.ru_maxrss) / 1024.0;
+#endif
+#else
+  return 0.0;
+#endif
+}
+
+template <class Vec>
+void grow(const char* name, std::size_t n) {
+  std::uint64_t sum = 0;
+  double ns = bench::ns_per_op(n, [&] {
+    Vec v;
+    for (std::size_t i = 0; i < n; ++i) {
+      v.push_back(i);
+    }
+    sum += v[n / 2] + v.size();
+  });
+  bench::do_not_optimize(sum);
+  std::printf(
+      "  %-14s %6.2f ns/push_back  total %8.1f ms  peak RSS %8.1f MiB\n",
+      name, ns, ns * static_cast<double>(n) / 1e6, peak_rss_mib());
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const char* which = argc > 1 ? argv[1] : "mystl";
+  std::size_t mib = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 600;
+  std::size_t n = mib * 1024 * 1024 / sizeof(std::uint64_t);
+
+  bench::print_header("vector<uint64_t> 逐个 push_back 增长");
+  std::printf("  final size %zu MiB (%zu elements)\n", mib, n);
+  if (std::strcmp(which, "std") == 0) {
+    grow<std::vector<std::uint64_t>>("std::vector", n);
+  } else {
+    grow<mystl::vector<std::uint64_t>>("mystl::vector", n);
+  }
+  return 0;
+}
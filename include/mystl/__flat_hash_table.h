@@ -0,0 +1,895 @@
+#ifndef TINYSTL_FLAT_HASH_TABLE_H_
+#define TINYSTL_FLAT_HASH_TABLE_H_
+
+#include <algorithm>  // for max
+#include <cstddef>    // for size_t, ptrdiff_t
+#include <cstdint>    // for uint32_t, uint64_t
+#include <cstring>    // for memcpy
+#include <iterator>   // for forward_iterator_tag
+#include <limits>     // for numeric_limits
+#include <memory>     // for allocator_traits, addressof, pointer_traits
+#include <utility>    // for pair, move, forward, swap
+
+#include "__hash_table.h"  // for next_hash_pow2, hash_mix
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TINYSTL_FLAT_HASH_HAVE_SSE2 1
+#include <emmintrin.h>
+#else
+#define TINYSTL_FLAT_HASH_HAVE_SSE2 0
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace mystl {
+
+// ============================================================================
+// 控制字节（Swiss table 元数据）
+// ============================================================================
+// 每个槽位对应一个控制字节：
+//   0b0xxxxxxx：槽位已占用，低 7 位为哈希片段 H2
+//   empty     ：从未使用过的槽位（探测遇到它即可停止）
+//   deleted   ：墓碑，查找时需继续探测，插入时可复用
+//   sentinel  ：位于 ctrl[capacity]，供迭代器识别结尾
+using flat_ctrl_t = signed char;
+
+inline constexpr flat_ctrl_t flat_ctrl_empty = -128;
+inline constexpr flat_ctrl_t flat_ctrl_deleted = -2;
+inline constexpr flat_ctrl_t flat_ctrl_sentinel = -1;
+
+inline bool flat_is_full(flat_ctrl_t c) noexcept {
+  return c >= 0;
+}
+inline bool flat_is_empty(flat_ctrl_t c) noexcept {
+  return c == flat_ctrl_empty;
+}
+inline bool flat_is_deleted(flat_ctrl_t c) noexcept {
+  return c == flat_ctrl_deleted;
+}
+inline bool flat_is_empty_or_deleted(flat_ctrl_t c) noexcept {
+  return c < flat_ctrl_sentinel;
+}
+
+// 空表共享的控制字节：ctrl[0] 即为 sentinel，保证空表的 find/begin 无需判空
+inline const flat_ctrl_t* flat_empty_group() noexcept {
+  alignas(16) static const flat_ctrl_t empty_group[16] = {
+      flat_ctrl_sentinel, flat_ctrl_empty, flat_ctrl_empty, flat_ctrl_empty,
+      flat_ctrl_empty,    flat_ctrl_empty, flat_ctrl_empty, flat_ctrl_empty,
+      flat_ctrl_empty,    flat_ctrl_empty, flat_ctrl_empty, flat_ctrl_empty,
+      flat_ctrl_empty,    flat_ctrl_empty, flat_ctrl_empty, flat_ctrl_empty};
+  return empty_group;
+}
+
+// ============================================================================
+// 辅助函数：位扫描
+// ============================================================================
+inline int flat_countr_zero(uint32_t x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_ctz(x);
+#elif defined(_MSC_VER)
+  unsigned long r;
+  _BitScanForward(&r, x);
+  return static_cast<int>(r);
+#else
+  int n = 0;
+  for (; (x & 1u) == 0; x >>= 1) {
+    ++n;
+  }
+  return n;
+#endif
+}
+
+inline int flat_countl_zero(uint32_t x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_clz(x);
+#elif defined(_MSC_VER)
+  unsigned long r;
+  _BitScanReverse(&r, x);
+  return 31 - static_cast<int>(r);
+#else
+  int n = 0;
+  for (uint32_t bit = 0x80000000u; (x & bit) == 0; bit >>= 1) {
+    ++n;
+  }
+  return n;
+#endif
+}
+
+// ============================================================================
+// 哈希切分
+// ============================================================================
+// 用户哈希先经 hash_mix 混合（恒等哈希下连续整数否则会挤进同一组），
+// 再切分为 H1：决定探测起点；H2：存入控制字节的 7 位指纹
+inline size_t flat_h1(size_t hash) noexcept {
+  return hash >> 7;
+}
+inline flat_ctrl_t flat_h2(size_t hash) noexcept {
+  return static_cast<flat_ctrl_t>(hash & 0x7f);
+}
+
+// ============================================================================
+// 组内匹配结果（16 位掩码，每一位对应组内一个槽位）
+// ============================================================================
+class flat_bitmask {
+  uint32_t mask_;
+
+ public:
+  explicit flat_bitmask(uint32_t mask) noexcept : mask_(mask) {}
+
+  explicit operator bool() const noexcept { return mask_ != 0; }
+
+  uint32_t mask() const noexcept { return mask_; }
+
+  int lowest_bit_set() const noexcept { return flat_countr_zero(mask_); }
+
+  void clear_lowest() noexcept { mask_ &= mask_ - 1; }
+
+  int trailing_zeros() const noexcept {
+    return mask_ == 0 ? 16 : flat_countr_zero(mask_);
+  }
+
+  int leading_zeros() const noexcept {
+    return mask_ == 0 ? 16 : flat_countl_zero(mask_) - 16;
+  }
+};
+
+// ============================================================================
+// 控制字节组：一次处理 16 个控制字节
+// ============================================================================
+// 标量实现：任何平台都可用，也用于测试中与 SSE2 实现对拍
+struct flat_group_portable {
+  static constexpr size_t width = 16;
+
+  flat_ctrl_t ctrl_[width];
+
+  explicit flat_group_portable(const flat_ctrl_t* pos) noexcept {
+    std::memcpy(ctrl_, pos, width);
+  }
+
+  flat_bitmask match(flat_ctrl_t h2) const noexcept {
+    uint32_t m = 0;
+    for (size_t i = 0; i < width; ++i) {
+      m |= static_cast<uint32_t>(ctrl_[i] == h2) << i;
+    }
+    return flat_bitmask(m);
+  }
+
+  flat_bitmask match_empty() const noexcept { return match(flat_ctrl_empty); }
+
+  flat_bitmask match_empty_or_deleted() const noexcept {
+    uint32_t m = 0;
+    for (size_t i = 0; i < width; ++i) {
+      m |= static_cast<uint32_t>(flat_is_empty_or_deleted(ctrl_[i])) << i;
+    }
+    return flat_bitmask(m);
+  }
+
+  size_t count_leading_empty_or_deleted() const noexcept {
+    // 掩码的高 16 位恒为 0，取反后至少在第 16 位为 1
+    return static_cast<size_t>(
+        flat_countr_zero(~match_empty_or_deleted().mask()));
+  }
+};
+
+#if TINYSTL_FLAT_HASH_HAVE_SSE2
+// SSE2 实现：一次比较 + movemask 得到整组的匹配掩码
+struct flat_group_sse2 {
+  static constexpr size_t width = 16;
+
+  __m128i ctrl_;
+
+  explicit flat_group_sse2(const flat_ctrl_t* pos) noexcept
+      : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pos))) {}
+
+  flat_bitmask match(flat_ctrl_t h2) const noexcept {
+    __m128i m = _mm_set1_epi8(static_cast<char>(h2));
+    return flat_bitmask(
+        static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(m, ctrl_))));
+  }
+
+  flat_bitmask match_empty() const noexcept { return match(flat_ctrl_empty); }
+
+  flat_bitmask match_empty_or_deleted() const noexcept {
+    // 有符号比较：empty(-128) 与 deleted(-2) 都小于 sentinel(-1)
+    __m128i s = _mm_set1_epi8(static_cast<char>(flat_ctrl_sentinel));
+    return flat_bitmask(
+        static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(s, ctrl_))));
+  }
+
+  size_t count_leading_empty_or_deleted() const noexcept {
+    return static_cast<size_t>(
+        flat_countr_zero(~match_empty_or_deleted().mask()));
+  }
+};
+
+using flat_group = flat_group_sse2;
+#else
+using flat_group = flat_group_portable;
+#endif
+
+// ============================================================================
+// 探测序列：以组为单位的三角探测，容量为 2^k - 1 时能遍历所有组
+// ============================================================================
+class flat_probe_seq {
+  size_t mask_;
+  size_t offset_;
+  size_t index_;
+
+ public:
+  flat_probe_seq(size_t hash, size_t mask) noexcept
+      : mask_(mask), offset_(hash & mask), index_(0) {}
+
+  size_t offset() const noexcept { return offset_; }
+  size_t offset(size_t i) const noexcept { return (offset_ + i) & mask_; }
+
+  void next() noexcept {
+    index_ += flat_group::width;
+    offset_ += index_;
+    offset_ &= mask_;
+  }
+};
+
+// ============================================================================
+// 容量辅助函数
+// ============================================================================
+// 容量总是 0 或 2^k - 1（至少为 3），这样 capacity 本身就是探测掩码
+inline size_t flat_normalize_capacity(size_t n) noexcept {
+  return n <= 3 ? 3 : next_hash_pow2(n + 1) - 1;
+}
+
+// 最大负载因子 7/8，并且至少保留一个 empty 槽位，保证探测一定能终止
+inline size_t flat_capacity_to_growth(size_t capacity) noexcept {
+  if (capacity == 0) {
+    return 0;
+  }
+  return capacity - std::max<size_t>(capacity / 8, 1);
+}
+
+inline size_t flat_growth_to_capacity(size_t growth) noexcept {
+  size_t capacity = flat_normalize_capacity(growth);
+  while (flat_capacity_to_growth(capacity) < growth) {
+    capacity = capacity * 2 + 1;
+  }
+  return capacity;
+}
+
+// ============================================================================
+// 前向声明
+// ============================================================================
+template <class _Tp, class _Hash, class _Equal, class _Alloc>
+class flat_hash_table;
+
+// ============================================================================
+// 迭代器：沿控制字节前进，整组跳过空槽位，遇到 sentinel 停止
+// ============================================================================
+template <class _Tp>
+class flat_hash_iterator {
+  const flat_ctrl_t* ctrl_;
+  _Tp* slot_;
+
+  void skip_empty_or_deleted() noexcept {
+    while (flat_is_empty_or_deleted(*ctrl_)) {
+      size_t shift = flat_group(ctrl_).count_leading_empty_or_deleted();
+      ctrl_ += shift;
+      slot_ += shift;
+    }
+  }
+
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = _Tp;
+  using difference_type = ptrdiff_t;
+  using reference = value_type&;
+  using pointer = value_type*;
+
+  flat_hash_iterator() noexcept : ctrl_(nullptr), slot_(nullptr) {}
+
+  flat_hash_iterator(const flat_ctrl_t* ctrl, _Tp* slot) noexcept
+      : ctrl_(ctrl), slot_(slot) {}
+
+  reference operator*() const { return *slot_; }
+
+  pointer operator->() const { return slot_; }
+
+  flat_hash_iterator& operator++() {
+    ++ctrl_;
+    ++slot_;
+    skip_empty_or_deleted();
+    return *this;
+  }
+
+  flat_hash_iterator operator++(int) {
+    flat_hash_iterator tmp(*this);
+    ++(*this);
+    return tmp;
+  }
+
+  friend bool operator==(const flat_hash_iterator& x,
+                         const flat_hash_iterator& y) {
+    return x.ctrl_ == y.ctrl_;
+  }
+
+  friend bool operator!=(const flat_hash_iterator& x,
+                         const flat_hash_iterator& y) {
+    return !(x == y);
+  }
+
+  template <class, class, class, class>
+  friend class flat_hash_table;
+  template <class>
+  friend class flat_hash_const_iterator;
+};
+
+template <class _Tp>
+class flat_hash_const_iterator {
+  const flat_ctrl_t* ctrl_;
+  const _Tp* slot_;
+
+ public:
+  using non_const_iterator = flat_hash_iterator<_Tp>;
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = _Tp;
+  using difference_type = ptrdiff_t;
+  using reference = const value_type&;
+  using pointer = const value_type*;
+
+  flat_hash_const_iterator() noexcept : ctrl_(nullptr), slot_(nullptr) {}
+
+  flat_hash_const_iterator(const non_const_iterator& x) noexcept
+      : ctrl_(x.ctrl_), slot_(x.slot_) {}
+
+  reference operator*() const { return *slot_; }
+
+  pointer operator->() const { return slot_; }
+
+  flat_hash_const_iterator& operator++() {
+    ++ctrl_;
+    ++slot_;
+    while (flat_is_empty_or_deleted(*ctrl_)) {
+      size_t shift = flat_group(ctrl_).count_leading_empty_or_deleted();
+      ctrl_ += shift;
+      slot_ += shift;
+    }
+    return *this;
+  }
+
+  flat_hash_const_iterator operator++(int) {
+    flat_hash_const_iterator tmp(*this);
+    ++(*this);
+    return tmp;
+  }
+
+  friend bool operator==(const flat_hash_const_iterator& x,
+                         const flat_hash_const_iterator& y) {
+    return x.ctrl_ == y.ctrl_;
+  }
+
+  friend bool operator!=(const flat_hash_const_iterator& x,
+                         const flat_hash_const_iterator& y) {
+    return !(x == y);
+  }
+
+  template <class, class, class, class>
+  friend class flat_hash_table;
+};
+
+// ============================================================================
+// 开放寻址哈希表（Swiss table 布局）
+// ============================================================================
+// 与 hash_table 的接口保持一致（find/insert_unique/emplace_unique/...），
+// 同样要求 _Hash、_Equal 能接受存储的值类型；若二者同时接受其他键类型
+// （is_transparent 约定），find/erase_unique 等也可直接用该键类型调用。
+//
+// 元素连续存放在槽位数组中，没有节点和链表，因此 rehash 之后
+// 迭代器、指针和引用都会失效。
+template <class _Tp, class _Hash, class _Equal, class _Alloc>
+class flat_hash_table {
+ public:
+  using value_type = _Tp;
+  using hasher = _Hash;
+  using key_equal = _Equal;
+  using allocator_type = _Alloc;
+
+ private:
+  using alloc_traits = std::allocator_traits<allocator_type>;
+
+  // 槽位与控制字节分配器
+  using slot_allocator = typename alloc_traits::template rebind_alloc<_Tp>;
+  using slot_traits = std::allocator_traits<slot_allocator>;
+  using slot_pointer = typename slot_traits::pointer;
+  using ctrl_allocator =
+      typename alloc_traits::template rebind_alloc<flat_ctrl_t>;
+  using ctrl_traits = std::allocator_traits<ctrl_allocator>;
+  using ctrl_pointer = typename ctrl_traits::pointer;
+
+  // 成员变量
+  flat_ctrl_t* ctrl_;         // 控制字节数组（capacity + width 字节）
+  _Tp* slots_;                // 槽位数组（capacity 个）
+  size_t size_;               // 元素个数
+  size_t capacity_;           // 槽位数，0 或 2^k - 1
+  size_t growth_left_;        // 不扩容还能占用的 empty 槽位数
+  slot_allocator slot_alloc_;  // 槽位分配器
+  hasher hasher_;             // 哈希函数
+  key_equal key_eq_;          // 键相等性比较
+
+ public:
+  using size_type = typename alloc_traits::size_type;
+  using difference_type = typename alloc_traits::difference_type;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = typename alloc_traits::pointer;
+  using const_pointer = typename alloc_traits::const_pointer;
+
+  using iterator = flat_hash_iterator<_Tp>;
+  using const_iterator = flat_hash_const_iterator<_Tp>;
+
+  // 构造函数
+  flat_hash_table() noexcept
+      : ctrl_(const_cast<flat_ctrl_t*>(flat_empty_group())),
+        slots_(nullptr),
+        size_(0),
+        capacity_(0),
+        growth_left_(0),
+        slot_alloc_(),
+        hasher_(),
+        key_eq_() {}
+
+  flat_hash_table(const hasher& hf, const key_equal& eql)
+      : ctrl_(const_cast<flat_ctrl_t*>(flat_empty_group())),
+        slots_(nullptr),
+        size_(0),
+        capacity_(0),
+        growth_left_(0),
+        slot_alloc_(),
+        hasher_(hf),
+        key_eq_(eql) {}
+
+  flat_hash_table(const hasher& hf, const key_equal& eql,
+                  const allocator_type& a)
+      : ctrl_(const_cast<flat_ctrl_t*>(flat_empty_group())),
+        slots_(nullptr),
+        size_(0),
+        capacity_(0),
+        growth_left_(0),
+        slot_alloc_(a),
+        hasher_(hf),
+        key_eq_(eql) {}
+
+  explicit flat_hash_table(const allocator_type& a)
+      : ctrl_(const_cast<flat_ctrl_t*>(flat_empty_group())),
+        slots_(nullptr),
+        size_(0),
+        capacity_(0),
+        growth_left_(0),
+        slot_alloc_(a),
+        hasher_(),
+        key_eq_() {}
+
+  // 拷贝构造：按目标大小一次性分配，再逐个插入
+  flat_hash_table(const flat_hash_table& other)
+      : flat_hash_table(other.hasher_, other.key_eq_,
+                        slot_traits::select_on_container_copy_construction(
+                            other.slot_alloc_)) {
+    reserve_unique(other.size());
+    for (const_iterator it = other.begin(); it != other.end(); ++it) {
+      insert_unique(*it);
+    }
+  }
+
+  // 移动构造：直接接管数组
+  flat_hash_table(flat_hash_table&& other) noexcept
+      : ctrl_(other.ctrl_),
+        slots_(other.slots_),
+        size_(other.size_),
+        capacity_(other.capacity_),
+        growth_left_(other.growth_left_),
+        slot_alloc_(std::move(other.slot_alloc_)),
+        hasher_(std::move(other.hasher_)),
+        key_eq_(std::move(other.key_eq_)) {
+    other.reset_to_empty();
+  }
+
+  ~flat_hash_table() { destroy_and_deallocate(); }
+
+  flat_hash_table& operator=(const flat_hash_table& other) {
+    if (this != &other) {
+      flat_hash_table tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  flat_hash_table& operator=(flat_hash_table&& other) noexcept {
+    if (this != &other) {
+      destroy_and_deallocate();
+      ctrl_ = other.ctrl_;
+      slots_ = other.slots_;
+      size_ = other.size_;
+      capacity_ = other.capacity_;
+      growth_left_ = other.growth_left_;
+      if (slot_traits::propagate_on_container_move_assignment::value) {
+        slot_alloc_ = std::move(other.slot_alloc_);
+      }
+      hasher_ = std::move(other.hasher_);
+      key_eq_ = std::move(other.key_eq_);
+      other.reset_to_empty();
+    }
+    return *this;
+  }
+
+  // 访问器
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept { return capacity_; }
+
+  hasher& hash_function() noexcept { return hasher_; }
+  const hasher& hash_function() const noexcept { return hasher_; }
+
+  key_equal& key_eq() noexcept { return key_eq_; }
+  const key_equal& key_eq() const noexcept { return key_eq_; }
+
+  slot_allocator& slot_alloc() noexcept { return slot_alloc_; }
+  const slot_allocator& slot_alloc() const noexcept { return slot_alloc_; }
+
+  size_type max_size() const noexcept {
+    return std::min<size_type>(slot_traits::max_size(slot_alloc()),
+                               std::numeric_limits<difference_type>::max());
+  }
+
+  // 开放寻址没有“桶”的概念，这里以槽位数作为 bucket_count
+  size_type bucket_count() const noexcept { return capacity_; }
+
+  float load_factor() const noexcept {
+    return capacity_ != 0 ? static_cast<float>(size_) / capacity_ : 0.0f;
+  }
+
+  float max_load_factor() const noexcept { return 0.875f; }
+
+  // 迭代器
+  iterator begin() noexcept {
+    iterator it(ctrl_, slots_);
+    it.skip_empty_or_deleted();
+    return it;
+  }
+
+  iterator end() noexcept { return iterator(ctrl_ + capacity_, nullptr); }
+
+  const_iterator begin() const noexcept {
+    return const_cast<flat_hash_table*>(this)->begin();
+  }
+
+  const_iterator end() const noexcept {
+    return const_cast<flat_hash_table*>(this)->end();
+  }
+
+  // 查找
+  template <class _Key>
+  iterator find(const _Key& k) {
+    size_t hash = hash_of(k);
+    flat_probe_seq seq(flat_h1(hash), capacity_);
+    while (true) {
+      flat_group g(ctrl_ + seq.offset());
+      for (flat_bitmask m = g.match(flat_h2(hash)); m; m.clear_lowest()) {
+        size_t i = seq.offset(m.lowest_bit_set());
+        if (key_eq()(slots_[i], k)) {
+          return iterator_at(i);
+        }
+      }
+      if (g.match_empty()) {
+        return end();
+      }
+      seq.next();
+    }
+  }
+
+  template <class _Key>
+  const_iterator find(const _Key& k) const {
+    return const_cast<flat_hash_table*>(this)->find(k);
+  }
+
+  // 计数
+  template <class _Key>
+  size_type count_unique(const _Key& k) const {
+    return static_cast<size_type>(find(k) != end());
+  }
+
+  // 清空：保留已分配的数组，只把控制字节重置为 empty
+  void clear() noexcept {
+    if (capacity_ == 0) {
+      return;
+    }
+    destroy_slots();
+    reset_ctrl();
+    size_ = 0;
+    growth_left_ = flat_capacity_to_growth(capacity_);
+  }
+
+  // 删除
+  iterator erase(const_iterator p) {
+    size_t i = static_cast<size_t>(p.ctrl_ - ctrl_);
+    slot_traits::destroy(slot_alloc(), slots_ + i);
+    erase_meta_only(i);
+    iterator r = iterator_at(i);
+    ++r;
+    return r;
+  }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    while (first != last) {
+      first = erase(first);
+    }
+    return iterator_at(static_cast<size_t>(last.ctrl_ - ctrl_));
+  }
+
+  template <class _Key>
+  size_type erase_unique(const _Key& k) {
+    iterator i = find(k);
+    if (i == end()) {
+      return 0;
+    }
+    erase(i);
+    return 1;
+  }
+
+  // 交换
+  void swap(flat_hash_table& u) noexcept {
+    std::swap(ctrl_, u.ctrl_);
+    std::swap(slots_, u.slots_);
+    std::swap(size_, u.size_);
+    std::swap(capacity_, u.capacity_);
+    std::swap(growth_left_, u.growth_left_);
+    std::swap(slot_alloc_, u.slot_alloc_);
+    std::swap(hasher_, u.hasher_);
+    std::swap(key_eq_, u.key_eq_);
+  }
+
+  // Rehash：n 为期望的最小槽位数，不会缩到装不下当前元素
+  void rehash_unique(size_type n) {
+    if (n == 0 && size_ == 0) {
+      destroy_and_deallocate();
+      reset_to_empty();
+      return;
+    }
+    size_type target = std::max<size_type>(flat_normalize_capacity(n),
+                                           flat_growth_to_capacity(size_));
+    if (target != capacity_) {
+      resize(target);
+    }
+  }
+
+  void reserve_unique(size_type n) {
+    if (n > size_ + growth_left_) {
+      resize(flat_growth_to_capacity(n));
+    }
+  }
+
+  // 插入接口
+  std::pair<iterator, bool> insert_unique(const value_type& x) {
+    return emplace_unique_key_args(x, x);
+  }
+
+  std::pair<iterator, bool> insert_unique(value_type&& x) {
+    return emplace_unique_key_args(x, std::move(x));
+  }
+
+  // 先构造出值才能得到键；命中时临时值被丢弃（与 hash_table 构造节点一致）
+  template <class... Args>
+  std::pair<iterator, bool> emplace_unique(Args&&... args) {
+    value_type tmp(std::forward<Args>(args)...);
+    return emplace_unique_key_args(tmp, std::move(tmp));
+  }
+
+  // 用键探测，仅在未命中时原地构造值
+  template <class _Key, class... Args>
+  std::pair<iterator, bool> emplace_unique_key_args(const _Key& k,
+                                                    Args&&... args) {
+    std::pair<size_t, bool> r = find_or_prepare_insert(k);
+    if (r.second) {
+      try {
+        slot_traits::construct(slot_alloc(), slots_ + r.first,
+                               std::forward<Args>(args)...);
+      } catch (...) {
+        erase_meta_only(r.first);
+        throw;
+      }
+    }
+    return std::pair<iterator, bool>(iterator_at(r.first), r.second);
+  }
+
+ private:
+  template <class _Key>
+  size_t hash_of(const _Key& k) const {
+    return hash_mix(hash_function()(k));
+  }
+
+  iterator iterator_at(size_t i) noexcept {
+    return iterator(ctrl_ + i, slots_ + i);
+  }
+
+  // 写控制字节，同时维护数组尾部对前 width - 1 个字节的镜像，
+  // 使得从任意位置开始读取一整组都不会越界
+  void set_ctrl(size_t i, flat_ctrl_t h) noexcept {
+    set_ctrl(ctrl_, capacity_, i, h);
+  }
+
+  static void set_ctrl(flat_ctrl_t* ctrl, size_t capacity, size_t i,
+                       flat_ctrl_t h) noexcept {
+    ctrl[i] = h;
+    ctrl[((i - (flat_group::width - 1)) & capacity) +
+         ((flat_group::width - 1) & capacity)] = h;
+  }
+
+  void reset_ctrl() noexcept { reset_ctrl(ctrl_, capacity_); }
+
+  static void reset_ctrl(flat_ctrl_t* ctrl, size_t capacity) noexcept {
+    for (size_t i = 0; i < capacity + flat_group::width; ++i) {
+      ctrl[i] = flat_ctrl_empty;
+    }
+    ctrl[capacity] = flat_ctrl_sentinel;
+  }
+
+  void reset_to_empty() noexcept {
+    ctrl_ = const_cast<flat_ctrl_t*>(flat_empty_group());
+    slots_ = nullptr;
+    size_ = 0;
+    capacity_ = 0;
+    growth_left_ = 0;
+  }
+
+  // 返回探测序列上第一个 empty 或 deleted 槽位
+  size_t find_first_non_full(size_t hash) const noexcept {
+    return find_first_non_full(ctrl_, capacity_, hash);
+  }
+
+  static size_t find_first_non_full(const flat_ctrl_t* ctrl, size_t capacity,
+                                    size_t hash) noexcept {
+    flat_probe_seq seq(flat_h1(hash), capacity);
+    while (true) {
+      flat_bitmask m =
+          flat_group(ctrl + seq.offset()).match_empty_or_deleted();
+      if (m) {
+        return seq.offset(m.lowest_bit_set());
+      }
+      seq.next();
+    }
+  }
+
+  template <class _Key>
+  std::pair<size_t, bool> find_or_prepare_insert(const _Key& k) {
+    size_t hash = hash_of(k);
+    flat_probe_seq seq(flat_h1(hash), capacity_);
+    while (true) {
+      flat_group g(ctrl_ + seq.offset());
+      for (flat_bitmask m = g.match(flat_h2(hash)); m; m.clear_lowest()) {
+        size_t i = seq.offset(m.lowest_bit_set());
+        if (key_eq()(slots_[i], k)) {
+          return std::pair<size_t, bool>(i, false);
+        }
+      }
+      if (g.match_empty()) {
+        break;
+      }
+      seq.next();
+    }
+    return std::pair<size_t, bool>(prepare_insert(hash), true);
+  }
+
+  // 预留一个槽位并写好控制字节，值由调用者构造
+  size_t prepare_insert(size_t hash) {
+    size_t target = find_first_non_full(hash);
+    if (growth_left_ == 0 && !flat_is_deleted(ctrl_[target])) {
+      rehash_and_grow_if_necessary();
+      target = find_first_non_full(hash);
+    }
+    ++size_;
+    growth_left_ -= flat_is_empty(ctrl_[target]);
+    set_ctrl(target, flat_h2(hash));
+    return target;
+  }
+
+  // 墓碑占了大多数时原地清理（同容量重建），否则容量翻倍
+  void rehash_and_grow_if_necessary() {
+    if (capacity_ != 0 && size_ * 2 <= flat_capacity_to_growth(capacity_)) {
+      resize(capacity_);
+    } else {
+      resize(flat_normalize_capacity(capacity_ * 2 + 1));
+    }
+  }
+
+  // 删除只更新元数据：如果该槽位两侧的 empty 连起来不足一整组，
+  // 说明从未有探测越过它，可以直接置为 empty，否则只能留下墓碑
+  void erase_meta_only(size_t i) noexcept {
+    --size_;
+    size_t index_before = (i - flat_group::width) & capacity_;
+    flat_bitmask empty_after = flat_group(ctrl_ + i).match_empty();
+    flat_bitmask empty_before = flat_group(ctrl_ + index_before).match_empty();
+    bool was_never_full = empty_before && empty_after &&
+                          static_cast<size_t>(empty_after.trailing_zeros() +
+                                              empty_before.leading_zeros()) <
+                              flat_group::width;
+    set_ctrl(i, was_never_full ? flat_ctrl_empty : flat_ctrl_deleted);
+    growth_left_ += was_never_full;
+  }
+
+  // 先在局部的新数组中放好全部元素，成功后才替换成员。
+  // 移动构造可能抛出时改为拷贝（move_if_noexcept），失败时原表不变；
+  // 元素已被移走后哈希函数抛出则无法复原，此时清空本表
+  void resize(size_t new_capacity) {
+    ctrl_allocator ca(slot_alloc());
+    ctrl_pointer ctrl_p =
+        ctrl_traits::allocate(ca, new_capacity + flat_group::width);
+    slot_pointer slots_p;
+    try {
+      slots_p = slot_traits::allocate(slot_alloc(), new_capacity);
+    } catch (...) {
+      ctrl_traits::deallocate(ca, ctrl_p, new_capacity + flat_group::width);
+      throw;
+    }
+    flat_ctrl_t* new_ctrl = std::addressof(*ctrl_p);
+    _Tp* new_slots = std::addressof(*slots_p);
+    reset_ctrl(new_ctrl, new_capacity);
+
+    // 重新放置元素：不缓存哈希值，需要重新计算
+    try {
+      for (size_t i = 0; i < capacity_; ++i) {
+        if (flat_is_full(ctrl_[i])) {
+          size_t hash = hash_of(slots_[i]);
+          size_t target = find_first_non_full(new_ctrl, new_capacity, hash);
+          slot_traits::construct(slot_alloc(), new_slots + target,
+                                 std::move_if_noexcept(slots_[i]));
+          set_ctrl(new_ctrl, new_capacity, target, flat_h2(hash));
+        }
+      }
+    } catch (...) {
+      destroy_slots(new_ctrl, new_slots, new_capacity);
+      deallocate_arrays(new_ctrl, new_slots, new_capacity);
+      if (std::is_nothrow_move_constructible<_Tp>::value ||
+          !std::is_copy_constructible<_Tp>::value) {
+        clear();
+      }
+      throw;
+    }
+
+    destroy_and_deallocate();
+    ctrl_ = new_ctrl;
+    slots_ = new_slots;
+    capacity_ = new_capacity;
+    growth_left_ = flat_capacity_to_growth(capacity_) - size_;
+  }
+
+  void destroy_slots() noexcept { destroy_slots(ctrl_, slots_, capacity_); }
+
+  void destroy_slots(const flat_ctrl_t* ctrl, _Tp* slots,
+                     size_t capacity) noexcept {
+    for (size_t i = 0; i < capacity; ++i) {
+      if (flat_is_full(ctrl[i])) {
+        slot_traits::destroy(slot_alloc(), slots + i);
+      }
+    }
+  }
+
+  void deallocate_arrays(flat_ctrl_t* ctrl, _Tp* slots,
+                         size_t capacity) noexcept {
+    ctrl_allocator ca(slot_alloc());
+    ctrl_traits::deallocate(
+        ca, std::pointer_traits<ctrl_pointer>::pointer_to(*ctrl),
+        capacity + flat_group::width);
+    slot_traits::deallocate(
+        slot_alloc(), std::pointer_traits<slot_pointer>::pointer_to(*slots),
+        capacity);
+  }
+
+  void destroy_and_deallocate() noexcept {
+    if (capacity_ == 0) {
+      return;
+    }
+    destroy_slots();
+    deallocate_arrays(ctrl_, slots_, capacity_);
+  }
+};
+
+}  // namespace mystl
+
+#endif  // TINYSTL_FLAT_HASH_TABLE_H_
@@ -0,0 +1,187 @@
+#ifndef TINYSTL___FUNCTIONAL_HASH_H
+#define TINYSTL___FUNCTIONAL_HASH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace mystl {
+
+template <class CharT, class Traits, class Allocator>
+class basic_string;
+
+// mystl::hash：可替换 std::hash 的高质量哈希函数
+// std::hash<int> 在 libstdc++ 上是恒等映射，桶数为 2 的幂时只用低位，
+// 连续或等步长的整数会集中到少数桶中。这里：
+//   - 整数、枚举、指针：一次 64x64→128 位乘法后高低两半异或（wyhash 的 mum），
+//     每个输入位都会影响输出的低位；
+//   - 字符串、string_view 及任意连续字节（hash_bytes）：wyhash 风格的乘法
+//     折叠，长输入每轮用三条独立的乘法链处理 48 字节，短输入不进循环；
+//   - 其他类型退回 std::hash<T>，用户对 std::hash 的特化仍然有效。
+// 结果只保证在同一进程内稳定，不要持久化。
+// 用法：mystl::unordered_map<K, V, mystl::hash<K>>
+
+namespace detail {
+
+inline constexpr uint64_t hash_secret[4] = {
+    0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL, 0x4b33a62ed433d4a3ULL,
+    0x4d5a2da51de1aa47ULL};
+
+// 64x64→128 位乘法，返回低、高两半
+inline void hash_mum(uint64_t& a, uint64_t& b) noexcept {
+#if defined(__SIZEOF_INT128__)
+  __extension__ using uint128 = unsigned __int128;
+  uint128 r = static_cast<uint128>(a) * b;
+  a = static_cast<uint64_t>(r);
+  b = static_cast<uint64_t>(r >> 64);
+#else
+  uint64_t ha = a >> 32, hb = b >> 32;
+  uint64_t la = a & 0xffffffffu, lb = b & 0xffffffffu;
+  uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+  uint64_t t = rl + (rm0 << 32);
+  uint64_t c = t < rl;
+  uint64_t lo = t + (rm1 << 32);
+  c += lo < t;
+  a = lo;
+  b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+}
+
+inline uint64_t hash_mix(uint64_t a, uint64_t b) noexcept {
+  hash_mum(a, b);
+  return a ^ b;
+}
+
+// 按本机字节序读取，结果只在进程内使用，不需要统一字节序
+inline uint64_t hash_read64(const unsigned char* p) noexcept {
+  uint64_t v;
+  std::memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+inline uint64_t hash_read32(const unsigned char* p) noexcept {
+  uint32_t v;
+  std::memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+// 1 到 3 个字节：首、中、尾各取一个
+inline uint64_t hash_read_small(const unsigned char* p, size_t k) noexcept {
+  return (static_cast<uint64_t>(p[0]) << 16) |
+         (static_cast<uint64_t>(p[k >> 1]) << 8) | p[k - 1];
+}
+
+}  // namespace detail
+
+// 任意连续字节的哈希
+inline uint64_t hash_bytes(const void* data, size_t len,
+                           uint64_t seed = 0) noexcept {
+  using detail::hash_mix;
+  using detail::hash_read32;
+  using detail::hash_read64;
+  const uint64_t* s = detail::hash_secret;
+  const unsigned char* p = static_cast<const unsigned char*>(data);
+  seed ^= hash_mix(seed ^ s[0], s[1]);
+  uint64_t a, b;
+  if (len <= 16) {
+    if (len >= 4) {
+      // 4..16 字节：首尾各读两个可能重叠的 32 位
+      const size_t off = (len >> 3) << 2;
+      a = (hash_read32(p) << 32) | hash_read32(p + off);
+      b = (hash_read32(p + len - 4) << 32) | hash_read32(p + len - 4 - off);
+    } else if (len > 0) {
+      a = detail::hash_read_small(p, len);
+      b = 0;
+    } else {
+      a = b = 0;
+    }
+  } else {
+    size_t i = len;
+    if (i > 48) {
+      // 三条链互不依赖，乘法可以流水执行
+      uint64_t see1 = seed, see2 = seed;
+      do {
+        seed = hash_mix(hash_read64(p) ^ s[1], hash_read64(p + 8) ^ seed);
+        see1 = hash_mix(hash_read64(p + 16) ^ s[2], hash_read64(p + 24) ^ see1);
+        see2 = hash_mix(hash_read64(p + 32) ^ s[3], hash_read64(p + 40) ^ see2);
+        p += 48;
+        i -= 48;
+      } while (i > 48);
+      seed ^= see1 ^ see2;
+    }
+    while (i > 16) {
+      seed = hash_mix(hash_read64(p) ^ s[1], hash_read64(p + 8) ^ seed);
+      p += 16;
+      i -= 16;
+    }
+    // 最后 16 字节（可能与已处理部分重叠）
+    a = hash_read64(p + i - 16);
+    b = hash_read64(p + i - 8);
+  }
+  a ^= s[1];
+  b ^= seed;
+  detail::hash_mum(a, b);
+  return hash_mix(a ^ s[0] ^ len, b ^ s[1]);
+}
+
+// 单个 64 位整数的哈希
+inline uint64_t hash_int(uint64_t x) noexcept {
+  return detail::hash_mix(x, 0x9e3779b97f4a7c15ULL);
+}
+
+// -------------------------- hash<T> --------------------------
+// 主模板：退回 std::hash
+template <class T, class = void>
+struct hash : std::hash<T> {};
+
+// 整数与枚举
+template <class T>
+struct hash<T, std::enable_if_t<std::is_integral_v<T> || std::is_enum_v<T>>> {
+  size_t operator()(T v) const noexcept {
+    return static_cast<size_t>(hash_int(static_cast<uint64_t>(v)));
+  }
+};
+
+// 指针：地址按对齐分布，低位几乎总是 0
+template <class T>
+struct hash<T*> {
+  size_t operator()(T* p) const noexcept {
+    return static_cast<size_t>(
+        hash_int(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(p))));
+  }
+};
+
+// 字符串与字符串视图：同样内容的 string 和 string_view 哈希值相同，
+// 声明 is_transparent，配合透明比较（如 std::equal_to<>）可以用
+// string_view 查找 string 键
+template <class CharT, class Traits>
+struct hash<std::basic_string_view<CharT, Traits>> {
+  using is_transparent = void;
+
+  size_t operator()(std::basic_string_view<CharT, Traits> s) const noexcept {
+    return static_cast<size_t>(
+        hash_bytes(s.data(), s.size() * sizeof(CharT)));
+  }
+};
+
+template <class CharT, class Traits, class Alloc>
+struct hash<std::basic_string<CharT, Traits, Alloc>>
+    : hash<std::basic_string_view<CharT, Traits>> {};
+
+// mystl::basic_string：与内容相同的 std::string 哈希值相同
+template <class CharT, class Traits, class Alloc>
+struct hash<basic_string<CharT, Traits, Alloc>> {
+  size_t operator()(const basic_string<CharT, Traits, Alloc>& s) const
+      noexcept {
+    return static_cast<size_t>(
+        hash_bytes(s.data(), s.size() * sizeof(CharT)));
+  }
+};
+
+}  // namespace mystl
+
+#endif  // TINYSTL___FUNCTIONAL_HASH_H
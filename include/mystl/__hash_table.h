@@ -4,10 +4,31 @@
 #include <algorithm>  // for max, min
 #include <cmath>      // for ceil
 #include <cstddef>    // for size_t, ptrdiff_t
+#include <cstdint>    // for uint32_t, uint64_t
+#include <exception>  // for exception_ptr
 #include <iterator>   // for forward_iterator_tag
 #include <limits>     // for numeric_limits
 #include <memory>  // for allocator_traits, unique_ptr, addressof, pointer_traits
+#include <thread>  // for thread
+#include <type_traits>  // for is_void
 #include <utility>  // for pair, move, forward
+#include <vector>   // for vector
+
+#include "__memory/footprint.h"  // for memory_footprint
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>  // for __umulh, _mm_prefetch
+#endif
+
+// 运行时计数器（rehash 次数、搬移的节点数、rehash 耗时）默认不编译，
+// 编译时定义 TINYSTL_HASH_TABLE_COUNTERS=1 开启，结果由 stats() 返回
+#ifndef TINYSTL_HASH_TABLE_COUNTERS
+#define TINYSTL_HASH_TABLE_COUNTERS 0
+#endif
+
+#if TINYSTL_HASH_TABLE_COUNTERS
+#include <chrono>  // for steady_clock
+#endif
 
 namespace mystl {
 
@@ -18,14 +39,11 @@ template <class _NodePtr>
 class hash_iterator;
 template <class _ConstNodePtr>
 class hash_const_iterator;
-template <class _NodePtr>
+template <class _NodePtr, class _Bucketer>
 class hash_local_iterator;
-template <class _ConstNodePtr>
+template <class _ConstNodePtr, class _Bucketer>
 class hash_const_local_iterator;
 
-template <class _Tp, class _Hash, class _Equal, class _Alloc>
-class hash_table;
-
 // ============================================================================
 // 辅助函数：计算下一个质数（简化版本）
 // ============================================================================
@@ -92,6 +110,343 @@ inline size_t next_hash_pow2(size_t n) {
   return n + 1;
 }
 
+// ============================================================================
+// 辅助函数：哈希混合
+// ============================================================================
+// std::hash<int> 在 libstdc++ 上是恒等映射，只取低位（掩码）时连续或等步长的
+// 整数会集中到少数桶里。这里用 murmur3 的 fmix 把熵扩散到所有位。
+inline size_t hash_mix(size_t h) noexcept {
+  if constexpr (sizeof(size_t) >= 8) {
+    uint64_t x = static_cast<uint64_t>(h);
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    return static_cast<size_t>(x);
+  } else {
+    uint32_t x = static_cast<uint32_t>(h);
+    x ^= x >> 16;
+    x *= 0x85ebca6bU;
+    x ^= x >> 13;
+    return static_cast<size_t>(x);
+  }
+}
+
+// ============================================================================
+// 辅助函数：64 位乘法取高 64 位
+// ============================================================================
+inline uint64_t hash_mulhi64(uint64_t a, uint64_t b) noexcept {
+#if defined(__SIZEOF_INT128__)
+  __extension__ using uint128 = unsigned __int128;
+  return static_cast<uint64_t>((static_cast<uint128>(a) * b) >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+  return __umulh(a, b);
+#else
+  uint64_t a_lo = a & 0xffffffffu;
+  uint64_t a_hi = a >> 32;
+  uint64_t b_lo = b & 0xffffffffu;
+  uint64_t b_hi = b >> 32;
+  uint64_t lo_lo = a_lo * b_lo;
+  uint64_t hi_lo = a_hi * b_lo;
+  uint64_t lo_hi = a_lo * b_hi;
+  uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xffffffffu) + lo_hi;
+  return a_hi * b_hi + (hi_lo >> 32) + (cross >> 32);
+#endif
+}
+
+// ============================================================================
+// 辅助函数：软件预取
+// ============================================================================
+// 仅为提示，不影响语义；不支持的编译器上为空操作
+inline void hash_prefetch(const void* p) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_prefetch(p);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  _mm_prefetch(static_cast<const char*>(p), _MM_HINT_T0);
+#else
+  (void)p;
+#endif
+}
+
+// ============================================================================
+// 质数表与快速取模常数
+// ============================================================================
+// 相邻两项约为 2 倍，最大项是小于 2^32 的最大质数。
+// 对每个质数 d 预先算好 M = floor((2^64 - 1) / d) + 1，之后对任意 32 位整数 a，
+// a % d == mulhi64(M * a, d)（Lemire 等，"Faster Remainder by Direct
+// Computation"），整个映射只有两次乘法，没有除法。
+inline constexpr uint32_t hash_prime_list[] = {
+    3u,         7u,         13u,        29u,        53u,        97u,
+    193u,       389u,       769u,       1543u,      3079u,      6151u,
+    12289u,     24593u,     49157u,     98317u,     196613u,    393241u,
+    786433u,    1572869u,   3145739u,   6291469u,   12582917u,  25165843u,
+    50331653u,  100663319u, 201326611u, 402653189u, 805306457u, 1610612741u,
+    3221225473u, 4294967291u};
+
+inline constexpr size_t hash_prime_list_size =
+    sizeof(hash_prime_list) / sizeof(hash_prime_list[0]);
+
+struct hash_fastmod_table {
+  uint64_t magic[hash_prime_list_size];
+
+  constexpr hash_fastmod_table() : magic() {
+    for (size_t i = 0; i < hash_prime_list_size; ++i) {
+      magic[i] = UINT64_MAX / hash_prime_list[i] + 1;
+    }
+  }
+};
+
+inline constexpr hash_fastmod_table hash_fastmod_magic{};
+
+// ============================================================================
+// 桶数策略
+// ============================================================================
+// 决定 hash_table 可以使用哪些桶数，以及哈希值如何映射到桶下标。
+// 策略对象保存在 hash_table 和局部迭代器中，需要提供：
+//   static size_t round_bucket_count(size_t n)：不小于 n 的合法桶数
+//   static size_t grow_bucket_count(size_t bc)：扩容时建议的下一个桶数
+//   void reset(size_t bc)：桶数变为 bc（bc 为 0 或 round_bucket_count 的结果）
+//   size_t constrain(size_t h) const：哈希值对应的桶下标，桶数非 0 时才调用
+
+// 默认策略：与标准库行为一致。用户请求 2 的幂时保持 2 的幂并用掩码，
+// 否则取试除法找到的质数并用取模。桶数是否为 2 的幂在 reset 时算好，
+// 查找时只剩一个随桶数固定、可以完美预测的分支；需要完全没有分支时
+// 选用下面的质数、2 的幂或掩码策略
+class hash_default_bucket_policy {
+  size_t bucket_count_;
+  size_t mask_;  // 桶数为 2 的幂时为 bucket_count_ - 1，否则为 0
+
+ public:
+  hash_default_bucket_policy() noexcept : bucket_count_(0), mask_(0) {}
+
+  static size_t round_bucket_count(size_t n) noexcept {
+    if (n == 1) {
+      return 2;
+    }
+    return is_hash_power2(n) ? n : next_prime(n);
+  }
+
+  static size_t grow_bucket_count(size_t bc) noexcept {
+    return 2 * bc + !is_hash_power2(bc);
+  }
+
+  void reset(size_t bc) noexcept {
+    bucket_count_ = bc;
+    mask_ = is_hash_power2(bc) ? bc - 1 : 0;
+  }
+
+  size_t constrain(size_t h) const noexcept {
+    if (mask_ != 0) {
+      return h & mask_;
+    }
+    return h < bucket_count_ ? h : h % bucket_count_;
+  }
+};
+
+// 质数策略：桶数取自预计算的质数表，取模用乘法代替除法。
+// 64 位哈希先折叠成 32 位再取模，因此高位同样参与桶的选择
+class hash_prime_bucket_policy {
+  uint64_t magic_;
+  uint32_t prime_;
+
+  static size_t prime_index(size_t n) noexcept {
+    const uint32_t* first = hash_prime_list;
+    const uint32_t* last = hash_prime_list + hash_prime_list_size;
+    const uint32_t* p = std::lower_bound(first, last, n);
+    // 超出表的范围时停在最大的质数，负载因子会随之上升
+    return p == last ? hash_prime_list_size - 1
+                     : static_cast<size_t>(p - first);
+  }
+
+ public:
+  hash_prime_bucket_policy() noexcept : magic_(0), prime_(0) {}
+
+  static size_t round_bucket_count(size_t n) noexcept {
+    return hash_prime_list[prime_index(n)];
+  }
+
+  // 表中相邻质数约为 2 倍，取下一项即可；直接用 2 * bc 会跳过一项
+  static size_t grow_bucket_count(size_t bc) noexcept { return bc + 1; }
+
+  void reset(size_t bc) noexcept {
+    if (bc == 0) {
+      magic_ = 0;
+      prime_ = 0;
+      return;
+    }
+    size_t i = prime_index(bc);
+    magic_ = hash_fastmod_magic.magic[i];
+    prime_ = hash_prime_list[i];
+  }
+
+  size_t constrain(size_t h) const noexcept {
+    uint64_t x = static_cast<uint64_t>(h);
+    uint32_t a = static_cast<uint32_t>(x ^ (x >> 32));
+    uint64_t lowbits = magic_ * a;
+    return static_cast<size_t>(hash_mulhi64(lowbits, prime_));
+  }
+};
+
+// 2 的幂策略：桶数总是 2 的幂，先混合哈希再用掩码取低位
+class hash_power2_bucket_policy {
+  size_t mask_;
+
+ public:
+  hash_power2_bucket_policy() noexcept : mask_(0) {}
+
+  static size_t round_bucket_count(size_t n) noexcept {
+    return n < 2 ? 2 : next_hash_pow2(n);
+  }
+
+  static size_t grow_bucket_count(size_t bc) noexcept {
+    return bc == 0 ? 2 : 2 * bc;
+  }
+
+  void reset(size_t bc) noexcept { mask_ = bc == 0 ? 0 : bc - 1; }
+
+  size_t constrain(size_t h) const noexcept { return hash_mix(h) & mask_; }
+};
+
+// 掩码策略：桶数总是 2 的幂，直接取哈希值的低位，映射只有一条 AND 指令。
+// 只适合低位已经充分混合的哈希函数（如 mystl::hash），
+// 配合 std::hash<int> 这类恒等哈希时等步长的键会严重冲突
+class hash_mask_bucket_policy {
+  size_t mask_;
+
+ public:
+  hash_mask_bucket_policy() noexcept : mask_(0) {}
+
+  static size_t round_bucket_count(size_t n) noexcept {
+    return hash_power2_bucket_policy::round_bucket_count(n);
+  }
+
+  static size_t grow_bucket_count(size_t bc) noexcept {
+    return hash_power2_bucket_policy::grow_bucket_count(bc);
+  }
+
+  void reset(size_t bc) noexcept { mask_ = bc == 0 ? 0 : bc - 1; }
+
+  size_t constrain(size_t h) const noexcept { return h & mask_; }
+};
+
+// ============================================================================
+// 哈希值缓存策略
+// ============================================================================
+// 决定节点中保存哪些哈希信息。hash_table 内部统一使用 reduce 之后的哈希值
+// （桶下标与比较键之前的快速拒绝都基于它），策略需要提供：
+//   stored_type：节点中保存的类型，void 表示不保存
+//   static size_t reduce(size_t h)：把哈希函数的结果规约为表内使用的哈希值，
+//                                   须满足 reduce(reduce(h)) == reduce(h)
+
+// 保存完整哈希值（默认）：rehash、桶迭代都不调用哈希函数
+struct hash_cache_full {
+  using stored_type = size_t;
+  static constexpr size_t reduce(size_t h) noexcept { return h; }
+};
+
+// 保存 32 位指纹：完整哈希值的高低两半异或折叠，表内只使用这 32 位。
+// 仍然先比较指纹再比较键，适合键比较昂贵的字符串等类型；值类型对齐
+// 不超过 4 字节时节点比 hash_cache_full 小 8 字节，否则大小相同（补齐）。
+// 桶数超过 2^32 时多出的桶不会被用到
+struct hash_cache_fingerprint {
+  using stored_type = uint32_t;
+  static constexpr size_t reduce(size_t h) noexcept {
+    uint64_t x = static_cast<uint64_t>(h);
+    return static_cast<uint32_t>(x ^ (x >> 32));
+  }
+};
+
+// 不保存：rehash、桶迭代、查找时判断链段边界都重新计算哈希值。
+// 适合整数、指针等哈希函数几乎没有开销的键，每个节点省下一个 size_t。
+// 哈希函数不得抛出异常（rehash、删除等 noexcept 路径上也会调用）
+struct hash_cache_none {
+  using stored_type = void;
+  static constexpr size_t reduce(size_t h) noexcept { return h; }
+};
+
+template <class _Tp, class _Hash, class _Equal, class _Alloc,
+          class _Policy = hash_default_bucket_policy,
+          class _Cache = hash_cache_full>
+class hash_table;
+
+// ============================================================================
+// 统计信息：hash_table::stats() 的返回值
+// ============================================================================
+struct hash_table_stats {
+  size_t size = 0;
+  size_t bucket_count = 0;
+  float load_factor = 0.0f;
+  float max_load_factor = 0.0f;
+
+  // 链长分布：chain_length_histogram[i] 为恰好含 i 个节点的桶数
+  std::vector<size_t> chain_length_histogram;
+  size_t max_chain_length = 0;
+  size_t empty_buckets = 0;
+  double empty_bucket_ratio = 0.0;
+
+  // 平均探测次数（需要比较的节点数）。成功查找按现有元素平均；
+  // 失败查找假设哈希值均匀落入各桶，等于平均链长
+  double avg_probes_successful = 0.0;
+  double avg_probes_unsuccessful = 0.0;
+
+  // 内存占用：节点总字节数与桶数组字节数（含渐进式 rehash 的新旧数组）
+  size_t node_bytes = 0;
+  size_t bucket_bytes = 0;
+
+  // 运行时计数器，只有开启 TINYSTL_HASH_TABLE_COUNTERS 时才会非零
+  size_t rehash_count = 0;
+  size_t nodes_relinked = 0;
+  uint64_t rehash_nanoseconds = 0;  // 仅统计一次性 rehash（含并行 rehash）
+};
+
+// ============================================================================
+// 并行执行策略：rehash / reserve / clear 的并行重载
+// ============================================================================
+// 用法：map.rehash(n, mystl::par);  map.clear(mystl::parallel_policy(8));
+// threads 为 0 时取 std::thread::hardware_concurrency()。实际线程数还受
+// 元素个数限制（每个线程至少分到 hash_table::parallel_min_nodes 个节点），
+// 小表直接走串行实现。
+struct parallel_policy {
+  unsigned threads = 0;
+
+  constexpr parallel_policy() noexcept = default;
+  constexpr explicit parallel_policy(unsigned n) noexcept : threads(n) {}
+};
+
+inline constexpr parallel_policy par{};
+
+// 节点分配器的 deallocate 与元素析构能否在多个线程中同时调用。
+// 为 false 时并行 clear 退回串行释放（例如非线程安全的 node_pool_allocator）；
+// 线程安全的自定义分配器可以特化为 true_type
+template <class _Alloc>
+struct hash_concurrent_deallocate : std::false_type {};
+
+template <class _Tp>
+struct hash_concurrent_deallocate<std::allocator<_Tp>> : std::true_type {};
+
+inline constexpr size_t hash_parallel_max_threads = 64;
+
+// 执行 fn(0) … fn(workers - 1)：当前线程执行 0 号，其余各开一个线程。
+// 线程创建失败时剩下的任务由当前线程补做，因此不会抛出异常；fn 也不得抛出
+template <class _Fn>
+void hash_parallel_for(size_t workers, _Fn& fn) noexcept {
+  std::thread pool[hash_parallel_max_threads];
+  size_t started = 1;
+  for (; started < workers; ++started) {
+    try {
+      pool[started] = std::thread([&fn, started] { fn(started); });
+    } catch (...) {
+      break;
+    }
+  }
+  for (size_t w = started; w < workers; ++w) {
+    fn(w);
+  }
+  fn(0);
+  for (size_t w = 1; w < started; ++w) {
+    pool[w].join();
+  }
+}
+
 // ============================================================================
 // 节点基类
 // ============================================================================
@@ -117,26 +472,46 @@ struct hash_node_base {
     return std::pointer_traits<_NodePtr>::pointer_to(
         static_cast<node_type&>(*this));
   }
+};
 
-  size_t hash() const noexcept {
-    return static_cast<node_type const&>(*this).hash_;
-  }
+// ============================================================================
+// 节点中的哈希值（类型由哈希值缓存策略的 stored_type 决定）
+// ============================================================================
+template <class _Stored>
+struct hash_node_hash_storage {
+  // hash_：存储（规约后的）哈希值，紧跟在 next_ 之后
+  _Stored hash_;
+
+  explicit hash_node_hash_storage(size_t hash) noexcept
+      : hash_(static_cast<_Stored>(hash)) {}
+
+  size_t cached_hash() const noexcept { return hash_; }
+  void set_hash(size_t hash) noexcept { hash_ = static_cast<_Stored>(hash); }
+};
+
+// 不保存哈希值：空基类，不占节点空间
+template <>
+struct hash_node_hash_storage<void> {
+  explicit hash_node_hash_storage(size_t) noexcept {}
+
+  void set_hash(size_t) noexcept {}
 };
 
 // ============================================================================
 // 完整节点类
 // ============================================================================
-template <class _Tp, class _VoidPtr>
-struct hash_node : public hash_node_base<typename std::pointer_traits<
-                       _VoidPtr>::template rebind<hash_node<_Tp, _VoidPtr>>> {
+template <class _Tp, class _VoidPtr, class _Stored = size_t>
+struct hash_node
+    : public hash_node_base<typename std::pointer_traits<_VoidPtr>::
+                                template rebind<hash_node<_Tp, _VoidPtr,
+                                                          _Stored>>>,
+      public hash_node_hash_storage<_Stored> {
   using node_value_type = _Tp;
   using _Base = hash_node_base<typename std::pointer_traits<
-      _VoidPtr>::template rebind<hash_node<_Tp, _VoidPtr>>>;
+      _VoidPtr>::template rebind<hash_node<_Tp, _VoidPtr, _Stored>>>;
+  using _Storage = hash_node_hash_storage<_Stored>;
   using next_pointer = typename _Base::next_pointer;
 
-  // hash_：存储哈希值
-  size_t hash_;
-
  private:
   // value_：存储节点值
   union {
@@ -145,7 +520,7 @@ struct hash_node : public hash_node_base<typename std::pointer_traits<
 
  public:
   explicit hash_node(next_pointer next, size_t hash)
-      : _Base(next), hash_(hash) {}
+      : _Base(next), _Storage(hash) {}
 
   ~hash_node() {}
 
@@ -245,7 +620,7 @@ class hash_iterator {
     return !(x == y);
   }
 
-  template <class, class, class, class>
+  template <class, class, class, class, class, class>
   friend class hash_table;
   template <class>
   friend class hash_const_iterator;
@@ -304,14 +679,49 @@ class hash_const_iterator {
     return !(x == y);
   }
 
-  template <class, class, class, class>
+  template <class, class, class, class, class, class>
   friend class hash_table;
 };
 
+// ============================================================================
+// 局部迭代器判断节点所在桶：桶数策略（携带桶数）+ 节点的哈希值。
+// 节点保存哈希值时直接读取，否则带一份哈希函数重新计算
+// ============================================================================
+template <class _Policy, class _Hash, class _Cache,
+          bool = std::is_void<typename _Cache::stored_type>::value>
+class hash_node_bucketer {
+  _Policy policy_;
+
+ public:
+  hash_node_bucketer() = default;
+  hash_node_bucketer(const _Policy& policy, const _Hash&) : policy_(policy) {}
+
+  template <class _NextPtr>
+  size_t operator()(_NextPtr np) const {
+    return policy_.constrain(np->upcast()->cached_hash());
+  }
+};
+
+template <class _Policy, class _Hash, class _Cache>
+class hash_node_bucketer<_Policy, _Hash, _Cache, true> {
+  _Policy policy_;
+  _Hash hash_;
+
+ public:
+  hash_node_bucketer() = default;
+  hash_node_bucketer(const _Policy& policy, const _Hash& hf)
+      : policy_(policy), hash_(hf) {}
+
+  template <class _NextPtr>
+  size_t operator()(_NextPtr np) const {
+    return policy_.constrain(_Cache::reduce(hash_(np->upcast()->get_value())));
+  }
+};
+
 // ============================================================================
 // 局部（桶）迭代器
 // ============================================================================
-template <class _NodePtr>
+template <class _NodePtr, class _Bucketer>
 class hash_local_iterator {
   using _NodeTypes = hash_node_types<_NodePtr>;
   using node_pointer = _NodePtr;
@@ -319,7 +729,7 @@ class hash_local_iterator {
 
   next_pointer node_;
   size_t bucket_;
-  size_t bucket_count_;
+  _Bucketer bucket_of_;  // 用于判断是否走出当前桶
 
  public:
   using iterator_category = std::forward_iterator_tag;
@@ -331,8 +741,8 @@ class hash_local_iterator {
   hash_local_iterator() noexcept : node_(nullptr) {}
 
   explicit hash_local_iterator(next_pointer node, size_t bucket,
-                               size_t bucket_count) noexcept
-      : node_(node), bucket_(bucket), bucket_count_(bucket_count) {
+                               const _Bucketer& bucket_of)
+      : node_(node), bucket_(bucket), bucket_of_(bucket_of) {
     if (node_ != nullptr) {
       node_ = node_->next_;
     }
@@ -346,8 +756,7 @@ class hash_local_iterator {
 
   hash_local_iterator& operator++() {
     node_ = node_->next_;
-    if (node_ != nullptr &&
-        constrain_hash(node_->hash(), bucket_count_) != bucket_) {
+    if (node_ != nullptr && bucket_of_(node_) != bucket_) {
       node_ = nullptr;
     }
     return *this;
@@ -369,14 +778,14 @@ class hash_local_iterator {
     return !(x == y);
   }
 
-  template <class, class, class, class>
+  template <class, class, class, class, class, class>
   friend class hash_table;
 };
 
 // ============================================================================
 // Const 局部迭代器
 // ============================================================================
-template <class _ConstNodePtr>
+template <class _ConstNodePtr, class _Bucketer>
 class hash_const_local_iterator {
   using _NodeTypes = hash_node_types<_ConstNodePtr>;
   using node_pointer = _ConstNodePtr;
@@ -384,7 +793,7 @@ class hash_const_local_iterator {
 
   next_pointer node_;
   size_t bucket_;
-  size_t bucket_count_;
+  _Bucketer bucket_of_;
 
  public:
   using iterator_category = std::forward_iterator_tag;
@@ -396,8 +805,8 @@ class hash_const_local_iterator {
   hash_const_local_iterator() noexcept : node_(nullptr) {}
 
   explicit hash_const_local_iterator(next_pointer node_ptr, size_t bucket,
-                                     size_t bucket_count) noexcept
-      : node_(node_ptr), bucket_(bucket), bucket_count_(bucket_count) {
+                                     const _Bucketer& bucket_of)
+      : node_(node_ptr), bucket_(bucket), bucket_of_(bucket_of) {
     if (node_ != nullptr) {
       node_ = node_->next_;
     }
@@ -411,8 +820,7 @@ class hash_const_local_iterator {
 
   hash_const_local_iterator& operator++() {
     node_ = node_->next_;
-    if (node_ != nullptr &&
-        constrain_hash(node_->hash(), bucket_count_) != bucket_) {
+    if (node_ != nullptr && bucket_of_(node_) != bucket_) {
       node_ = nullptr;
     }
     return *this;
@@ -434,7 +842,7 @@ class hash_const_local_iterator {
     return !(x == y);
   }
 
-  template <class, class, class, class>
+  template <class, class, class, class, class, class>
   friend class hash_table;
 };
 
@@ -501,20 +909,23 @@ class hash_node_destructor {
 // ============================================================================
 // 主哈希表类
 // ============================================================================
-template <class _Tp, class _Hash, class _Equal, class _Alloc>
+template <class _Tp, class _Hash, class _Equal, class _Alloc, class _Policy,
+          class _Cache>
 class hash_table {
  public:
   using value_type = _Tp;
   using hasher = _Hash;
   using key_equal = _Equal;
   using allocator_type = _Alloc;
+  using bucket_policy = _Policy;
+  using hash_cache = _Cache;
 
  private:
   using alloc_traits = std::allocator_traits<allocator_type>;
   using void_pointer = typename alloc_traits::void_pointer;
 
   // 节点类型
-  using node = hash_node<_Tp, void_pointer>;
+  using node = hash_node<_Tp, void_pointer, typename _Cache::stored_type>;
   using node_pointer =
       typename std::pointer_traits<void_pointer>::template rebind<node>;
   using node_base_type = hash_node_base<node_pointer>;
@@ -542,17 +953,42 @@ class hash_table {
   using node_holder = std::unique_ptr<node, _Dp>;
 
   // 成员变量
+  // 节点分配器排在桶数组之前：桶数组的分配器由它转换得到，
+  // 有状态的分配器（如 node_pool_allocator）因此共用同一份状态
+  node_allocator node_alloc_;  // 节点分配器
   bucket_list bucket_list_;    //桶数组
+  bucket_policy bucket_policy_;  // 桶数策略：哈希值到桶下标的映射
   node_base_type first_node_;  // 第一个节点
-  node_allocator node_alloc_;  // 节点分配器
   size_t size_;                // 元素个数
   hasher hasher_;              // 哈希函数
   float max_load_factor_;      // 最大负载因子
   key_equal key_eq_;           // 键相等性比较
 
+  // 渐进式 rehash 状态（见 set_incremental_rehash）
+  bool incremental_rehash_ = false;
+  next_pointer* pending_buckets_ = nullptr;  // 准备阶段：正在逐段清零的新桶数组
+  size_t pending_bucket_count_ = 0;
+  next_pointer* old_buckets_ = nullptr;  // 迁移阶段：尚未迁移完的旧桶数组
+  size_t old_bucket_count_ = 0;
+  bucket_policy old_policy_;
+  size_t rehash_pos_ = 0;  // 准备阶段为已清零长度，迁移阶段为下一个旧桶
+
+#if TINYSTL_HASH_TABLE_COUNTERS
+  size_t rehash_count_ = 0;
+  size_t nodes_relinked_ = 0;
+  uint64_t rehash_nanoseconds_ = 0;
+#endif
+
+  // 不同实例化的表之间 merge 时需要摘取对方的节点
+  template <class, class, class, class, class, class>
+  friend class hash_table;
+
  public:
   size_t& size() noexcept { return size_; }
 
+  // 节点类型（供节点句柄使用）
+  using node_type = node;
+
   using size_type = typename alloc_traits::size_type;
   using difference_type = typename alloc_traits::difference_type;
   using reference = value_type&;
@@ -562,77 +998,96 @@ class hash_table {
 
   using iterator = hash_iterator<node_pointer>;
   using const_iterator = hash_const_iterator<node_pointer>;
-  using local_iterator = hash_local_iterator<node_pointer>;
-  using const_local_iterator = hash_const_local_iterator<node_pointer>;
+  using node_bucketer = hash_node_bucketer<bucket_policy, hasher, hash_cache>;
+  using local_iterator = hash_local_iterator<node_pointer, node_bucketer>;
+  using const_local_iterator =
+      hash_const_local_iterator<node_pointer, node_bucketer>;
 
   // 构造函数
-  hash_table() noexcept
-      : bucket_list_(nullptr, bucket_list_deleter()),
+  hash_table() noexcept(
+      std::is_nothrow_default_constructible<node_allocator>::value &&
+      std::is_nothrow_default_constructible<hasher>::value &&
+      std::is_nothrow_default_constructible<key_equal>::value)
+      : node_alloc_(),
+        bucket_list_(nullptr,
+                     bucket_list_deleter(pointer_allocator(node_alloc_), 0)),
         first_node_(),
-        node_alloc_(),
         size_(0),
         hasher_(),
         max_load_factor_(1.0f),
         key_eq_() {}
 
   hash_table(const hasher& hf, const key_equal& eql)
-      : bucket_list_(nullptr, bucket_list_deleter()),
+      : node_alloc_(),
+        bucket_list_(nullptr,
+                     bucket_list_deleter(pointer_allocator(node_alloc_), 0)),
         first_node_(),
-        node_alloc_(),
         size_(0),
         hasher_(hf),
         max_load_factor_(1.0f),
         key_eq_(eql) {}
 
   hash_table(const hasher& hf, const key_equal& eql, const allocator_type& a)
-      : bucket_list_(nullptr, bucket_list_deleter(pointer_allocator(a), 0)),
-        node_alloc_(a),
+      : node_alloc_(a),
+        bucket_list_(nullptr,
+                     bucket_list_deleter(pointer_allocator(node_alloc_), 0)),
         size_(0),
         hasher_(hf),
         max_load_factor_(1.0f),
         key_eq_(eql) {}
 
   explicit hash_table(const allocator_type& a)
-      : bucket_list_(nullptr, bucket_list_deleter(pointer_allocator(a), 0)),
-        node_alloc_(a),
+      : node_alloc_(a),
+        bucket_list_(nullptr,
+                     bucket_list_deleter(pointer_allocator(node_alloc_), 0)),
         size_(0),
         max_load_factor_(1.0f) {}
 
   // 拷贝构造
   hash_table(const hash_table& other)
-      : bucket_list_(nullptr,
-                     bucket_list_deleter(
-                         pointer_allocator(
-                             std::allocator_traits<pointer_allocator>::
-                                 select_on_container_copy_construction(
-                                     other.bucket_list_.get_deleter().alloc())),
-                         0)),
-        node_alloc_(
+      : node_alloc_(
             std::allocator_traits<node_allocator>::
                 select_on_container_copy_construction(other.node_alloc())),
+        bucket_list_(nullptr,
+                     bucket_list_deleter(pointer_allocator(node_alloc_), 0)),
         size_(0),
         hasher_(other.hash_function()),
         max_load_factor_(other.max_load_factor()),
         key_eq_(other.key_eq()) {
-    // 深拷贝：插入所有元素
-    for (const_iterator it = other.begin(); it != other.end(); ++it) {
-      insert_unique(*it);
-    }
+    copy_unique_from(other);
+    // 拷贝过程一次性扩容即可，之后再沿用对方的 rehash 模式
+    incremental_rehash_ = other.incremental_rehash_;
+  }
+
+  // 拷贝构造（指定分配器）
+  hash_table(const hash_table& other, const allocator_type& a)
+      : node_alloc_(a),
+        bucket_list_(nullptr,
+                     bucket_list_deleter(pointer_allocator(node_alloc_), 0)),
+        size_(0),
+        hasher_(other.hash_function()),
+        max_load_factor_(other.max_load_factor()),
+        key_eq_(other.key_eq()) {
+    copy_unique_from(other);
+    incremental_rehash_ = other.incremental_rehash_;
   }
 
   // 移动构造
   hash_table(hash_table&& other) noexcept
-      : bucket_list_(std::move(other.bucket_list_)),
+      : node_alloc_(std::move(other.node_alloc_)),
+        bucket_list_(std::move(other.bucket_list_)),
+        bucket_policy_(other.bucket_policy_),
         first_node_(std::move(other.first_node_)),
-        node_alloc_(std::move(other.node_alloc_)),
         size_(other.size_),
         hasher_(std::move(other.hasher_)),
         max_load_factor_(other.max_load_factor_),
         key_eq_(std::move(other.key_eq_)) {
+    take_rehash_state(other);
     if (size() > 0) {
-      bucket_list_[constrain_hash(first_node_.next_->hash(), bucket_count())] =
-          first_node_.ptr();
+      bucket_slot_of(first_node_.next_) = first_node_.ptr();
     }
+    other.bucket_list_.get_deleter().size() = 0;
+    other.bucket_policy_.reset(0);
     other.first_node_.next_ = nullptr;
     other.size_ = 0;
   }
@@ -654,10 +1109,8 @@ class hash_table {
         node_alloc() = other.node_alloc();
       }
 
-      // 插入所有元素
-      for (const_iterator it = other.begin(); it != other.end(); ++it) {
-        insert_unique(*it);
-      }
+      copy_unique_from(other);
+      incremental_rehash_ = other.incremental_rehash_;
     }
     return *this;
   }
@@ -668,6 +1121,7 @@ class hash_table {
       clear();
 
       bucket_list_ = std::move(other.bucket_list_);
+      bucket_policy_ = other.bucket_policy_;
       first_node_.next_ = other.first_node_.next_;
       size_ = other.size_;
       hasher_ = std::move(other.hasher_);
@@ -679,11 +1133,13 @@ class hash_table {
         node_alloc() = std::move(other.node_alloc());
       }
 
+      take_rehash_state(other);
       if (size() > 0) {
-        bucket_list_[constrain_hash(first_node_.next_->hash(),
-                                    bucket_count())] = first_node_.ptr();
+        bucket_slot_of(first_node_.next_) = first_node_.ptr();
       }
 
+      other.bucket_list_.get_deleter().size() = 0;
+      other.bucket_policy_.reset(0);
       other.first_node_.next_ = nullptr;
       other.size_ = 0;
     }
@@ -723,6 +1179,71 @@ class hash_table {
     return bc != 0 ? static_cast<float>(size()) / bc : 0.0f;
   }
 
+  // 统计信息：逐桶调用 bucket_size()，耗时 O(size() + bucket_count())。
+  // 渐进式 rehash 迁移期间只反映新桶数组，需要准确分布时先 finish_rehash()
+  hash_table_stats stats() const {
+    hash_table_stats s;
+    s.size = size();
+    s.bucket_count = bucket_count();
+    s.load_factor = load_factor();
+    s.max_load_factor = max_load_factor();
+
+    size_t probes = 0;  // 成功查找的探测总数：第 i 个节点需要比较 i 次
+    for (size_type b = 0; b < s.bucket_count; ++b) {
+      size_type len = bucket_size(b);
+      if (len >= s.chain_length_histogram.size()) {
+        s.chain_length_histogram.resize(len + 1);
+      }
+      ++s.chain_length_histogram[len];
+      probes += len * (len + 1) / 2;
+    }
+    if (s.bucket_count > 0) {
+      s.max_chain_length = s.chain_length_histogram.size() - 1;
+      s.empty_buckets = s.chain_length_histogram[0];
+      s.empty_bucket_ratio =
+          static_cast<double>(s.empty_buckets) / s.bucket_count;
+      s.avg_probes_unsuccessful =
+          static_cast<double>(s.size) / s.bucket_count;
+    }
+    if (s.size > 0) {
+      s.avg_probes_successful = static_cast<double>(probes) / s.size;
+    }
+
+    s.node_bytes = s.size * sizeof(node);
+    s.bucket_bytes =
+        (s.bucket_count + pending_bucket_count_ + old_bucket_count_) *
+        sizeof(next_pointer);
+
+#if TINYSTL_HASH_TABLE_COUNTERS
+    s.rehash_count = rehash_count_;
+    s.nodes_relinked = nodes_relinked_;
+    s.rehash_nanoseconds = rehash_nanoseconds_;
+#endif
+    return s;
+  }
+
+  // 内存占用：节点中 next_、缓存的 hash_ 与对齐填充计入 overhead，
+  // 桶数组（含渐进式 rehash 期间的新旧数组）也计入 overhead
+  memory_footprint memory_usage() const noexcept {
+    memory_footprint f;
+    size_type n = size();
+    f.payload_bytes = n * sizeof(value_type);
+    f.overhead_bytes = n * (sizeof(node) - sizeof(value_type));
+    f.rounding_bytes = n * allocation_rounding<node_allocator>::bytes(1);
+    f.allocations = n;
+
+    const size_type arrays[] = {bucket_count(), pending_bucket_count_,
+                                old_bucket_count_};
+    for (size_type count : arrays) {
+      if (count != 0) {
+        f.overhead_bytes += count * sizeof(next_pointer);
+        f.rounding_bytes += allocation_rounding<pointer_allocator>::bytes(count);
+        ++f.allocations;
+      }
+    }
+    return f;
+  }
+
   // 迭代器
   iterator begin() noexcept { return iterator(first_node_.next_); }
 
@@ -736,35 +1257,59 @@ class hash_table {
 
   // 桶迭代器
   local_iterator begin(size_type n) {
-    return local_iterator(bucket_list_[n], n, bucket_count());
+    return local_iterator(bucket_list_[n], n,
+                          node_bucketer(bucket_policy_, hash_function()));
   }
 
   local_iterator end(size_type n) {
-    return local_iterator(nullptr, n, bucket_count());
+    return local_iterator(nullptr, n,
+                          node_bucketer(bucket_policy_, hash_function()));
   }
 
   const_local_iterator cbegin(size_type n) const {
-    return const_local_iterator(bucket_list_[n], n, bucket_count());
+    return const_local_iterator(
+        bucket_list_[n], n, node_bucketer(bucket_policy_, hash_function()));
   }
 
   const_local_iterator cend(size_type n) const {
-    return const_local_iterator(nullptr, n, bucket_count());
+    return const_local_iterator(nullptr, n,
+                                node_bucketer(bucket_policy_, hash_function()));
   }
 
   // 查找
   template <class _Key>
   iterator find(const _Key& k) {
-    size_t hash = hash_function()(k);
+    return find_hash(hash_function()(k), k);
+  }
+
+  template <class _Key>
+  const_iterator find(const _Key& k) const {
+    return find_hash(hash_function()(k), k);
+  }
+
+  // 哈希值已知的查找（调用方已为其他用途算过哈希值时避免重复计算）。
+  // hash 为哈希函数的原始结果，按缓存策略规约后使用
+  template <class _Key>
+  iterator find_hash(size_t hash, const _Key& k) {
+    hash = hash_cache::reduce(hash);
+    if (rehash_in_progress()) {
+      advance_rehash();
+      if (old_buckets_ != nullptr) {
+        return iterator(find_in_migration(k, hash));
+      }
+    }
     size_type bc = bucket_count();
     if (bc != 0) {
-      size_t chash = constrain_hash(hash, bc);
+      size_t chash = bucket_policy_.constrain(hash);
       next_pointer nd = bucket_list_[chash];
       if (nd != nullptr) {
         for (nd = nd->next_;
              nd != nullptr &&
-             (nd->hash() == hash || constrain_hash(nd->hash(), bc) == chash);
+             (node_hash(nd) == hash ||
+              bucket_policy_.constrain(node_hash(nd)) == chash);
              nd = nd->next_) {
-          if (nd->hash() == hash && key_eq()(nd->upcast()->get_value(), k)) {
+          if (node_hash(nd) == hash &&
+              key_eq()(nd->upcast()->get_value(), k)) {
             return iterator(nd);
           }
         }
@@ -774,18 +1319,23 @@ class hash_table {
   }
 
   template <class _Key>
-  const_iterator find(const _Key& k) const {
-    size_t hash = hash_function()(k);
+  const_iterator find_hash(size_t hash, const _Key& k) const {
+    hash = hash_cache::reduce(hash);
+    if (old_buckets_ != nullptr) {
+      return const_iterator(find_in_migration(k, hash));
+    }
     size_type bc = bucket_count();
     if (bc != 0) {
-      size_t chash = constrain_hash(hash, bc);
+      size_t chash = bucket_policy_.constrain(hash);
       next_pointer nd = bucket_list_[chash];
       if (nd != nullptr) {
         for (nd = nd->next_;
              nd != nullptr &&
-             (hash == nd->hash() || constrain_hash(nd->hash(), bc) == chash);
+             (hash == node_hash(nd) ||
+              bucket_policy_.constrain(node_hash(nd)) == chash);
              nd = nd->next_) {
-          if (nd->hash() == hash && key_eq()(nd->upcast()->get_value(), k)) {
+          if (node_hash(nd) == hash &&
+              key_eq()(nd->upcast()->get_value(), k)) {
             return const_iterator(nd);
           }
         }
@@ -794,12 +1344,30 @@ class hash_table {
     return end();
   }
 
+  // 批量查找：结果写入 out[0, n)，未找到为 end()。_Out 需可由 iterator 构造。
+  // 键按 find_batch_group 个一组分阶段处理：先全部求哈希并预取桶槽，
+  // 再预取前驱节点、首节点，最后才逐个比较。组内各次查找互不依赖，
+  // 这样多次缓存未命中可以重叠，而不是像逐个 find 那样串行等待。
+  template <class _Key, class _Out>
+  void find_batch(const _Key* keys, size_type n, _Out* out) {
+    find_batch_impl(keys, n, [out](size_type i, next_pointer nd) {
+      out[i] = _Out(iterator(nd));
+    });
+  }
+
+  template <class _Key, class _Out>
+  void find_batch(const _Key* keys, size_type n, _Out* out) const {
+    find_batch_impl(keys, n, [out](size_type i, next_pointer nd) {
+      out[i] = _Out(const_iterator(nd));
+    });
+  }
+
   template <class _Key>
   size_type bucket(const _Key& k) const {
     size_type bc = bucket_count();
     if (bc == 0)
       return 0;
-    return constrain_hash(hash_function()(k), bc);
+    return bucket_policy_.constrain(hash_of(k));
   }
 
   size_type bucket_size(size_type n) const {
@@ -809,7 +1377,8 @@ class hash_table {
     next_pointer np = bucket_list_[n];
     size_type r = 0;
     if (np != nullptr) {
-      for (np = np->next_; np != nullptr && constrain_hash(np->hash(), bc) == n;
+      for (np = np->next_;
+           np != nullptr && bucket_policy_.constrain(node_hash(np)) == n;
            np = np->next_, ++r)
         ;
     }
@@ -822,6 +1391,61 @@ class hash_table {
     return static_cast<size_type>(find(k) != end());
   }
 
+  // 并行清空（见 parallel_policy）：各线程释放自己桶区间内的节点，分三个
+  // 阶段，之间以线程汇合分隔：
+  //   1. 桶改存链段首节点（原为前驱，前驱属于别的链段，阶段 2 会被释放）；
+  //   2. 释放每个链段除首节点外的节点。判断链段结束时读到的下一个节点
+  //      一定是别的链段的首节点，这一阶段不会被释放；
+  //   3. 释放首节点并清空桶。
+  // 节点分配器不能并发释放（见 hash_concurrent_deallocate）或渐进式 rehash
+  // 进行中时退回串行 clear
+  void clear(parallel_policy policy) noexcept {
+    size_type workers = parallel_workers(policy);
+    if (!hash_concurrent_deallocate<node_allocator>::value || workers <= 1 ||
+        rehash_in_progress()) {
+      clear();
+      return;
+    }
+    next_pointer* bl = bucket_list_.get();
+    const size_type bc = bucket_count();
+    auto first_nodes = [&](size_type w) {
+      std::pair<size_type, size_type> r = parallel_range(bc, workers, w);
+      for (size_type b = r.first; b < r.second; ++b) {
+        if (bl[b] != nullptr) {
+          bl[b] = bl[b]->next_;
+        }
+      }
+    };
+    auto release_tails = [&](size_type w) {
+      std::pair<size_type, size_type> r = parallel_range(bc, workers, w);
+      for (size_type b = r.first; b < r.second; ++b) {
+        if (bl[b] == nullptr) {
+          continue;
+        }
+        next_pointer cn = bl[b]->next_;
+        while (cn != nullptr && bucket_policy_.constrain(node_hash(cn)) == b) {
+          next_pointer next = cn->next_;
+          deallocate_one(cn);
+          cn = next;
+        }
+      }
+    };
+    auto release_heads = [&](size_type w) {
+      std::pair<size_type, size_type> r = parallel_range(bc, workers, w);
+      for (size_type b = r.first; b < r.second; ++b) {
+        if (bl[b] != nullptr) {
+          deallocate_one(bl[b]);
+          bl[b] = nullptr;
+        }
+      }
+    };
+    hash_parallel_for(workers, first_nodes);
+    hash_parallel_for(workers, release_tails);
+    hash_parallel_for(workers, release_heads);
+    first_node_.next_ = nullptr;
+    size() = 0;
+  }
+
   // 清空
   void clear() noexcept {
     if (size() > 0) {
@@ -833,6 +1457,8 @@ class hash_table {
       }
       size() = 0;
     }
+    // 表已清空，未完成的渐进式 rehash 没有继续的必要
+    cancel_rehash();
   }
 
   // 删除
@@ -855,7 +1481,12 @@ class hash_table {
 
   template <class _Key>
   size_type erase_unique(const _Key& k) {
-    iterator i = find(k);
+    return erase_unique_hash(hash_function()(k), k);
+  }
+
+  template <class _Key>
+  size_type erase_unique_hash(size_t hash, const _Key& k) {
+    iterator i = find_hash(hash, k);
     if (i == end()) {
       return 0;
     }
@@ -865,44 +1496,480 @@ class hash_table {
 
   // 交换
   void swap(hash_table& u) noexcept {
-    using std::swap;
-    bucket_list_.swap(u.bucket_list_);
-    swap(first_node_.next_, u.first_node_.next_);
-    swap(node_alloc_, u.node_alloc_);
-    swap(size_, u.size_);
-    swap(hasher_, u.hasher_);
-    swap(max_load_factor_, u.max_load_factor_);
-    swap(key_eq_, u.key_eq_);
+    // 写明 std::swap：成员类型在 mystl 中，ADL 会同时找到 mystl::swap。
+    // unique_ptr::swap 内部同样用非限定的 swap 交换指针，这里手动交换
+    next_pointer* buckets = bucket_list_.release();
+    bucket_list_.reset(u.bucket_list_.release());
+    u.bucket_list_.reset(buckets);
+    std::swap(bucket_list_.get_deleter(), u.bucket_list_.get_deleter());
+    std::swap(first_node_.next_, u.first_node_.next_);
+    std::swap(node_alloc_, u.node_alloc_);
+    std::swap(size_, u.size_);
+    std::swap(hasher_, u.hasher_);
+    std::swap(max_load_factor_, u.max_load_factor_);
+    std::swap(key_eq_, u.key_eq_);
+    std::swap(bucket_policy_, u.bucket_policy_);
+    std::swap(incremental_rehash_, u.incremental_rehash_);
+    std::swap(pending_buckets_, u.pending_buckets_);
+    std::swap(pending_bucket_count_, u.pending_bucket_count_);
+    std::swap(old_buckets_, u.old_buckets_);
+    std::swap(old_bucket_count_, u.old_bucket_count_);
+    std::swap(old_policy_, u.old_policy_);
+    std::swap(rehash_pos_, u.rehash_pos_);
 
     // 更新桶索引
     if (size() > 0) {
-      bucket_list_[constrain_hash(first_node_.next_->hash(), bucket_count())] =
-          first_node_.ptr();
+      bucket_slot_of(first_node_.next_) = first_node_.ptr();
     }
     if (u.size() > 0) {
-      u.bucket_list_[constrain_hash(u.first_node_.next_->hash(),
-                                    u.bucket_count())] = u.first_node_.ptr();
+      u.bucket_slot_of(u.first_node_.next_) = u.first_node_.ptr();
+    }
+  }
+
+  // -------------------------- 节点句柄：extract / insert / merge --------------------------
+  // 摘下节点交给句柄，节点内存与元素保持不动
+  template <class _NodeHandle>
+  _NodeHandle node_handle_extract(const_iterator p) {
+    typename _NodeHandle::allocator_type alloc(node_alloc());
+    return _NodeHandle(remove(p).release(), alloc);
+  }
+
+  template <class _NodeHandle, class _Key>
+  _NodeHandle node_handle_extract_unique(const _Key& k) {
+    iterator i = find(k);
+    if (i == end()) {
+      return _NodeHandle();
+    }
+    return node_handle_extract<_NodeHandle>(i);
+  }
+
+  // 插入句柄持有的节点。句柄中的键可能已被修改，也可能来自哈希函数不同的表，
+  // 因此哈希值总是重新计算；键已存在时节点留在返回值的 node 中
+  template <class _NodeHandle, class _InsertReturnType>
+  _InsertReturnType node_handle_insert_unique(_NodeHandle&& nh) {
+    if (nh.empty()) {
+      return _InsertReturnType{end(), false, _NodeHandle()};
+    }
+    node_pointer src = nh.ptr_;
+    size_t hash = hash_of(src->get_value());
+    next_pointer existing = node_insert_unique_prepare(hash, src->get_value());
+    if (existing != nullptr) {
+      return _InsertReturnType{iterator(existing), false, std::move(nh)};
+    }
+    bool same_alloc = node_alloc() == node_allocator(nh.get_allocator());
+    node_pointer nd = adopt_node(src, same_alloc);
+    nd->set_hash(hash);
+    node_insert_unique_perform(nd, hash);
+    if (same_alloc) {
+      nh.release_node();
+    } else {
+      nh.destroy_node();
+    }
+    return _InsertReturnType{iterator(nd->ptr()), true, _NodeHandle()};
+  }
+
+  // 把 source 中本表没有的键逐个摘下并挂到本表。reuse_hash 为 true 时
+  // 两表的哈希函数必然给出相同结果（同一无状态类型），直接沿用节点缓存的哈希值
+  // （两表节点类型相同，缓存策略也相同）
+  template <class _Table>
+  void node_handle_merge_unique(_Table& source, bool reuse_hash) {
+    bool same_alloc = node_alloc() == source.node_alloc();
+    for (typename _Table::iterator it = source.begin(); it != source.end();) {
+      typename _Table::iterator cur = it++;
+      node_pointer src = cur.node_->upcast();
+      size_t hash = reuse_hash ? source.node_hash(cur.node_)
+                               : hash_of(src->get_value());
+      if (node_insert_unique_prepare(hash, src->get_value()) != nullptr) {
+        continue;
+      }
+      // 先接管再从 source 摘下：分配失败时 source 保持不变
+      node_pointer nd = adopt_node(src, same_alloc);
+      typename _Table::node_holder h = source.remove(cur);
+      if (same_alloc) {
+        h.release();
+      }
+      nd->set_hash(hash);
+      node_insert_unique_perform(nd, hash);
     }
   }
 
  private:
+  // 接管外部节点：分配器相等时直接复用节点，否则在本表分配新节点并移入元素
+  // （来源节点由调用方摘下并释放，哈希值由调用方写入）
+  node_pointer adopt_node(node_pointer src, bool same_alloc) {
+    if (same_alloc) {
+      return src;
+    }
+    return construct_node_hash(0, std::move(src->get_value())).release();
+  }
+
+  // 表内使用的哈希值：哈希函数的结果按缓存策略规约
+  template <class _Key>
+  size_t hash_of(const _Key& k) const {
+    return hash_cache::reduce(hash_function()(k));
+  }
+
+  // 节点的哈希值：读取缓存，不保存时重新计算
+  size_t node_hash(next_pointer np) const {
+    if constexpr (std::is_void<typename hash_cache::stored_type>::value) {
+      return hash_of(np->upcast()->get_value());
+    } else {
+      return np->upcast()->cached_hash();
+    }
+  }
+
+  // 批量查找每组的键数：越大可重叠的未命中越多，但栈上暂存也越大
+  static constexpr size_type find_batch_group = 16;
+
+  template <class _Key, class _Fn>
+  void find_batch_impl(const _Key* keys, size_type n, _Fn&& emit) const {
+    if (bucket_count() == 0) {
+      for (size_type i = 0; i < n; ++i) {
+        emit(i, nullptr);
+      }
+      return;
+    }
+    // 迁移期间一个键可能在新旧两个桶数组之一，逐个查找
+    if (old_buckets_ != nullptr) {
+      for (size_type i = 0; i < n; ++i) {
+        emit(i, find_in_migration(keys[i], hash_of(keys[i])));
+      }
+      return;
+    }
+
+    size_t hashes[find_batch_group];
+    size_t chashes[find_batch_group];
+    next_pointer nodes[find_batch_group];
+    for (size_type base = 0; base < n; base += find_batch_group) {
+      const _Key* group = keys + base;
+      size_type m = std::min<size_type>(find_batch_group, n - base);
+
+      // 阶段 1：求哈希，预取桶槽
+      for (size_type i = 0; i < m; ++i) {
+        hashes[i] = hash_of(group[i]);
+        chashes[i] = bucket_policy_.constrain(hashes[i]);
+        hash_prefetch(std::addressof(bucket_list_[chashes[i]]));
+      }
+      // 阶段 2：读取桶槽中的前驱节点并预取
+      for (size_type i = 0; i < m; ++i) {
+        nodes[i] = bucket_list_[chashes[i]];
+        if (nodes[i] != nullptr) {
+          hash_prefetch(std::addressof(*nodes[i]));
+        }
+      }
+      // 阶段 3：取得桶内首节点并预取（哈希值与键都在节点中）
+      for (size_type i = 0; i < m; ++i) {
+        if (nodes[i] != nullptr) {
+          nodes[i] = nodes[i]->next_;
+          if (nodes[i] != nullptr) {
+            hash_prefetch(std::addressof(*nodes[i]));
+          }
+        }
+      }
+      // 阶段 4：与 find 相同的链表比较
+      for (size_type i = 0; i < m; ++i) {
+        size_t hash = hashes[i];
+        size_t chash = chashes[i];
+        next_pointer found = nullptr;
+        for (next_pointer nd = nodes[i];
+             nd != nullptr &&
+             (node_hash(nd) == hash ||
+              bucket_policy_.constrain(node_hash(nd)) == chash);
+             nd = nd->next_) {
+          if (node_hash(nd) == hash &&
+              key_eq()(nd->upcast()->get_value(), group[i])) {
+            found = nd;
+            break;
+          }
+        }
+        emit(base + i, found);
+      }
+    }
+  }
+
+  // -------------------------- 渐进式 rehash 实现 --------------------------
+  // 迁移期间的不变式：新桶数组中的节点，其旧桶一定已经为空。
+  // 因此“旧桶非空”当且仅当节点（或待查找的键）仍在旧桶数组中，
+  // 旧桶链段的边界也可以只用旧策略判断。
+
+  // 每次操作推进的工作量：准备阶段清零的桶数、迁移阶段处理的旧桶数
+  static constexpr size_type rehash_clear_step = 4096;
+  static constexpr size_type rehash_migrate_step = 8;
+
+  // 迁移 B 个旧桶约需 B / step 次插入，而新数组的负载因子约在
+  // B * max_load_factor() 次插入后再次超限，故步长至少取 1 / max_load_factor()
+  size_type migrate_step() const noexcept {
+    return std::max<size_type>(
+        rehash_migrate_step,
+        static_cast<size_type>(std::ceil(1.0f / max_load_factor())));
+  }
+
+  // 插入使负载因子超限时扩容
+  void grow_for_insert(size_type bc) {
+    size_type n = std::max<size_type>(
+        bucket_policy::grow_bucket_count(bc),
+        static_cast<size_type>(
+            std::ceil(static_cast<float>(size() + 1) / max_load_factor())));
+    if (!incremental_rehash_ || bc == 0) {
+      rehash_unique(n);
+    } else if (!rehash_in_progress()) {
+      size_type nbc = bucket_policy::round_bucket_count(n);
+      pointer_allocator& npa = bucket_list_.get_deleter().alloc();
+      pending_buckets_ = pointer_alloc_traits::allocate(npa, nbc);
+      pending_bucket_count_ = nbc;
+      rehash_pos_ = 0;
+#if TINYSTL_HASH_TABLE_COUNTERS
+      ++rehash_count_;
+#endif
+    }
+  }
+
+  void advance_rehash() noexcept {
+    if (pending_buckets_ != nullptr) {
+      size_type last = std::min(pending_bucket_count_,
+                                rehash_pos_ + rehash_clear_step);
+      for (; rehash_pos_ < last; ++rehash_pos_) {
+        pending_buckets_[rehash_pos_] = nullptr;
+      }
+      if (rehash_pos_ == pending_bucket_count_) {
+        // 新桶数组清零完毕：换上新数组，旧数组转入迁移阶段
+        old_bucket_count_ = bucket_count();
+        old_buckets_ = bucket_list_.release();
+        old_policy_ = bucket_policy_;
+        bucket_list_.reset(pending_buckets_);
+        bucket_list_.get_deleter().size() = pending_bucket_count_;
+        bucket_policy_.reset(pending_bucket_count_);
+        pending_buckets_ = nullptr;
+        pending_bucket_count_ = 0;
+        rehash_pos_ = 0;
+      }
+      return;
+    }
+    if (old_buckets_ != nullptr) {
+      size_type last =
+          std::min(old_bucket_count_, rehash_pos_ + migrate_step());
+      for (; rehash_pos_ < last; ++rehash_pos_) {
+        migrate_old_bucket(rehash_pos_);
+      }
+      if (rehash_pos_ == old_bucket_count_) {
+        pointer_alloc_traits::deallocate(bucket_list_.get_deleter().alloc(),
+                                         old_buckets_, old_bucket_count_);
+        old_buckets_ = nullptr;
+        old_bucket_count_ = 0;
+        rehash_pos_ = 0;
+      }
+    }
+  }
+
+  // 放弃进行中的 rehash（仅在表为空时调用）
+  void cancel_rehash() noexcept {
+    pointer_allocator& npa = bucket_list_.get_deleter().alloc();
+    if (pending_buckets_ != nullptr) {
+      pointer_alloc_traits::deallocate(npa, pending_buckets_,
+                                       pending_bucket_count_);
+      pending_buckets_ = nullptr;
+      pending_bucket_count_ = 0;
+    }
+    if (old_buckets_ != nullptr) {
+      pointer_alloc_traits::deallocate(npa, old_buckets_, old_bucket_count_);
+      old_buckets_ = nullptr;
+      old_bucket_count_ = 0;
+    }
+    rehash_pos_ = 0;
+  }
+
+  // 移动构造/赋值时接管对方的 rehash 状态
+  void take_rehash_state(hash_table& other) noexcept {
+    incremental_rehash_ = other.incremental_rehash_;
+    pending_buckets_ = other.pending_buckets_;
+    pending_bucket_count_ = other.pending_bucket_count_;
+    old_buckets_ = other.old_buckets_;
+    old_bucket_count_ = other.old_bucket_count_;
+    old_policy_ = other.old_policy_;
+    rehash_pos_ = other.rehash_pos_;
+    other.pending_buckets_ = nullptr;
+    other.pending_bucket_count_ = 0;
+    other.old_buckets_ = nullptr;
+    other.old_bucket_count_ = 0;
+    other.rehash_pos_ = 0;
+  }
+
+  // 节点 nd 所在链段对应的桶（保存链段的前驱节点）
+  next_pointer& bucket_slot_of(next_pointer nd) noexcept {
+    if (old_buckets_ != nullptr) {
+      size_t oc = old_policy_.constrain(node_hash(nd));
+      if (old_buckets_[oc] != nullptr) {
+        return old_buckets_[oc];
+      }
+    }
+    return bucket_list_[bucket_policy_.constrain(node_hash(nd))];
+  }
+
+  // 迁移期间查找：旧桶非空则键只可能在旧桶，否则在新桶
+  template <class _Key>
+  next_pointer find_in_migration(const _Key& k, size_t hash) const {
+    const bucket_policy* policy = &old_policy_;
+    size_t chash = old_policy_.constrain(hash);
+    next_pointer nd = old_buckets_[chash];
+    if (nd == nullptr) {
+      policy = &bucket_policy_;
+      chash = bucket_policy_.constrain(hash);
+      nd = bucket_list_[chash];
+    }
+    if (nd != nullptr) {
+      // 新桶链段之后可能紧跟旧桶链段，多比较几个节点不影响正确性
+      for (nd = nd->next_;
+           nd != nullptr &&
+           (node_hash(nd) == hash || policy->constrain(node_hash(nd)) == chash);
+           nd = nd->next_) {
+        if (node_hash(nd) == hash && key_eq()(nd->upcast()->get_value(), k)) {
+          return nd;
+        }
+      }
+    }
+    return nullptr;
+  }
+
+  // 把 nd 挂到新桶数组：桶为空时放到链表头部，并修正原头部链段的桶
+  void link_new_bucket(next_pointer nd) noexcept {
+    size_t chash = bucket_policy_.constrain(node_hash(nd));
+    next_pointer pn = bucket_list_[chash];
+    if (pn == nullptr) {
+      pn = first_node_.ptr();
+      nd->next_ = pn->next_;
+      pn->next_ = nd;
+      bucket_list_[chash] = pn;
+      if (nd->next_ != nullptr) {
+        bucket_slot_of(nd->next_) = nd;
+      }
+    } else {
+      nd->next_ = pn->next_;
+      pn->next_ = nd;
+    }
+  }
+
+  // 迁移期间插入新节点：旧桶尚未迁移则直接放进旧桶链段，保持不变式
+  void link_in_migration(next_pointer nd) noexcept {
+    next_pointer pn = old_buckets_[old_policy_.constrain(node_hash(nd))];
+    if (pn != nullptr) {
+      nd->next_ = pn->next_;
+      pn->next_ = nd;
+    } else {
+      link_new_bucket(nd);
+    }
+  }
+
+  // 迁移期间摘除节点，逻辑同 remove，但链段归属要区分新旧数组
+  void unlink_in_migration(next_pointer cn) noexcept {
+    size_t oc = old_policy_.constrain(node_hash(cn));
+    bool in_old = old_buckets_[oc] != nullptr;
+    size_t chash = in_old ? oc : bucket_policy_.constrain(node_hash(cn));
+    next_pointer* buckets = in_old ? old_buckets_ : bucket_list_.get();
+    auto same_bucket = [&](next_pointer np) {
+      size_t o = old_policy_.constrain(node_hash(np));
+      if (in_old) {
+        return o == chash;
+      }
+      return old_buckets_[o] == nullptr &&
+             bucket_policy_.constrain(node_hash(np)) == chash;
+    };
+
+    next_pointer pn = buckets[chash];
+    for (; pn->next_ != cn; pn = pn->next_)
+      ;
+
+    if (pn == first_node_.ptr() || !same_bucket(pn)) {
+      if (cn->next_ == nullptr || !same_bucket(cn->next_)) {
+        buckets[chash] = nullptr;
+      }
+    }
+    if (cn->next_ != nullptr && !same_bucket(cn->next_)) {
+      bucket_slot_of(cn->next_) = pn;
+    }
+
+    pn->next_ = cn->next_;
+    cn->next_ = nullptr;
+    --size();
+  }
+
+  // 迁移旧桶 b：整段摘下后逐个挂到新桶数组
+  void migrate_old_bucket(size_type b) noexcept {
+    next_pointer pn = old_buckets_[b];
+    if (pn == nullptr) {
+      return;
+    }
+    next_pointer first = pn->next_;
+    next_pointer last = first;
+    while (last->next_ != nullptr &&
+           old_policy_.constrain(node_hash(last->next_)) == b) {
+      last = last->next_;
+    }
+    next_pointer after = last->next_;
+    pn->next_ = after;
+    last->next_ = nullptr;
+    if (after != nullptr) {
+      bucket_slot_of(after) = pn;
+    }
+    old_buckets_[b] = nullptr;
+
+    while (first != nullptr) {
+      next_pointer next = first->next_;
+#if TINYSTL_HASH_TABLE_COUNTERS
+      ++nodes_relinked_;
+#endif
+      link_new_bucket(first);
+      first = next;
+    }
+  }
+
   // 删除节点
   void deallocate_node(next_pointer np) noexcept {
-    node_allocator& na = node_alloc();
     while (np != nullptr) {
       next_pointer next = np->next_;
-      node_pointer real_np = np->upcast();
-      node_traits::destroy(na, &real_np->get_value());
-      node_traits::deallocate(na, real_np, 1);
+      deallocate_one(np);
       np = next;
     }
   }
 
+  // 删除单个节点
+  void deallocate_one(next_pointer np) noexcept {
+    node_allocator& na = node_alloc();
+    node_pointer real_np = np->upcast();
+    node_traits::destroy(na, &real_np->get_value());
+    node_traits::deallocate(na, real_np, 1);
+  }
+
+  // -------------------------- 并行 rehash / clear 的辅助函数 --------------------------
+  // 每个线程至少分到的节点数，太少时启动线程的开销超过收益
+  static constexpr size_type parallel_min_nodes = size_type(1) << 14;
+
+  // 实际使用的线程数：工作按桶区间划分，线程数也不超过桶数
+  size_type parallel_workers(parallel_policy policy) const noexcept {
+    size_type threads = policy.threads;
+    if (threads == 0) {
+      threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    return std::min({threads, size() / parallel_min_nodes, bucket_count(),
+                     static_cast<size_type>(hash_parallel_max_threads)});
+  }
+
+  // 把 n 个桶均分给 workers 个线程，返回 w 号线程负责的 [first, second)。
+  // 下标为 i 的桶属于 i / ceil(n / workers) 号线程
+  static std::pair<size_type, size_type> parallel_range(
+      size_type n, size_type workers, size_type w) noexcept {
+    size_type per = (n + workers - 1) / workers;
+    size_type first = std::min(n, w * per);
+    return std::pair<size_type, size_type>(first, std::min(n, first + per));
+  }
+
   // 移除节点（返回节点句柄）
   node_holder remove(const_iterator p) noexcept {
     next_pointer cn = p.node_;
-    size_type bc = bucket_count();
-    size_t chash = constrain_hash(cn->hash(), bc);
+    if (old_buckets_ != nullptr) {
+      unlink_in_migration(cn);
+      return node_holder(cn->upcast(), _Dp(node_alloc(), true));
+    }
+    size_t chash = bucket_policy_.constrain(node_hash(cn));
 
     // 查找前驱节点
     next_pointer pn = bucket_list_[chash];
@@ -910,15 +1977,16 @@ class hash_table {
       ;
 
     // 更新桶索引
-    if (pn == first_node_.ptr() || constrain_hash(pn->hash(), bc) != chash) {
+    if (pn == first_node_.ptr() ||
+        bucket_policy_.constrain(node_hash(pn)) != chash) {
       if (cn->next_ == nullptr ||
-          constrain_hash(cn->next_->hash(), bc) != chash) {
+          bucket_policy_.constrain(node_hash(cn->next_)) != chash) {
         bucket_list_[chash] = nullptr;
       }
     }
 
     if (cn->next_ != nullptr) {
-      size_t nhash = constrain_hash(cn->next_->hash(), bc);
+      size_t nhash = bucket_policy_.constrain(node_hash(cn->next_));
       if (nhash != chash) {
         bucket_list_[nhash] = pn;
       }
@@ -945,9 +2013,7 @@ class hash_table {
     node_traits::construct(na, &h->get_value(), std::forward<Args>(args)...);
     h.get_deleter().value_constructed = true;
 
-    // 计算并缓存哈希值
-    h->hash_ = hash_function()(h->get_value());
-
+    // 哈希值由 node_insert_unique 计算并写入
     return h;
   }
 
@@ -964,23 +2030,57 @@ class hash_table {
     return h;
   }
 
+  // 深拷贝 other 的全部节点：按对方的桶数一次分配桶数组；对方的键互不相同，
+  // 直接沿用保存的哈希值挂链，不再计算哈希或比较键
+  void copy_unique_from(const hash_table& other) {
+    if (other.size() == 0) {
+      return;
+    }
+    rehash_unique(other.bucket_count());
+    try {
+      for (next_pointer np = other.first_node_.next_; np != nullptr;
+           np = np->next_) {
+        const value_type& v = np->upcast()->get_value();
+        node_holder h = construct_node_hash(other.node_hash(np), v);
+        link_new_bucket(h.get()->ptr());
+        h.release();
+        ++size();
+      }
+    } catch (...) {
+      clear();
+      throw;
+    }
+  }
+
   // 插入准备（unique keys）
   next_pointer node_insert_unique_prepare(size_t hash, value_type& value) {
+    if (rehash_in_progress()) {
+      advance_rehash();
+      // 迁移期间不检查负载因子；若本次插入会使新数组超限（例如迁移中
+      // 调小了 max_load_factor），先完成迁移，再按常规路径扩容
+      if (old_buckets_ != nullptr) {
+        if (size() + 1 <= bucket_count() * max_load_factor()) {
+          return find_in_migration(value, hash);
+        }
+        finish_rehash();
+      }
+    }
     size_type bc = bucket_count();
 
     if (bc != 0) {
-      size_t chash = constrain_hash(hash, bc);
+      size_t chash = bucket_policy_.constrain(hash);
       next_pointer ndptr = bucket_list_[chash];
 
       // ndptr != nullptr：链表走完了
-      // ndptr->hash() == hash：完整哈希等于hash，无需再执行constrain_hash，已经能确定ndptr是当前桶
-      // constrain_hash(ndptr->hash(), bc) == chash ： 是我们要找的桶
+      // node_hash(ndptr) == hash：完整哈希等于hash，无需再执行constrain，已经能确定ndptr是当前桶
+      // constrain(node_hash(ndptr)) == chash ： 是我们要找的桶
       if (ndptr != nullptr) {
         for (ndptr = ndptr->next_;
-             ndptr != nullptr && (ndptr->hash() == hash ||
-                                  constrain_hash(ndptr->hash(), bc) == chash);
+             ndptr != nullptr &&
+             (node_hash(ndptr) == hash ||
+              bucket_policy_.constrain(node_hash(ndptr)) == chash);
              ndptr = ndptr->next_) {
-          if (ndptr->hash() == hash &&
+          if (node_hash(ndptr) == hash &&
               key_eq()(ndptr->upcast()->get_value(), value)) {
             // 哈希比较 + 等价比较
             return ndptr;
@@ -991,19 +2091,20 @@ class hash_table {
 
     // 检查是否需要扩容
     if (size() + 1 > bc * max_load_factor() || bc == 0) {
-      rehash_unique(std::max<size_type>(
-          2 * bc + !is_hash_power2(bc),
-          static_cast<size_type>(
-              std::ceil(static_cast<float>(size() + 1) / max_load_factor()))));
+      grow_for_insert(bc);
     }
 
     return nullptr;
   }
 
   // 执行插入（unique keys）
-  void node_insert_unique_perform(node_pointer nd) noexcept {
-    size_type bc = bucket_count();
-    size_t chash = constrain_hash(nd->hash_, bc);
+  void node_insert_unique_perform(node_pointer nd, size_t hash) noexcept {
+    if (old_buckets_ != nullptr) {
+      link_in_migration(nd->ptr());
+      ++size();
+      return;
+    }
+    size_t chash = bucket_policy_.constrain(hash);
 
     next_pointer pn = bucket_list_[chash];
     if (pn == nullptr) {
@@ -1012,7 +2113,8 @@ class hash_table {
       pn->next_ = nd->ptr();     // 哨兵节点的下一个指向新节点
       bucket_list_[chash] = pn;  // 将桶的头部指向哨兵节点
       if (nd->next_ != nullptr) {
-        bucket_list_[constrain_hash(nd->next_->hash(), bc)] = nd->ptr();
+        bucket_list_[bucket_policy_.constrain(node_hash(nd->next_))] =
+            nd->ptr();
       }
     } else {
       nd->next_ = pn->next_;
@@ -1023,14 +2125,15 @@ class hash_table {
 
   // 节点插入（unique keys）
   std::pair<iterator, bool> node_insert_unique(node_pointer nd) {
-    nd->hash_ = hash_function()(nd->get_value());
+    size_t hash = hash_of(nd->get_value());
+    nd->set_hash(hash);
     next_pointer existing_node =
-        node_insert_unique_prepare(nd->hash_, nd->get_value());
+        node_insert_unique_prepare(hash, nd->get_value());
 
     bool inserted = false;
     // 没找到相同键的节点，执行插入
     if (existing_node == nullptr) {
-      node_insert_unique_perform(nd);
+      node_insert_unique_perform(nd, hash);
       existing_node = nd->ptr();
       inserted = true;
     }
@@ -1039,23 +2142,34 @@ class hash_table {
 
  public:
   // Rehash（需要 public，因为 unordered_map 需要访问）
-  void rehash_unique(size_type n) {
-    if (n == 1) {
-      n = 2;
-    } else if (!is_hash_power2(n)) {
-      n = next_prime(n);
-    }
+  void rehash_unique(size_type n) { rehash_unique(n, parallel_policy(1)); }
+
+  // 并行 rehash（见 parallel_policy）：哈希函数须可被多个线程同时调用
+  void rehash_unique(size_type n, parallel_policy policy) {
+    // 显式 rehash 总是一次完成，先结束进行中的渐进式 rehash
+    finish_rehash();
+    n = bucket_policy::round_bucket_count(n);
 
     size_type bc = bucket_count();
     if (n > bc ||
         (n < bc && n >= static_cast<size_type>(std::ceil(
                             static_cast<float>(size()) / max_load_factor())))) {
-      do_rehash_unique(n);
+      size_type workers = parallel_workers(policy);
+      if (workers > 1) {
+        do_rehash_unique_parallel(n, workers);
+      } else {
+        do_rehash_unique(n);
+      }
     }
   }
 
   // do_rehash_unique：重新映射桶数组
   void do_rehash_unique(size_type nbc) {
+#if TINYSTL_HASH_TABLE_COUNTERS
+    auto rehash_start = std::chrono::steady_clock::now();
+    ++rehash_count_;
+    nodes_relinked_ += size();
+#endif
     pointer_allocator& npa = bucket_list_.get_deleter().alloc();
 
     // 分配新桶数组
@@ -1063,6 +2177,7 @@ class hash_table {
         nbc > 0 ? pointer_alloc_traits::allocate(npa, nbc) : nullptr;
     bucket_list_.reset(new_buckets);
     bucket_list_.get_deleter().size() = nbc;
+    bucket_policy_.reset(nbc);
 
     if (nbc > 0) {
       // 初始化新桶数组
@@ -1075,12 +2190,12 @@ class hash_table {
       next_pointer cp = pp->next_;
 
       if (cp != nullptr) {
-        size_type chash = constrain_hash(cp->hash(), nbc);
+        size_type chash = bucket_policy_.constrain(node_hash(cp));
         bucket_list_[chash] = pp;
         size_type phash = chash;
 
         for (pp = cp, cp = cp->next_; cp != nullptr; cp = pp->next_) {
-          chash = constrain_hash(cp->hash(), nbc);
+          chash = bucket_policy_.constrain(node_hash(cp));
           if (chash == phash) {
             pp = cp;
           } else {
@@ -1098,11 +2213,173 @@ class hash_table {
         }
       }
     }
+#if TINYSTL_HASH_TABLE_COUNTERS
+    rehash_nanoseconds_ += static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - rehash_start)
+            .count());
+#endif
+  }
+
+  // 并行 rehash，四个阶段之间以线程汇合分隔。旧桶、新桶各自按下标均分给
+  // 各线程：
+  //   1. 各线程把自己的旧桶改存链段首节点（原为前驱，前驱属于别的链段，
+  //      阶段 2 会被改写），并清零自己的新桶；
+  //   2. 各线程摘下自己旧桶中的节点，按新桶所属的线程分发到临时链表。
+  //      判断旧链段结束时只读下一个节点的哈希值，不读写别人节点的 next_；
+  //   3. 各线程把分发给自己的节点挂到新桶上，再按桶顺序串成一段；
+  //   4. 当前线程把各段依次接到 first_node_ 之后，补上每段首桶的前驱。
+  void do_rehash_unique_parallel(size_type nbc, size_type workers) {
+#if TINYSTL_HASH_TABLE_COUNTERS
+    auto rehash_start = std::chrono::steady_clock::now();
+    ++rehash_count_;
+    nodes_relinked_ += size();
+#endif
+    struct segment {
+      next_pointer first = nullptr;
+      next_pointer last = nullptr;
+      size_type bucket = 0;  // first 所在的新桶
+    };
+    // lists[s * workers + d]：s 号线程分发给 d 号线程的节点
+    std::vector<next_pointer> lists(workers * workers, nullptr);
+    std::vector<segment> segments(workers);
+    pointer_allocator& npa = bucket_list_.get_deleter().alloc();
+    next_pointer* nb = pointer_alloc_traits::allocate(npa, nbc);
+
+    next_pointer* ob = bucket_list_.get();
+    const size_type obc = bucket_count();
+    const bucket_policy op = bucket_policy_;
+    bucket_policy np = bucket_policy_;
+    np.reset(nbc);
+    const size_type nper = (nbc + workers - 1) / workers;
+
+    auto first_nodes = [&](size_type w) {
+      std::pair<size_type, size_type> r = parallel_range(obc, workers, w);
+      for (size_type b = r.first; b < r.second; ++b) {
+        if (ob[b] != nullptr) {
+          ob[b] = ob[b]->next_;
+        }
+      }
+      r = parallel_range(nbc, workers, w);
+      for (size_type c = r.first; c < r.second; ++c) {
+        nb[c] = nullptr;
+      }
+    };
+    auto scatter = [&](size_type w) {
+      next_pointer* out = lists.data() + w * workers;
+      std::pair<size_type, size_type> r = parallel_range(obc, workers, w);
+      for (size_type b = r.first; b < r.second; ++b) {
+        next_pointer cn = ob[b];
+        if (cn == nullptr) {
+          continue;
+        }
+        size_t h = node_hash(cn);
+        for (;;) {
+          next_pointer next = cn->next_;
+          size_type d = np.constrain(h) / nper;
+          cn->next_ = out[d];
+          out[d] = cn;
+          if (next == nullptr) {
+            break;
+          }
+          h = node_hash(next);
+          if (op.constrain(h) != b) {
+            break;
+          }
+          cn = next;
+        }
+      }
+    };
+    auto gather = [&](size_type w) {
+      for (size_type s = 0; s < workers; ++s) {
+        for (next_pointer cn = lists[s * workers + w]; cn != nullptr;) {
+          next_pointer next = cn->next_;
+          size_type c = np.constrain(node_hash(cn));
+          cn->next_ = nb[c];
+          nb[c] = cn;
+          cn = next;
+        }
+      }
+      segment& seg = segments[w];
+      next_pointer prev = nullptr;
+      std::pair<size_type, size_type> r = parallel_range(nbc, workers, w);
+      for (size_type c = r.first; c < r.second; ++c) {
+        next_pointer head = nb[c];
+        if (head == nullptr) {
+          continue;
+        }
+        if (prev == nullptr) {
+          seg.first = head;
+          seg.bucket = c;
+        } else {
+          prev->next_ = head;
+          nb[c] = prev;
+        }
+        for (prev = head; prev->next_ != nullptr; prev = prev->next_)
+          ;
+      }
+      seg.last = prev;
+    };
+    hash_parallel_for(workers, first_nodes);
+    hash_parallel_for(workers, scatter);
+    hash_parallel_for(workers, gather);
+
+    next_pointer pp = first_node_.ptr();
+    for (const segment& seg : segments) {
+      if (seg.first != nullptr) {
+        pp->next_ = seg.first;
+        nb[seg.bucket] = pp;
+        pp = seg.last;
+      }
+    }
+    bucket_list_.reset(nb);
+    bucket_list_.get_deleter().size() = nbc;
+    bucket_policy_ = np;
+#if TINYSTL_HASH_TABLE_COUNTERS
+    rehash_nanoseconds_ += static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - rehash_start)
+            .count());
+#endif
   }
 
-  void reserve_unique(size_type n) {
+  void reserve_unique(size_type n) { reserve_unique(n, parallel_policy(1)); }
+
+  void reserve_unique(size_type n, parallel_policy policy) {
     rehash_unique(static_cast<size_type>(
-        std::ceil(static_cast<float>(n) / max_load_factor())));
+                      std::ceil(static_cast<float>(n) / max_load_factor())),
+                  policy);
+  }
+
+  // 渐进式 rehash（默认关闭）
+  // 开启后，插入触发的扩容不再一次性搬移全部节点，而是分摊到之后的插入上：
+  //   准备阶段：分配新桶数组，每次插入清零一段，期间仍只使用旧桶数组；
+  //   迁移阶段：新旧桶数组并存，每次插入迁移若干个旧桶。旧桶迁移后置空，
+  //             查找与删除据此判断节点在哪个数组中。
+  // 插入、非 const 查找与按键删除都推进迁移，停止插入后迁移也会结束。
+  // 迁移会重排链表（迭代器与引用仍有效），遍历期间需要调用这些操作时
+  // 先 finish_rehash()。const 查找与按迭代器删除不推进迁移：前者可能
+  // 在共享锁下并发调用，后者要保持剩余元素的遍历顺序。
+  // 显式 rehash / reserve 仍一次完成。迁移期间的桶接口（bucket、
+  // bucket_size、局部迭代器）只对应新桶数组，需要时先调用 finish_rehash()。
+  void set_incremental_rehash(bool enable) noexcept {
+    incremental_rehash_ = enable;
+    if (!enable) {
+      finish_rehash();
+    }
+  }
+
+  bool incremental_rehash() const noexcept { return incremental_rehash_; }
+
+  bool rehash_in_progress() const noexcept {
+    return pending_buckets_ != nullptr || old_buckets_ != nullptr;
+  }
+
+  // 立即完成进行中的渐进式 rehash
+  void finish_rehash() noexcept {
+    while (rehash_in_progress()) {
+      advance_rehash();
+    }
   }
 
  public:
@@ -1138,21 +2415,131 @@ class hash_table {
   template <class _Key, class... Args>
   std::pair<iterator, bool> emplace_unique_key_args(const _Key& k,
                                                     Args&&... args) {
-    size_t hash = hash_function()(k);
+    return emplace_unique_key_hash(hash_function()(k), k,
+                                   std::forward<Args>(args)...);
+  }
+
+  // 批量插入（unique keys）：[first, first + n) 为前向范围，key_of 从元素中取出键。
+  // 先按最终元素个数扩容一次；再按块预先算出哈希值（threads > 1 时分段并行，
+  // 哈希函数须可被多个线程同时调用），插入时据此预取后面元素的桶槽
+  template <class _ForwardIt, class _KeyOf>
+  void insert_unique_bulk(_ForwardIt first, size_type n, _KeyOf key_of,
+                          unsigned threads = 1) {
+    if (n == 0) {
+      return;
+    }
+    reserve_unique(size() + n);
+    const size_type block = std::min(
+        n, threads > 1 ? bulk_parallel_block : bulk_block);
+    std::vector<size_t> hashes(block);
+    while (n > 0) {
+      size_type m = std::min(n, block);
+      hash_range(first, m, key_of, hashes.data(), threads);
+      for (size_type i = 0; i < m; ++i, ++first) {
+        if (i + bulk_prefetch_distance < m) {
+          hash_prefetch(std::addressof(bucket_list_[bucket_policy_.constrain(
+              hashes[i + bulk_prefetch_distance])]));
+        }
+        emplace_unique_key_hash(hashes[i], key_of(*first), *first);
+      }
+      n -= m;
+    }
+  }
+
+ private:
+  static constexpr size_type bulk_block = size_type(1) << 16;
+  static constexpr size_type bulk_parallel_block = size_type(1) << 18;
+  static constexpr size_type bulk_prefetch_distance = 8;
+  // 每个线程至少分到的元素个数，太少时不值得启动线程
+  static constexpr size_type bulk_min_per_thread = 4096;
+
+  // 计算 [first, first + n) 各元素的哈希值，写入 out
+  template <class _ForwardIt, class _KeyOf>
+  void hash_range(_ForwardIt first, size_type n, _KeyOf& key_of, size_t* out,
+                  unsigned threads) const {
+    size_type workers = std::min<size_type>(threads, n / bulk_min_per_thread);
+    if (workers <= 1) {
+      for (size_type i = 0; i < n; ++i, ++first) {
+        out[i] = hash_of(key_of(*first));
+      }
+      return;
+    }
+    // 当前线程处理第一段，其余各段交给新线程；异常带回当前线程再抛出
+    std::vector<std::thread> pool;
+    std::vector<std::exception_ptr> errors(workers);
+    pool.reserve(workers - 1);
+    size_type per = (n + workers - 1) / workers;
+    auto work = [&](size_type w, _ForwardIt it, size_type begin,
+                    size_type end) {
+      try {
+        for (size_type i = begin; i < end; ++i, ++it) {
+          out[i] = hash_of(key_of(*it));
+        }
+      } catch (...) {
+        errors[w] = std::current_exception();
+      }
+    };
+    _ForwardIt it = first;
+    std::advance(it, per);
+    for (size_type w = 1; w < workers; ++w) {
+      size_type begin = w * per;
+      size_type end = std::min(n, begin + per);
+      pool.emplace_back(work, w, it, begin, end);
+      if (w + 1 < workers) {
+        std::advance(it, per);
+      }
+    }
+    work(0, first, 0, std::min(n, per));
+    for (std::thread& t : pool) {
+      t.join();
+    }
+    for (std::exception_ptr& e : errors) {
+      if (e) {
+        std::rethrow_exception(e);
+      }
+    }
+  }
+
+ public:
+  // 哈希值已知的 emplace_unique_key_args（hash 为哈希函数的原始结果）
+  template <class _Key, class... Args>
+  std::pair<iterator, bool> emplace_unique_key_hash(size_t hash, const _Key& k,
+                                                    Args&&... args) {
+    hash = hash_cache::reduce(hash);
+    if (rehash_in_progress()) {
+      advance_rehash();
+      if (old_buckets_ != nullptr &&
+          size() + 1 > bucket_count() * max_load_factor()) {
+        finish_rehash();
+      }
+      if (old_buckets_ != nullptr) {
+        next_pointer found = find_in_migration(k, hash);
+        if (found != nullptr) {
+          return std::pair<iterator, bool>(iterator(found), false);
+        }
+        node_holder h = construct_node_hash(hash, std::forward<Args>(args)...);
+        link_in_migration(h.get()->ptr());
+        ++size();
+        return std::pair<iterator, bool>(
+            iterator(static_cast<next_pointer>(h.release())), true);
+      }
+    }
     size_type bc = bucket_count();
     bool inserted = false;
     next_pointer nd;
-    size_t chash;
+    size_t chash = 0;
 
     if (bc != 0) {
-      chash = constrain_hash(hash, bc);
+      chash = bucket_policy_.constrain(hash);
       nd = bucket_list_[chash];
       if (nd != nullptr) {
         for (nd = nd->next_;
              nd != nullptr &&
-             (nd->hash() == hash || constrain_hash(nd->hash(), bc) == chash);
+             (node_hash(nd) == hash ||
+              bucket_policy_.constrain(node_hash(nd)) == chash);
              nd = nd->next_) {
-          if (nd->hash() == hash && key_eq()(nd->upcast()->get_value(), k)) {
+          if (node_hash(nd) == hash &&
+              key_eq()(nd->upcast()->get_value(), k)) {
             goto done;
           }
         }
@@ -1162,12 +2549,9 @@ class hash_table {
     {
       node_holder h = construct_node_hash(hash, std::forward<Args>(args)...);
       if (size() + 1 > bc * max_load_factor() || bc == 0) {
-        rehash_unique(std::max<size_type>(
-            2 * bc + !is_hash_power2(bc),
-            static_cast<size_type>(std::ceil(static_cast<float>(size() + 1) /
-                                             max_load_factor()))));
+        grow_for_insert(bc);
         bc = bucket_count();
-        chash = constrain_hash(hash, bc);
+        chash = bucket_policy_.constrain(hash);
       }
 
       next_pointer pn = bucket_list_[chash];
@@ -1177,7 +2561,8 @@ class hash_table {
         pn->next_ = h.get()->ptr();
         bucket_list_[chash] = pn;
         if (h->next_ != nullptr) {
-          bucket_list_[constrain_hash(h->next_->hash(), bc)] = h.get()->ptr();
+          bucket_list_[bucket_policy_.constrain(node_hash(h->next_))] =
+              h.get()->ptr();
         }
       } else {
         h->next_ = pn->next_;
@@ -2,11 +2,39 @@
 #define TINYSTL___MEMORY_ALLOCATOR_H
 
 #include <cstddef>
+#include <cstdlib>
+#include <cstring>
 #include <new>
+#include <type_traits>
 #include <mystl/__memory/construct.h>
+#include <mystl/__type_traits/is_trivially_copyable.h>
+#include <mystl/__type_traits/is_trivially_relocatable.h>
 
 namespace mystl {
 
+#if defined(_MSC_VER)
+#define TINYSTL_NOINLINE __declspec(noinline)
+#elif defined(__GNUC__)
+#define TINYSTL_NOINLINE __attribute__((noinline))
+#else
+#define TINYSTL_NOINLINE
+#endif
+
+namespace detail {
+
+// allocator 按块大小在 malloc 与 ::operator new 之间分派。释放函数不内联：
+// 否则 GCC 看到 realloc 的结果可能流入 ::operator delete 的分支，
+// 误报 -Wmismatched-dealloc（两个分支的条件实际上互斥）
+TINYSTL_NOINLINE inline void allocator_free(void* p) noexcept {
+  std::free(p);
+}
+
+TINYSTL_NOINLINE inline void allocator_delete(void* p) noexcept {
+  ::operator delete(p);
+}
+
+}  // namespace detail
+
 template <typename T>
 class allocator {
  public:
@@ -33,16 +61,55 @@ class allocator {
   // static void deallocate(pointer p); c++11 不再提供
   void deallocate(pointer p, size_type n);
 
+  // -------------------------- 扩展：原地扩容 --------------------------
+  // 平凡拷贝且不过度对齐的类型，不小于 realloc_threshold 字节的大块改用
+  // malloc/free 管理，从而可以用 realloc 调整块大小：堆上的块能向后扩展时
+  // 不复制；glibc 对超过 mmap 阈值的大块使用 mremap，由内核重新映射页面，
+  // 同样不复制数据，也不需要新旧两块内存同时存在。
+  // 小块仍经过 ::operator new/delete，块的来源由元素个数决定。
+  // 写成函数而不是静态常量，T 可以在实例化 allocator<T> 时还是不完整类型
+  static constexpr bool can_reallocate() noexcept {
+    return is_trivially_copyable<T>::value &&
+           alignof(T) <= alignof(std::max_align_t);
+  }
+
+  // glibc 默认的 mmap 阈值
+  static constexpr size_type realloc_threshold = 128 * 1024;
+
+  // 把 p 指向的 old_n 个元素的块调整为 new_n 个元素，返回新地址；
+  // 前 min(old_n, new_n) 个元素按字节搬到新地址，旧地址随即失效。
+  // 只能在 can_reallocate() 为 true 时调用；失败抛出 std::bad_alloc，
+  // 此时 p 保持不变
+  pointer reallocate(pointer p, size_type old_n, size_type new_n);
+
   template <typename... Args>
   void construct(pointer p, Args&&... args);
   void destroy(pointer p);
   void destroy(pointer first, pointer last);
+
+ private:
+  // n 个元素的块是否由 malloc 分配
+  static bool uses_malloc(size_type n) noexcept {
+    if constexpr (can_reallocate()) {
+      return n >= realloc_threshold / sizeof(T);
+    } else {
+      return false;
+    }
+  }
 };
 
 template <typename T>
 typename allocator<T>::pointer allocator<T>::allocate(size_type n) {
   if (n == 0)
     return nullptr;
+  if (n > static_cast<size_type>(-1) / sizeof(T))
+    throw std::bad_array_new_length();
+  if (uses_malloc(n)) {
+    void* p = std::malloc(n * sizeof(T));
+    if (p == nullptr)
+      throw std::bad_alloc();
+    return static_cast<pointer>(p);
+  }
   return static_cast<pointer>(::operator new(n * sizeof(T)));
 }
 
@@ -55,12 +122,52 @@ typename allocator<T>::pointer allocator<T>::allocate(size_type n) {
 // }
 
 template <typename T>
-void allocator<T>::deallocate(pointer p, size_type /*n*/) {
+void allocator<T>::deallocate(pointer p, size_type n) {
   if (p == nullptr)
     return;
-  ::operator delete(p);
+  if (uses_malloc(n)) {
+    detail::allocator_free(p);
+  } else {
+    detail::allocator_delete(p);
+  }
 }
 
+template <typename T>
+typename allocator<T>::pointer allocator<T>::reallocate(pointer p,
+                                                        size_type old_n,
+                                                        size_type new_n) {
+  static_assert(can_reallocate(),
+                "allocator::reallocate requires a trivially copyable type");
+  if (p == nullptr)
+    return allocate(new_n);
+  if (new_n == 0) {
+    deallocate(p, old_n);
+    return nullptr;
+  }
+  if (new_n > static_cast<size_type>(-1) / sizeof(T))
+    throw std::bad_array_new_length();
+  if (uses_malloc(old_n) && uses_malloc(new_n)) {
+    void* q = std::realloc(p, new_n * sizeof(T));
+    if (q == nullptr)
+      throw std::bad_alloc();
+    return static_cast<pointer>(q);
+  }
+  // 至少一端是 ::operator new 的小块：分配新块后按字节搬移
+  pointer q = allocate(new_n);
+  std::memcpy(q, p, (old_n < new_n ? old_n : new_n) * sizeof(T));
+  deallocate(p, old_n);
+  return q;
+}
+
+// 判断分配器是否提供 reallocate 扩展，并且对当前元素类型可用
+template <typename Alloc, typename = void>
+struct allocator_can_reallocate : public false_type {};
+
+template <typename Alloc>
+struct allocator_can_reallocate<
+    Alloc, std::void_t<decltype(Alloc::can_reallocate())>>
+    : public integral_constant<bool, Alloc::can_reallocate()> {};
+
 template <typename T>
 template <typename... Args>
 void allocator<T>::construct(pointer p, Args&&... args) {
@@ -77,6 +184,10 @@ void allocator<T>::destroy(pointer first, pointer last) {
   mystl::destroy(first, last);
 }
 
+// 无状态分配器，可以平凡重定位
+template <typename T>
+struct is_trivially_relocatable<allocator<T>> : public true_type {};
+
 }  // namespace mystl
 
 #endif  // MYTINYSTL_ALLOCATOR_H_
\ No newline at end of file
@@ -0,0 +1,103 @@
+#ifndef TINYSTL___MEMORY_FOOTPRINT_H
+#define TINYSTL___MEMORY_FOOTPRINT_H
+
+#include <cstddef>
+#include <memory>
+#include <mystl/__memory/node_pool_allocator.h>
+
+namespace mystl {
+
+// ============================================================================
+// 内存占用统计
+// ============================================================================
+// 各容器的 memory_usage() 与自由函数 footprint(c) 返回 memory_footprint，
+// 只统计容器向分配器申请的堆内存，不含容器对象本身（sizeof(c)）：
+//   payload_bytes  : 元素本身占用的字节（size() * sizeof(value_type)）
+//   slack_bytes    : 已分配但尚未构造元素的容量（vector/string 的尾部余量、
+//                    deque 块内空位等）
+//   overhead_bytes : 容器自身的簿记开销，例如链表节点的 prev/next、
+//                    hash_node 的 next_ 与缓存的 hash_、桶数组、deque 块映射
+//   rounding_bytes : 分配器取整与块头的估计值，见 allocation_rounding
+//   allocations    : 当前持有的分配次数
+struct memory_footprint {
+  std::size_t payload_bytes = 0;
+  std::size_t slack_bytes = 0;
+  std::size_t overhead_bytes = 0;
+  std::size_t rounding_bytes = 0;
+  std::size_t allocations = 0;
+
+  // 实际从分配器拿走的字节数（估计）
+  std::size_t total_bytes() const noexcept {
+    return payload_bytes + slack_bytes + overhead_bytes + rounding_bytes;
+  }
+
+  memory_footprint& operator+=(const memory_footprint& other) noexcept {
+    payload_bytes += other.payload_bytes;
+    slack_bytes += other.slack_bytes;
+    overhead_bytes += other.overhead_bytes;
+    rounding_bytes += other.rounding_bytes;
+    allocations += other.allocations;
+    return *this;
+  }
+};
+
+// ----------------------------------------------------------------------------
+// 分配器取整模型
+// ----------------------------------------------------------------------------
+// 按 glibc malloc 的规则估计一次申请 bytes 字节时额外占用的空间：
+// 每个 chunk 带一个 size_t 的头，按 2 * sizeof(size_t) 对齐，最小 4 个字；
+// 超过 mmap 阈值（默认 128 KiB）的申请单独 mmap，按页取整。
+// 其他 malloc 实现的数字会不同，但量级一致，足以比较容器之间的差别。
+inline std::size_t malloc_rounding(std::size_t bytes) noexcept {
+  if (bytes == 0) {
+    return 0;
+  }
+  constexpr std::size_t header = sizeof(std::size_t);
+  constexpr std::size_t align_mask = 2 * sizeof(std::size_t) - 1;
+  constexpr std::size_t min_chunk = 4 * sizeof(std::size_t);
+  constexpr std::size_t mmap_threshold = 128 * 1024;
+  constexpr std::size_t page_mask = 4096 - 1;
+
+  std::size_t chunk;
+  if (bytes >= mmap_threshold) {
+    chunk = (bytes + 2 * header + page_mask) & ~page_mask;
+  } else {
+    chunk = (bytes + header + align_mask) & ~align_mask;
+    if (chunk < min_chunk) {
+      chunk = min_chunk;
+    }
+  }
+  return chunk - bytes;
+}
+
+// 一次向 Alloc 申请 count 个对象时的取整字节。默认分配器最终调用
+// ::operator new，按 malloc 模型估计；自定义分配器可以特化本模板
+template <class Alloc>
+struct allocation_rounding {
+  static std::size_t bytes(std::size_t count) noexcept {
+    using value_type = typename std::allocator_traits<Alloc>::value_type;
+    return count == 0 ? 0 : malloc_rounding(count * sizeof(value_type));
+  }
+};
+
+// node_pool_allocator：单个对象从池中按 8 字节级别切分，只有级别取整；
+// chunk 头与 chunk 中尚未切分的部分由整个池共享，不计入单个容器
+template <class T>
+struct allocation_rounding<node_pool_allocator<T>> {
+  static std::size_t bytes(std::size_t count) noexcept {
+    if (count == 1 && node_pool::is_pooled(sizeof(T), alignof(T))) {
+      return node_pool::block_size(sizeof(T)) - sizeof(T);
+    }
+    return count == 0 ? 0 : malloc_rounding(count * sizeof(T));
+  }
+};
+
+// 统一入口：footprint(c) 等价于 c.memory_usage()
+template <class Container>
+auto footprint(const Container& c) -> decltype(c.memory_usage()) {
+  return c.memory_usage();
+}
+
+}  // namespace mystl
+
+#endif  // TINYSTL___MEMORY_FOOTPRINT_H
@@ -0,0 +1,250 @@
+#ifndef TINYSTL___MEMORY_NODE_POOL_ALLOCATOR_H
+#define TINYSTL___MEMORY_NODE_POOL_ALLOCATOR_H
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <mystl/__type_traits/is_trivially_relocatable.h>
+
+namespace mystl {
+
+// ============================================================================
+// 节点池：按大小分级的 slab 分配器
+// ============================================================================
+// 节点式容器（hash_table、list）每次插入只申请一个节点。node_pool 从大块内存
+// （chunk）中切出固定大小的块，释放的块挂到对应级别的空闲链表上供下次复用，
+// 插入/删除反复进行时不再每次调用 malloc/free。
+//
+// 级别以 8 字节为粒度，最大 256 字节；更大、过度对齐或一次申请多个对象的
+// 请求（例如桶数组）直接转交 ::operator new。块只会回到空闲链表，
+// 所有 chunk 在池销毁时统一归还。
+//
+// 池本身不是线程安全的，与使用它的容器一致。
+class node_pool {
+ public:
+  static constexpr std::size_t granularity = 8;
+  static constexpr std::size_t max_block_size = 256;
+  static constexpr std::size_t class_count = max_block_size / granularity;
+
+  node_pool() noexcept = default;
+  node_pool(const node_pool&) = delete;
+  node_pool& operator=(const node_pool&) = delete;
+
+  ~node_pool() { release(); }
+
+  // 判断 bytes/align 的单个对象是否由池负责
+  static constexpr bool is_pooled(std::size_t bytes,
+                                  std::size_t align) noexcept {
+    return bytes <= max_block_size && align <= alignof(std::max_align_t);
+  }
+
+  void* allocate(std::size_t bytes) {
+    size_class& sc = classes_[class_index(bytes)];
+    if (sc.free_list != nullptr) {
+      free_block* b = sc.free_list;
+      sc.free_list = b->next;
+      return b;
+    }
+    if (sc.cur == sc.end) {
+      refill(sc, class_size(bytes));
+    }
+    void* p = sc.cur;
+    sc.cur += class_size(bytes);
+    return p;
+  }
+
+  void deallocate(void* p, std::size_t bytes) noexcept {
+    size_class& sc = classes_[class_index(bytes)];
+    free_block* b = static_cast<free_block*>(p);
+    b->next = sc.free_list;
+    sc.free_list = b;
+  }
+
+  // 归还全部 chunk；之前分配出去的块全部失效
+  void release() noexcept {
+    while (chunks_ != nullptr) {
+      chunk_header* next = chunks_->next;
+      ::operator delete(chunks_);
+      chunks_ = next;
+    }
+    for (size_class& sc : classes_) {
+      sc = size_class();
+    }
+    bytes_reserved_ = 0;
+  }
+
+  // 已向系统申请的 chunk 总字节数（含 chunk 头）
+  std::size_t bytes_reserved() const noexcept { return bytes_reserved_; }
+
+  // bytes 字节的请求实际占用的块大小（按级别取整）
+  static constexpr std::size_t block_size(std::size_t bytes) noexcept {
+    return class_size(bytes);
+  }
+
+  // -------------------------- 引用计数（供 node_pool_allocator 共享）--------------------------
+  void add_ref() noexcept { ++refs_; }
+
+  // 返回 true 表示最后一个引用已释放
+  bool release_ref() noexcept { return --refs_ == 0; }
+
+ private:
+  // 空闲块复用自身前 8 字节作为链表指针，因此最小级别为 8 字节
+  struct free_block {
+    free_block* next;
+  };
+
+  // chunk 头部，按 max_align_t 对齐，保证其后的块地址满足对齐要求
+  struct alignas(std::max_align_t) chunk_header {
+    chunk_header* next;
+  };
+
+  struct size_class {
+    free_block* free_list = nullptr;
+    char* cur = nullptr;  // 最新 chunk 中尚未切分部分的起点
+    char* end = nullptr;
+    std::size_t next_blocks = min_chunk_blocks;
+  };
+
+  static constexpr std::size_t min_chunk_blocks = 16;
+  static constexpr std::size_t max_chunk_bytes = 64 * 1024;
+
+  static constexpr std::size_t class_index(std::size_t bytes) noexcept {
+    return bytes == 0 ? 0 : (bytes - 1) / granularity;
+  }
+
+  static constexpr std::size_t class_size(std::size_t bytes) noexcept {
+    return (class_index(bytes) + 1) * granularity;
+  }
+
+  // 申请新 chunk，块数按级别几何增长，小表不会一次占用大块内存
+  void refill(size_class& sc, std::size_t block_size) {
+    std::size_t blocks = sc.next_blocks;
+    std::size_t bytes = sizeof(chunk_header) + blocks * block_size;
+    chunk_header* c = static_cast<chunk_header*>(::operator new(bytes));
+    c->next = chunks_;
+    chunks_ = c;
+    bytes_reserved_ += bytes;
+
+    sc.cur = reinterpret_cast<char*>(c + 1);
+    sc.end = sc.cur + blocks * block_size;
+    if (blocks * block_size * 2 <= max_chunk_bytes) {
+      sc.next_blocks = blocks * 2;
+    }
+  }
+
+  size_class classes_[class_count];
+  chunk_header* chunks_ = nullptr;
+  std::size_t bytes_reserved_ = 0;
+  std::size_t refs_ = 0;
+};
+
+// ============================================================================
+// node_pool_allocator：共享 node_pool 的标准分配器
+// ============================================================================
+// 用法：作为 unordered_map 等容器的 Allocator 参数
+//   mystl::unordered_map<K, V, Hash, Eq,
+//                        mystl::node_pool_allocator<std::pair<const K, V>>>
+// 容器内部 rebind 得到的节点分配器与原分配器共享同一个池。
+//
+// 每个默认构造的分配器拥有独立的池，拷贝（含 rebind）共享池并以引用计数管理，
+// 最后一个持有者析构时归还全部 chunk。拷贝构造容器时新容器得到新池，
+// 因此两个容器不会在不同线程中共用同一个非线程安全的池。
+template <typename T>
+class node_pool_allocator {
+ public:
+  using value_type = T;
+  using pointer = T*;
+  using const_pointer = const T*;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  // 节点已分配在本池中，移动赋值与交换时必须带上池
+  using propagate_on_container_copy_assignment = std::false_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+  using is_always_equal = std::false_type;
+
+  template <typename U>
+  struct rebind {
+    using other = node_pool_allocator<U>;
+  };
+
+ public:
+  node_pool_allocator() : pool_(new node_pool()) { pool_->add_ref(); }
+
+  node_pool_allocator(const node_pool_allocator& other) noexcept
+      : pool_(other.pool_) {
+    pool_->add_ref();
+  }
+
+  template <typename U>
+  node_pool_allocator(const node_pool_allocator<U>& other) noexcept
+      : pool_(other.pool()) {
+    pool_->add_ref();
+  }
+
+  node_pool_allocator& operator=(const node_pool_allocator& other) noexcept {
+    other.pool_->add_ref();
+    drop();
+    pool_ = other.pool_;
+    return *this;
+  }
+
+  ~node_pool_allocator() { drop(); }
+
+  pointer allocate(size_type n) {
+    if (n == 1 && node_pool::is_pooled(sizeof(T), alignof(T))) {
+      return static_cast<pointer>(pool_->allocate(sizeof(T)));
+    }
+    return static_cast<pointer>(::operator new(n * sizeof(T)));
+  }
+
+  void deallocate(pointer p, size_type n) noexcept {
+    if (p == nullptr) {
+      return;
+    }
+    if (n == 1 && node_pool::is_pooled(sizeof(T), alignof(T))) {
+      pool_->deallocate(p, sizeof(T));
+    } else {
+      ::operator delete(p);
+    }
+  }
+
+  // 拷贝构造出的容器使用独立的新池
+  node_pool_allocator select_on_container_copy_construction() const {
+    return node_pool_allocator();
+  }
+
+  node_pool* pool() const noexcept { return pool_; }
+
+ private:
+  void drop() noexcept {
+    if (pool_->release_ref()) {
+      delete pool_;
+    }
+  }
+
+  node_pool* pool_;
+};
+
+template <typename T, typename U>
+bool operator==(const node_pool_allocator<T>& lhs,
+                const node_pool_allocator<U>& rhs) noexcept {
+  return lhs.pool() == rhs.pool();
+}
+
+template <typename T, typename U>
+bool operator!=(const node_pool_allocator<T>& lhs,
+                const node_pool_allocator<U>& rhs) noexcept {
+  return !(lhs == rhs);
+}
+
+// 只持有池指针，引用计数不随对象地址变化
+template <typename T>
+struct is_trivially_relocatable<node_pool_allocator<T>> : public true_type {};
+
+}  // namespace mystl
+
+#endif  // TINYSTL___MEMORY_NODE_POOL_ALLOCATOR_H
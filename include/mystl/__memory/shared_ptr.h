@@ -3,6 +3,7 @@
 
 #include <mystl/__utility/move.h>
 #include <mystl/__utility/swap.h>
+#include <mystl/__type_traits/is_trivially_relocatable.h>
 #include <atomic>
 #include <cstddef>
 #include <memory>
@@ -313,6 +314,13 @@ class weak_ptr {
   }
 };
 
+// 控制块只记录引用计数，不记录 shared_ptr/weak_ptr 对象的地址
+template <typename T>
+struct is_trivially_relocatable<shared_ptr<T>> : public true_type {};
+
+template <typename T>
+struct is_trivially_relocatable<weak_ptr<T>> : public true_type {};
+
 }  // namespace mystl
 
 #endif
\ No newline at end of file
@@ -9,9 +9,13 @@
 #include <mystl/__type_traits/integral_constant.h>
 #include <mystl/__type_traits/enable_if.h>
 #include <mystl/__type_traits/is_integral.h>
+#include <mystl/__memory/footprint.h>
+#include <mystl/__memory/uninitialized_algorithms.h>
+#include <mystl/__type_traits/is_trivially_relocatable.h>
 #include <memory>
 #include <algorithm>  // 使用 std::move, std::move_backward
 #include <cstddef>
+#include <cstring>    // 使用 std::memmove
 #include <iterator>  // 用于 std::iterator_traits
 
 namespace mystl {
@@ -85,6 +89,18 @@ struct split_buffer {
   size_type front_spare() const { return static_cast<size_type>(begin_ - first_); }
   size_type back_spare() const { return static_cast<size_type>(cap_ - end_); }
 
+  // 内存占用：前后两端的空闲空间都计入 slack
+  memory_footprint memory_usage() const noexcept {
+    memory_footprint f;
+    f.payload_bytes = size() * sizeof(value_type);
+    f.slack_bytes = (front_spare() + back_spare()) * sizeof(value_type);
+    if (capacity() != 0) {
+      f.rounding_bytes = allocation_rounding<alloc_rr>::bytes(capacity());
+      f.allocations = 1;
+    }
+    return f;
+  }
+
   // 元素访问
   reference front() { return *begin_; }
   const_reference front() const { return *begin_; }
@@ -120,6 +136,14 @@ struct split_buffer {
   void destruct_at_begin(pointer new_begin);
   void destruct_at_end(pointer new_end) noexcept;
 
+  // 扩容时把 [begin_, end_) 搬到 t 的尾部：可平凡重定位的类型一次 memcpy，
+  // 本缓冲区随即置空，交换后 t 析构时不再逐个析构旧元素
+  template <class Buffer>
+  void relocate_into(Buffer& t);
+
+  // 在同一块内存中把 [begin_, end_) 整体平移 d 个位置（d 可正可负）
+  void shift_by(difference_type d);
+
   // 移动分配器
   void move_assign_alloc(split_buffer& c, true_type) noexcept;
   void move_assign_alloc(split_buffer&, false_type) noexcept {}
@@ -236,6 +260,42 @@ void split_buffer<Tp, Allocator>::destruct_at_end(pointer new_end) noexcept {
   }
 }
 
+template <class Tp, class Allocator>
+template <class Buffer>
+void split_buffer<Tp, Allocator>::relocate_into(Buffer& t) {
+  if constexpr (is_trivially_relocatable<value_type>::value) {
+    t.end_ = mystl::uninitialized_relocate(begin_, end_, t.end_);
+    end_ = begin_;
+  } else {
+    // 使用 std::move_iterator
+    typedef std::move_iterator<iterator> Ip;
+    t.construct_at_end(Ip(begin_), Ip(end_));
+  }
+}
+
+template <class Tp, class Allocator>
+void split_buffer<Tp, Allocator>::shift_by(difference_type d) {
+  if constexpr (is_trivially_relocatable<value_type>::value) {
+    // 源区间与目标区间可能重叠，使用 memmove
+    std::size_t n = static_cast<std::size_t>(end_ - begin_);
+    if (n != 0) {
+      std::memmove(static_cast<void*>(begin_ + d),
+                   static_cast<const void*>(begin_), n * sizeof(value_type));
+    }
+    begin_ += d;
+    end_ += d;
+  } else if (d > 0) {
+    // 使用 std::move_backward 移动数据（从后向前移动）
+    std::move_backward(begin_, end_, end_ + d);
+    begin_ += d;
+    end_ += d;
+  } else {
+    // 使用 std::move 移动数据
+    end_ = std::move(begin_, end_, begin_ + d);
+    begin_ += d;
+  }
+}
+
 // 构造相关实现
 template <class Tp, class Allocator>
 void split_buffer<Tp, Allocator>::construct_at_end(size_type n) {
@@ -278,9 +338,7 @@ void split_buffer<Tp, Allocator>::construct_at_end_with_sentinel(Iterator first,
       size_type old_cap = cap_ - first_;
       size_type new_cap = std::max<size_type>(2 * old_cap, 8);
       split_buffer buf(new_cap, 0, a);
-      for (pointer p = begin_; p != end_; ++p, ++buf.end_) {
-        alloc_traits::construct(alloc_, buf.end_, mystl::move(*p));
-      }
+      relocate_into(buf);
       swap(buf);
     }
     alloc_traits::construct(alloc_, end_, *first);
@@ -295,10 +353,7 @@ void split_buffer<Tp, Allocator>::shrink_to_fit() noexcept {
     try {
       split_buffer<value_type, alloc_rr&> t(size(), 0, alloc_);
       if (t.capacity() < capacity()) {
-        // 使用 std::move_iterator
-        typedef std::move_iterator<iterator> Ip;
-        t.construct_at_end(Ip(begin_), Ip(end_));
-        t.end_ = t.begin_ + (end_ - begin_);
+        relocate_into(t);
         std::swap(first_, t.first_);
         std::swap(begin_, t.begin_);
         std::swap(end_, t.end_);
@@ -319,17 +374,12 @@ void split_buffer<Tp, Allocator>::emplace_front(Args&&... args) {
       // 有后端空间，移动数据向后
       difference_type d = cap_ - end_;
       d = (d + 1) / 2;
-      // 使用 std::move_backward 移动数据（从后向前移动）
-      std::move_backward(begin_, end_, end_ + d);
-      begin_ = end_ + d - (end_ - begin_);
-      end_ = end_ + d;
+      shift_by(d);
     } else {
       // 需要扩容
       size_type c = std::max<size_type>(2 * static_cast<size_type>(cap_ - first_), 1);
       split_buffer<value_type, alloc_rr&> t(c, (c + 3) / 4, alloc_);
-      // 使用 std::move_iterator
-      typedef std::move_iterator<iterator> Ip;
-      t.construct_at_end(Ip(begin_), Ip(end_));
+      relocate_into(t);
       std::swap(first_, t.first_);
       std::swap(begin_, t.begin_);
       std::swap(end_, t.end_);
@@ -349,16 +399,12 @@ void split_buffer<Tp, Allocator>::emplace_back(Args&&... args) {
       // 有前端空间，移动数据向前
       difference_type d = begin_ - first_;
       d = (d + 1) / 2;
-      // 使用 std::move 移动数据
-      end_ = std::move(begin_, end_, begin_ - d);
-      begin_ = begin_ - d;
+      shift_by(-d);
     } else {
       // 需要扩容
       size_type c = std::max<size_type>(2 * static_cast<size_type>(cap_ - first_), 1);
       split_buffer<value_type, alloc_rr&> t(c, c / 4, alloc_);
-      // 使用 std::move_iterator
-      typedef std::move_iterator<iterator> Ip;
-      t.construct_at_end(Ip(begin_), Ip(end_));
+      relocate_into(t);
       std::swap(first_, t.first_);
       std::swap(begin_, t.begin_);
       std::swap(end_, t.end_);
@@ -375,6 +421,11 @@ void swap(split_buffer<Tp, Allocator>& x, split_buffer<Tp, Allocator>& y) noexce
   x.swap(y);
 }
 
+// 四个指针加分配器，可以整体 memcpy
+template <class Tp, class Allocator>
+struct is_trivially_relocatable<split_buffer<Tp, Allocator>>
+    : public is_trivially_relocatable<Allocator> {};
+
 }  // namespace mystl
 
 #endif  // TINYSTL___MEMORY_SPLIT_BUFFER_H
@@ -4,11 +4,13 @@
 #include <mystl/__memory/construct.h>
 #include <mystl/__type_traits/integral_constant.h>
 #include <mystl/__type_traits/is_trivially_copyable.h>
+#include <mystl/__type_traits/is_trivially_relocatable.h>
 #include <mystl/__utility/move.h>
 #include <mystl/algorithm.h>
 #include <mystl/iterator.h>
 #include <mystl/type_traits.h>
 #include <algorithm>
+#include <cstring>
 
 namespace mystl {
 // result迭代器要符合 ForwardIterator 要求
@@ -107,6 +109,25 @@ ForwardIterator uninitialized_move(InputIterator first, InputIterator last,
                                 mystl::is_trivially_copyable<ValueType>{});
 }
 
+// 把 [first, last) 中的对象重定位到未初始化的 result，之后原区间视为已销毁。
+// 可平凡重定位的类型一次 memcpy 完成，不调用移动构造和旧对象的析构函数；
+// 其他类型先逐个移动构造，全部成功后再析构旧对象。两个区间不能重叠
+template <typename T>
+T* uninitialized_relocate(T* first, T* last, T* result) {
+  if constexpr (mystl::is_trivially_relocatable<T>::value) {
+    std::size_t n = static_cast<std::size_t>(last - first);
+    if (n != 0) {
+      std::memcpy(static_cast<void*>(result), static_cast<const void*>(first),
+                  n * sizeof(T));
+    }
+    return result + n;
+  } else {
+    T* end = mystl::uninitialized_move(first, last, result);
+    mystl::destroy(first, last);
+    return end;
+  }
+}
+
 }  // namespace mystl
 
 #endif  // MYTINYSTL_UNINITIALIZED_H_
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define TINYSTL___MEMOEY_UNIQUE_PTR_H
 
 #include <mystl/utility.h>
+#include <mystl/__type_traits/is_trivially_relocatable.h>
 #include <cstddef>
 #include "mystl/__utility/move.h"
 #include "mystl/__utility/swap.h"
@@ -141,6 +142,10 @@ class unique_ptr<T[], default_delete<T[]>> {
     }
   */
 };
+
+template <typename T, typename Deleter>
+struct is_trivially_relocatable<unique_ptr<T, Deleter>>
+    : public is_trivially_relocatable<Deleter> {};
 }  // namespace mystl
 
 #endif
\ No newline at end of file
@@ -0,0 +1,115 @@
+#ifndef TINYSTL_NODE_HANDLE_H_
+#define TINYSTL_NODE_HANDLE_H_
+
+#include <memory>       // for allocator_traits, addressof
+#include <optional>     // for optional
+#include <type_traits>  // for remove_const_t
+#include <utility>      // for move, swap
+
+namespace mystl {
+
+template <class _Tp, class _Hash, class _Equal, class _Alloc, class _Policy,
+          class _Cache>
+class hash_table;
+
+// ============================================================================
+// 节点句柄（C++17 node_type）
+// ============================================================================
+// 持有一个从 unordered_map 中摘下的节点及其分配器。extract 把节点从表中
+// 摘下而不释放，insert(node_type&&) 把节点重新挂到（另一张）表上，整个过程
+// 不分配、不拷贝、不移动元素。句柄析构时若仍持有节点，则销毁元素并释放节点。
+//
+// _NodeType 为 hash_table 的节点类型，其值类型需提供 get_value() 返回
+// std::pair<const Key, T>&（即 mystl::hash_map_value）。
+template <class _NodeType, class _Alloc>
+class map_node_handle {
+ public:
+  using allocator_type = _Alloc;
+  using key_type = std::remove_const_t<
+      typename std::allocator_traits<_Alloc>::value_type::first_type>;
+  using mapped_type =
+      typename std::allocator_traits<_Alloc>::value_type::second_type;
+
+ private:
+  using node_allocator = typename std::allocator_traits<
+      _Alloc>::template rebind_alloc<_NodeType>;
+  using node_traits = std::allocator_traits<node_allocator>;
+  using node_pointer = typename node_traits::pointer;
+
+  node_pointer ptr_ = nullptr;
+  std::optional<allocator_type> alloc_;
+
+  map_node_handle(node_pointer p, const allocator_type& a) : ptr_(p), alloc_(a) {}
+
+  // 放弃所有权（节点已被表接管）
+  void release_node() noexcept {
+    ptr_ = nullptr;
+    alloc_.reset();
+  }
+
+  void destroy_node() noexcept {
+    if (ptr_ != nullptr) {
+      node_allocator na(*alloc_);
+      node_traits::destroy(na, std::addressof(ptr_->get_value()));
+      node_traits::deallocate(na, ptr_, 1);
+    }
+    release_node();
+  }
+
+  template <class, class, class, class, class, class>
+  friend class hash_table;
+
+ public:
+  constexpr map_node_handle() noexcept = default;
+
+  map_node_handle(map_node_handle&& other) noexcept
+      : ptr_(other.ptr_), alloc_(std::move(other.alloc_)) {
+    other.release_node();
+  }
+
+  map_node_handle& operator=(map_node_handle&& other) noexcept {
+    destroy_node();
+    ptr_ = other.ptr_;
+    alloc_ = std::move(other.alloc_);
+    other.release_node();
+    return *this;
+  }
+
+  map_node_handle(const map_node_handle&) = delete;
+  map_node_handle& operator=(const map_node_handle&) = delete;
+
+  ~map_node_handle() { destroy_node(); }
+
+  [[nodiscard]] bool empty() const noexcept { return ptr_ == nullptr; }
+  explicit operator bool() const noexcept { return ptr_ != nullptr; }
+
+  allocator_type get_allocator() const { return *alloc_; }
+
+  // 句柄持有节点时可以修改键，重新插入时哈希值会重新计算
+  key_type& key() const {
+    return const_cast<key_type&>(ptr_->get_value().get_value().first);
+  }
+
+  mapped_type& mapped() const { return ptr_->get_value().get_value().second; }
+
+  void swap(map_node_handle& other) noexcept {
+    std::swap(ptr_, other.ptr_);
+    std::swap(alloc_, other.alloc_);
+  }
+
+  friend void swap(map_node_handle& x, map_node_handle& y) noexcept {
+    x.swap(y);
+  }
+};
+
+// insert(node_type&&) 的返回值：插入失败时节点原样退回到 node 中
+template <class _Iterator, class _NodeType>
+struct node_insert_return {
+  _Iterator position;
+  bool inserted;
+  _NodeType node;
+};
+
+}  // namespace mystl
+
+#endif  // TINYSTL_NODE_HANDLE_H_
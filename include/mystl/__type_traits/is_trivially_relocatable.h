@@ -0,0 +1,34 @@
+#ifndef TINYSTL___TYPE_TRAITS_IS_TRIVIALLY_RELOCATABLE_H
+#define TINYSTL___TYPE_TRAITS_IS_TRIVIALLY_RELOCATABLE_H
+
+#include <mystl/__type_traits/integral_constant.h>
+#include <memory>
+
+namespace mystl {
+// 是否可以平凡重定位：把对象的字节 memcpy 到新地址、并且不再调用旧对象的
+// 析构函数，效果等同于“移动构造到新地址 + 析构旧对象”。
+// 平凡拷贝的类型天然满足；不含指向自身的指针的类型（持有 unique_ptr、
+// mystl::string 等的结构体）也满足，但需要通过特化或
+// TINYSTL_DECLARE_TRIVIALLY_RELOCATABLE 显式声明。
+// 含有自引用的类型（例如 list 的哨兵节点）不能声明为可重定位。
+template <typename T>
+struct is_trivially_relocatable
+    : public integral_constant<bool, __is_trivially_copyable(T)> {};
+
+template <typename T>
+struct is_trivially_relocatable<std::allocator<T>> : public true_type {};
+
+template <typename T>
+inline constexpr bool is_trivially_relocatable_v =
+    is_trivially_relocatable<T>::value;
+}  // namespace mystl
+
+// 为非模板类型声明可平凡重定位，需在全局命名空间中使用：
+//   struct widget { mystl::unique_ptr<int> p; };
+//   TINYSTL_DECLARE_TRIVIALLY_RELOCATABLE(widget);
+#define TINYSTL_DECLARE_TRIVIALLY_RELOCATABLE(...)                 \
+  template <>                                                      \
+  struct mystl::is_trivially_relocatable<__VA_ARGS__>              \
+      : public ::mystl::true_type {}
+
+#endif
@@ -0,0 +1,317 @@
+#ifndef TINYSTL_CONCURRENT_UNORDERED_MAP_H_
+#define TINYSTL_CONCURRENT_UNORDERED_MAP_H_
+
+#include <cstddef>       // for size_t
+#include <functional>    // for hash, equal_to
+#include <limits>        // for numeric_limits
+#include <memory>        // for allocator, allocator_traits, unique_ptr
+#include <mutex>         // for unique_lock
+#include <new>           // for placement new
+#include <optional>      // for optional
+#include <shared_mutex>  // for shared_mutex, shared_lock
+#include <thread>        // for thread::hardware_concurrency
+#include <tuple>         // for forward_as_tuple
+#include <utility>       // for pair, move, forward, piecewise_construct
+#include "__hash_table.h"
+#include "unordered_map.h"  // for hash_map_value, unordered_map_hasher, unordered_map_key_equal
+
+namespace mystl {
+
+// concurrent_unordered_map：分片加锁的并发哈希表
+// 键按哈希值的高位分到 2 的幂个分片，每个分片是一张独立的 hash_table，
+// 由各自的读写锁保护：查找取共享锁，插入/删除/更新取独占锁，
+// 不同分片上的操作互不阻塞。分片按缓存行对齐，避免相邻分片的锁互相干扰。
+//
+// 接口以“单次原子操作”为单位，不提供迭代器：find 返回值的拷贝，
+// visit/update 在锁内调用回调，回调中不得再访问同一个表。
+// for_each 逐个分片加锁遍历，每个分片内部是一致的快照，分片之间不是。
+template <class Key, class T, class Hash = std::hash<Key>,
+          class KeyEqual = std::equal_to<Key>,
+          class Allocator = std::allocator<std::pair<const Key, T>>,
+          class BucketPolicy = hash_default_bucket_policy>
+class concurrent_unordered_map {
+ public:
+  // -------------------------- 类型别名 --------------------------
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+  using bucket_policy = BucketPolicy;
+  using size_type = typename std::allocator_traits<Allocator>::size_type;
+
+ private:
+  // -------------------------- 底层哈希表相关类型（与 unordered_map 相同）--------------------------
+  using node_value = hash_map_value<Key, T>;
+  using hasher_adapter = unordered_map_hasher<key_type, node_value, hasher,
+                                              key_equal>;
+  using key_equal_adapter =
+      unordered_map_key_equal<key_type, node_value, key_equal, hasher>;
+  using node_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<node_value>;
+  using table_type = hash_table<node_value, hasher_adapter, key_equal_adapter,
+                                node_allocator, bucket_policy>;
+
+  // 分片：独立的表与读写锁，按缓存行对齐
+  struct alignas(64) shard {
+    mutable std::shared_mutex mutex;
+    table_type table;
+
+    shard(const hasher_adapter& hf, const key_equal_adapter& ke,
+          const node_allocator& a)
+        : table(hf, ke, a) {}
+  };
+
+  using read_lock = std::shared_lock<std::shared_mutex>;
+  using write_lock = std::unique_lock<std::shared_mutex>;
+
+ public:
+  // -------------------------- 构造与析构 --------------------------
+  // shard_count 向上取整为 2 的幂，0 表示按硬件线程数自动选择。
+  // 每个分片的分配器由 select_on_container_copy_construction 得到，
+  // 使 node_pool_allocator 等有状态分配器在各分片间不共享（池本身不是线程安全的）
+  explicit concurrent_unordered_map(size_type shard_count = 0,
+                                    const hasher& hf = hasher(),
+                                    const key_equal& ke = key_equal(),
+                                    const allocator_type& alloc =
+                                        allocator_type())
+      : hasher_(hf) {
+    if (shard_count == 0) {
+      shard_count = default_shard_count();
+    }
+    while ((size_type(1) << shard_bits_) < shard_count) {
+      ++shard_bits_;
+    }
+    shard_count_ = size_type(1) << shard_bits_;
+    shards_ = std::allocator<shard>().allocate(shard_count_);
+    size_type built = 0;
+    try {
+      for (; built < shard_count_; ++built) {
+        node_allocator na(std::allocator_traits<allocator_type>::
+                              select_on_container_copy_construction(alloc));
+        ::new (static_cast<void*>(shards_ + built))
+            shard(hasher_adapter(hf), key_equal_adapter(ke), na);
+      }
+    } catch (...) {
+      destroy_shards(built);
+      throw;
+    }
+  }
+
+  concurrent_unordered_map(const concurrent_unordered_map&) = delete;
+  concurrent_unordered_map& operator=(const concurrent_unordered_map&) = delete;
+
+  ~concurrent_unordered_map() { destroy_shards(shard_count_); }
+
+  // -------------------------- 查找 --------------------------
+  // （1）find：返回值的拷贝，键不存在时为空
+  std::optional<mapped_type> find(const key_type& key) const {
+    size_t hash = hasher_(key);
+    const shard& s = shard_of(hash);
+    read_lock lock(s.mutex);
+    auto it = s.table.find_hash(hash, key);
+    if (it == s.table.end()) {
+      return std::nullopt;
+    }
+    return it->get_value().second;
+  }
+
+  // （2）visit：键存在时在共享锁内调用 fn(const mapped_type&)，避免拷贝
+  template <class F>
+  bool visit(const key_type& key, F&& fn) const {
+    size_t hash = hasher_(key);
+    const shard& s = shard_of(hash);
+    read_lock lock(s.mutex);
+    auto it = s.table.find_hash(hash, key);
+    if (it == s.table.end()) {
+      return false;
+    }
+    const mapped_type& mapped = it->get_value().second;
+    fn(mapped);
+    return true;
+  }
+
+  bool contains(const key_type& key) const {
+    size_t hash = hasher_(key);
+    const shard& s = shard_of(hash);
+    read_lock lock(s.mutex);
+    return s.table.find_hash(hash, key) != s.table.end();
+  }
+
+  size_type count(const key_type& key) const { return contains(key) ? 1 : 0; }
+
+  // -------------------------- 修改 --------------------------
+  // （1）insert：键不存在时插入，返回是否插入
+  bool insert(const value_type& value) {
+    size_t hash = hasher_(value.first);
+    shard& s = shard_of(hash);
+    write_lock lock(s.mutex);
+    return s.table.emplace_unique_key_hash(hash, value.first, value).second;
+  }
+
+  bool insert(value_type&& value) {
+    size_t hash = hasher_(value.first);
+    shard& s = shard_of(hash);
+    write_lock lock(s.mutex);
+    return s.table
+        .emplace_unique_key_hash(hash, value.first, std::move(value))
+        .second;
+  }
+
+  // （2）try_emplace：键不存在时用 args 构造 mapped_type，命中时不构造
+  template <class... Args>
+  bool try_emplace(const key_type& key, Args&&... args) {
+    size_t hash = hasher_(key);
+    shard& s = shard_of(hash);
+    write_lock lock(s.mutex);
+    return s.table
+        .emplace_unique_key_hash(
+            hash, key, std::piecewise_construct, std::forward_as_tuple(key),
+            std::forward_as_tuple(std::forward<Args>(args)...))
+        .second;
+  }
+
+  // （3）insert_or_assign：不存在时插入，存在时赋值；返回是否插入
+  template <class M>
+  bool insert_or_assign(const key_type& key, M&& obj) {
+    size_t hash = hasher_(key);
+    shard& s = shard_of(hash);
+    write_lock lock(s.mutex);
+    auto r = s.table.emplace_unique_key_hash(
+        hash, key, std::piecewise_construct, std::forward_as_tuple(key),
+        std::forward_as_tuple(std::forward<M>(obj)));
+    if (!r.second) {
+      r.first->get_value().second = std::forward<M>(obj);
+    }
+    return r.second;
+  }
+
+  // （4）update：键存在时在独占锁内调用 fn(mapped_type&)，返回键是否存在
+  template <class F>
+  bool update(const key_type& key, F&& fn) {
+    size_t hash = hasher_(key);
+    shard& s = shard_of(hash);
+    write_lock lock(s.mutex);
+    auto it = s.table.find_hash(hash, key);
+    if (it == s.table.end()) {
+      return false;
+    }
+    fn(it->get_value().second);
+    return true;
+  }
+
+  // （5）erase：返回删除的元素个数（0 或 1）
+  size_type erase(const key_type& key) {
+    size_t hash = hasher_(key);
+    shard& s = shard_of(hash);
+    write_lock lock(s.mutex);
+    return s.table.erase_unique_hash(hash, key);
+  }
+
+  void clear() {
+    for (size_type i = 0; i < shard_count_; ++i) {
+      write_lock lock(shards_[i].mutex);
+      shards_[i].table.clear();
+    }
+  }
+
+  // -------------------------- 遍历 --------------------------
+  // 逐个分片加锁调用 fn(const value_type&)；其他线程的修改可能出现在
+  // 尚未遍历到的分片中，但不会看到某个分片的中间状态
+  template <class F>
+  void for_each(F&& fn) const {
+    for (size_type i = 0; i < shard_count_; ++i) {
+      read_lock lock(shards_[i].mutex);
+      for (auto it = shards_[i].table.begin(); it != shards_[i].table.end();
+           ++it) {
+        const value_type& value = it->get_value();
+        fn(value);
+      }
+    }
+  }
+
+  // 独占锁版本：fn(value_type&) 可以修改 mapped_type
+  template <class F>
+  void for_each(F&& fn) {
+    for (size_type i = 0; i < shard_count_; ++i) {
+      write_lock lock(shards_[i].mutex);
+      for (auto it = shards_[i].table.begin(); it != shards_[i].table.end();
+           ++it) {
+        fn(it->get_value());
+      }
+    }
+  }
+
+  // -------------------------- 容量 --------------------------
+  // 各分片分别加锁求和，并发修改时只是近似值
+  size_type size() const {
+    size_type n = 0;
+    for (size_type i = 0; i < shard_count_; ++i) {
+      read_lock lock(shards_[i].mutex);
+      n += shards_[i].table.size();
+    }
+    return n;
+  }
+
+  bool empty() const { return size() == 0; }
+
+  // 按元素个数均分到各分片预留空间
+  void reserve(size_type n) {
+    size_type per_shard = (n + shard_count_ - 1) / shard_count_;
+    for (size_type i = 0; i < shard_count_; ++i) {
+      write_lock lock(shards_[i].mutex);
+      shards_[i].table.reserve_unique(per_shard);
+    }
+  }
+
+  // 各分片的扩容改为渐进式，缩短持有写锁的最长时间（见 hash_table）
+  void set_incremental_rehash(bool enable) {
+    for (size_type i = 0; i < shard_count_; ++i) {
+      write_lock lock(shards_[i].mutex);
+      shards_[i].table.set_incremental_rehash(enable);
+    }
+  }
+
+  size_type shard_count() const noexcept { return shard_count_; }
+
+  hasher hash_function() const { return hasher_.hash_function(); }
+
+ private:
+  // 默认分片数：硬件线程数的 4 倍，降低两个线程落在同一分片上的概率
+  static size_type default_shard_count() {
+    size_type threads = std::thread::hardware_concurrency();
+    return threads == 0 ? 16 : threads * 4;
+  }
+
+  // 用混合后哈希值的高位选分片；分片内的桶下标由低位决定，两者互不相关
+  size_type shard_index(size_t hash) const noexcept {
+    if (shard_bits_ == 0) {
+      return 0;
+    }
+    return static_cast<size_type>(
+        hash_mix(hash) >> (std::numeric_limits<size_t>::digits - shard_bits_));
+  }
+
+  shard& shard_of(size_t hash) noexcept { return shards_[shard_index(hash)]; }
+
+  const shard& shard_of(size_t hash) const noexcept {
+    return shards_[shard_index(hash)];
+  }
+
+  void destroy_shards(size_type n) noexcept {
+    for (size_type i = 0; i < n; ++i) {
+      shards_[i].~shard();
+    }
+    std::allocator<shard>().deallocate(shards_, shard_count_);
+  }
+
+  hasher_adapter hasher_;
+  shard* shards_ = nullptr;
+  size_type shard_count_ = 0;
+  unsigned shard_bits_ = 0;
+};
+
+}  // namespace mystl
+
+#endif  // TINYSTL_CONCURRENT_UNORDERED_MAP_H_
@@ -2,6 +2,8 @@
 #define TINYSTL_DEQUE_H
 
 #include <mystl/__memory/split_buffer.h>
+#include <mystl/__memory/uninitialized_algorithms.h>
+#include <mystl/__type_traits/is_trivially_relocatable.h>
 #include <mystl/__iterator/iterator_traits.h>
 #include <mystl/__type_traits/enable_if.h>
 #include <mystl/__type_traits/is_same.h>
@@ -345,6 +347,21 @@ class deque {
   void shrink_to_fit() noexcept;
   bool empty() const noexcept { return size() == 0; }
 
+  // 内存占用：块中未使用的位置计入 slack，块映射（map_）整体计入 overhead
+  memory_footprint memory_usage() const noexcept {
+    size_type blocks = map_.size();
+    size_type block_bytes = static_cast<size_type>(block_size) * sizeof(value_type);
+    memory_footprint f;
+    f.payload_bytes = size_ * sizeof(value_type);
+    f.slack_bytes = blocks * block_bytes - f.payload_bytes;
+    f.overhead_bytes = map_.capacity() * sizeof(pointer);
+    f.rounding_bytes =
+        blocks * allocation_rounding<allocator_type>::bytes(block_size) +
+        allocation_rounding<pointer_allocator>::bytes(map_.capacity());
+    f.allocations = blocks + (map_.capacity() != 0 ? 1 : 0);
+    return f;
+  }
+
   // element access:
   reference operator[](size_type i) noexcept;
   const_reference operator[](size_type i) const noexcept;
@@ -530,12 +547,18 @@ void deque<Tp, Allocator>::assign(InputIterator f, InputIterator l) {
 
 template <class Tp, class Allocator>
 void deque<Tp, Allocator>::assign(size_type n, const value_type& v) {
+  // deque_iterator 使用 mystl 的迭代器标签，不能交给 std::fill_n
+  iterator i = begin();
   if (n > size()) {
-    std::fill_n(begin(), size(), v);
+    for (iterator e = end(); i != e; ++i)
+      *i = v;
     n -= size();
     append(n, v);
-  } else
-    erase_to_end(std::fill_n(begin(), n, v));
+  } else {
+    for (size_type k = 0; k < n; ++k, (void)++i)
+      *i = v;
+    erase_to_end(i);
+  }
 }
 
 template <class Tp, class Allocator>
@@ -801,8 +824,9 @@ void deque<Tp, Allocator>::add_front_capacity(size_type n) {
       buf.emplace_back(map_.back());
       map_.pop_back();
     }
-    for (map_pointer i = map_.begin(); i != map_.end(); ++i)
-      buf.emplace_back(*i);
+    // 块指针整体 memcpy 到新 map，块本身和其中的元素都不移动
+    buf.end_ = mystl::uninitialized_relocate(map_.begin_, map_.end_, buf.end_);
+    map_.end_ = map_.begin_;
     std::swap(map_.first_, buf.first_);
     std::swap(map_.begin_, buf.begin_);
     std::swap(map_.end_, buf.end_);
@@ -866,8 +890,9 @@ void deque<Tp, Allocator>::add_back_capacity(size_type n) {
       buf.emplace_back(map_.front());
       map_.pop_front();
     }
-    for (map_pointer i = map_.end(); i != map_.begin();)
-      buf.emplace_front(*--i);
+    buf.begin_ -= map_.size();
+    mystl::uninitialized_relocate(map_.begin_, map_.end_, buf.begin_);
+    map_.end_ = map_.begin_;
     std::swap(map_.first_, buf.first_);
     std::swap(map_.begin_, buf.begin_);
     std::swap(map_.end_, buf.end_);
@@ -969,6 +994,11 @@ bool deque<Tp, Allocator>::maybe_remove_back_spare(bool keep_one) {
   return false;
 }
 
+// 元素存放在堆上的块中，对象本身只有块映射、起点、大小和分配器
+template <class Tp, class Allocator>
+struct is_trivially_relocatable<deque<Tp, Allocator>>
+    : public is_trivially_relocatable<Allocator> {};
+
 }  // namespace mystl
 
 // 为 std::iterator_traits 提供特化，使 std::reverse_iterator 能够识别我们的迭代器
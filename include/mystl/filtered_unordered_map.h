@@ -0,0 +1,432 @@
+#ifndef TINYSTL_FILTERED_UNORDERED_MAP_H_
+#define TINYSTL_FILTERED_UNORDERED_MAP_H_
+
+#include <algorithm>         // for fill, max, min
+#include <cmath>             // for ceil, log, log2, lround
+#include <cstddef>           // for size_t
+#include <cstdint>           // for uint64_t
+#include <functional>        // for hash, equal_to
+#include <initializer_list>  // for initializer_list
+#include <memory>            // for allocator
+#include <stdexcept>         // for out_of_range, invalid_argument
+#include <type_traits>       // for enable_if_t, is_floating_point_v
+#include <utility>           // for pair, move, forward, swap
+#include <vector>            // for vector
+#include "__functional/hash.h"  // for hash_int
+#include "unordered_map.h"
+
+namespace mystl {
+
+// ============================================================================
+// blocked_bloom_filter：按缓存行分块的布隆过滤器
+// ============================================================================
+// 每个键的 k 个位都落在同一个 64 字节的块里，查询最多一次缓存未命中。
+// 键以调用方算好的哈希值表示，内部再混合一次，恒等映射的 std::hash<int>
+// 也可以直接使用。不支持删除：删除的键留在过滤器中只会提高误判率，
+// 不会漏报。未分配（默认构造）时认为任何键都可能存在。
+class blocked_bloom_filter {
+ public:
+  static constexpr unsigned max_hashes = 16;
+
+  blocked_bloom_filter() noexcept = default;
+
+  blocked_bloom_filter(size_t expected, double false_positive_rate) {
+    if (!(false_positive_rate > 0.0 && false_positive_rate < 1.0)) {
+      throw std::invalid_argument(
+          "tinystl::blocked_bloom_filter: false positive rate must be in "
+          "(0, 1)");
+    }
+    // 标准布隆过滤器取 k = log2(1/p)、每键 k/ln2 位；分块后各块负载不均，
+    // 多给 20% 的位才能接近目标误判率
+    long k = std::lround(-std::log2(false_positive_rate));
+    hashes_ = static_cast<unsigned>(
+        std::min<long>(std::max<long>(k, 1), max_hashes));
+    double bits_per_key = hashes_ / std::log(2.0) * 1.2;
+    double keys = static_cast<double>(std::max<size_t>(expected, 1));
+    double bits = std::ceil(keys * bits_per_key);
+    blocks_.resize(static_cast<size_t>(bits) / block_bits + 1);
+  }
+
+  void insert(size_t hash) noexcept {
+    if (blocks_.empty()) {
+      return;
+    }
+    uint64_t x = hash_int(hash);
+    block& b = blocks_[block_of(x)];
+    for (unsigned i = 0; i < hashes_; ++i) {
+      unsigned bit = next_bit(x);
+      b.words[bit >> 6] |= uint64_t(1) << (bit & 63);
+    }
+  }
+
+  bool may_contain(size_t hash) const noexcept {
+    if (blocks_.empty()) {
+      return true;
+    }
+    uint64_t x = hash_int(hash);
+    const block& b = blocks_[block_of(x)];
+    for (unsigned i = 0; i < hashes_; ++i) {
+      unsigned bit = next_bit(x);
+      if ((b.words[bit >> 6] & (uint64_t(1) << (bit & 63))) == 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // 清空所有位，大小不变
+  void clear() noexcept { std::fill(blocks_.begin(), blocks_.end(), block()); }
+
+  size_t bytes() const noexcept { return blocks_.size() * sizeof(block); }
+  unsigned hash_count() const noexcept { return hashes_; }
+
+  void swap(blocked_bloom_filter& other) noexcept {
+    blocks_.swap(other.blocks_);
+    std::swap(hashes_, other.hashes_);
+  }
+
+ private:
+  static constexpr size_t block_bits = 512;
+
+  struct alignas(64) block {
+    uint64_t words[block_bits / 64] = {};
+  };
+
+  // 块由混合值的高位选出（乘法取高 64 位，块数不必是 2 的幂）
+  size_t block_of(uint64_t x) const noexcept {
+    return static_cast<size_t>(hash_mulhi64(x, blocks_.size()));
+  }
+
+  // 每次乘以奇数常数后取最高 9 位作为块内的位下标
+  static unsigned next_bit(uint64_t& x) noexcept {
+    x *= 0x9e3779b97f4a7c15ULL;
+    return static_cast<unsigned>(x >> 55);
+  }
+
+  std::vector<block> blocks_;
+  unsigned hashes_ = 0;
+};
+
+// 过滤器的运行时统计：filtered_unordered_map::stats() 的返回值
+struct filter_stats {
+  size_t lookups = 0;          // 经过过滤器的查找次数
+  size_t filtered = 0;         // 过滤器判定不存在、直接返回的次数
+  size_t false_positives = 0;  // 过滤器放行但表中没有的次数
+  double filter_hit_rate = 0.0;  // filtered / lookups
+  // 实测误判率：false_positives / (filtered + false_positives)，即不存在的键
+  // 中被过滤器放行的比例
+  double observed_false_positive_rate = 0.0;
+
+  size_t filter_bytes = 0;
+  size_t filter_capacity = 0;  // 重建前最多加入的键数
+  unsigned filter_hashes = 0;
+};
+
+// ============================================================================
+// filtered_unordered_map：带布隆过滤器前置的 unordered_map
+// ============================================================================
+// 适合查找大多不命中的场景（黑名单、去重前的存在性检查）：查找先算一次
+// 哈希值查过滤器，判定不存在时直接返回，不访问桶数组和节点；放行时把同一
+// 哈希值交给 unordered_map::find_hash，不再重复计算。
+//
+// 过滤器的容量按元素个数增长：自上次重建以来加入过滤器的键数超过容量时，
+// 按当前元素个数的两倍重建（重新计算所有键的哈希值），均摊 O(1)。删除的键
+// 不从过滤器中清除，在下一次重建前只会使误判率略高，不会漏报；clear()
+// 清空过滤器。重建时内存不足则继续使用旧过滤器，下次插入再尝试。
+//
+// 增删只能通过本类的接口进行，map() 只读；迭代器与 unordered_map 相同。
+// 查找（find、count、contains、at）更新 stats() 中的计数器，
+// 计数器不是原子的，与容器本身一样不能在多个线程中同时修改。
+template <class Key, class T, class Hash = std::hash<Key>,
+          class KeyEqual = std::equal_to<Key>,
+          class Allocator = std::allocator<std::pair<const Key, T>>>
+class filtered_unordered_map {
+ public:
+  using map_type = unordered_map<Key, T, Hash, KeyEqual, Allocator>;
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = typename map_type::iterator;
+  using const_iterator = typename map_type::const_iterator;
+
+  static constexpr double default_false_positive_rate = 0.01;
+  static constexpr size_type min_filter_capacity = 64;
+
+  // -------------------------- 构造 --------------------------
+  filtered_unordered_map() : filtered_unordered_map(0) {}
+
+  // expected 为预计元素个数，false_positive_rate 为过滤器的目标误判率。
+  // 与其他容器一样元素个数在前
+  explicit filtered_unordered_map(
+      size_type expected,
+      double false_positive_rate = default_false_positive_rate)
+      : false_positive_rate_(false_positive_rate) {
+    expected = std::max(expected, min_filter_capacity);
+    blocked_bloom_filter(expected, false_positive_rate).swap(filter_);
+    capacity_ = expected;
+    map_.reserve(expected);
+  }
+
+  // 只传一个浮点数多半是把误判率当成了第一个参数，拒绝编译
+  template <class F, std::enable_if_t<std::is_floating_point_v<F>, int> = 0>
+  explicit filtered_unordered_map(F) = delete;
+
+  template <class InputIt>
+  filtered_unordered_map(
+      InputIt first, InputIt last,
+      double false_positive_rate = default_false_positive_rate)
+      : filtered_unordered_map(0, false_positive_rate) {
+    insert(first, last);
+  }
+
+  filtered_unordered_map(
+      std::initializer_list<value_type> il,
+      double false_positive_rate = default_false_positive_rate)
+      : filtered_unordered_map(il.size(), false_positive_rate) {
+    insert(il.begin(), il.end());
+  }
+
+  // -------------------------- 容量与迭代器 --------------------------
+  bool empty() const noexcept { return map_.empty(); }
+  size_type size() const noexcept { return map_.size(); }
+
+  iterator begin() noexcept { return map_.begin(); }
+  const_iterator begin() const noexcept { return map_.begin(); }
+  const_iterator cbegin() const noexcept { return map_.cbegin(); }
+  iterator end() noexcept { return map_.end(); }
+  const_iterator end() const noexcept { return map_.end(); }
+  const_iterator cend() const noexcept { return map_.cend(); }
+
+  // -------------------------- 查找 --------------------------
+  iterator find(const key_type& key) {
+    size_t h = map_.hash_function()(key);
+    if (!probe(h)) {
+      return map_.end();
+    }
+    iterator it = map_.find_hash(h, key);
+    false_positives_ += it == map_.end();
+    return it;
+  }
+
+  const_iterator find(const key_type& key) const {
+    size_t h = map_.hash_function()(key);
+    if (!probe(h)) {
+      return map_.end();
+    }
+    const_iterator it = map_.find_hash(h, key);
+    false_positives_ += it == map_.end();
+    return it;
+  }
+
+  size_type count(const key_type& key) const {
+    return static_cast<size_type>(find(key) != end());
+  }
+
+  bool contains(const key_type& key) const { return find(key) != end(); }
+
+  mapped_type& at(const key_type& key) {
+    iterator it = find(key);
+    if (it == end()) {
+      throw std::out_of_range(
+          "tinystl::filtered_unordered_map::at: key not found");
+    }
+    return it->second;
+  }
+
+  const mapped_type& at(const key_type& key) const {
+    const_iterator it = find(key);
+    if (it == end()) {
+      throw std::out_of_range(
+          "tinystl::filtered_unordered_map::at: key not found");
+    }
+    return it->second;
+  }
+
+  // 访问或插入：插入不经过过滤器，不计入查找统计
+  mapped_type& operator[](const key_type& key) {
+    return try_emplace(key).first->second;
+  }
+
+  mapped_type& operator[](key_type&& key) {
+    return try_emplace(std::move(key)).first->second;
+  }
+
+  // -------------------------- 插入 --------------------------
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return note_insert(map_.insert(value));
+  }
+
+  std::pair<iterator, bool> insert(value_type&& value) {
+    return note_insert(map_.insert(std::move(value)));
+  }
+
+  template <class InputIt>
+  void insert(InputIt first, InputIt last) {
+    for (; first != last; ++first) {
+      insert(*first);
+    }
+  }
+
+  void insert(std::initializer_list<value_type> il) {
+    insert(il.begin(), il.end());
+  }
+
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    return note_insert(map_.emplace(std::forward<Args>(args)...));
+  }
+
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args) {
+    return note_insert(map_.try_emplace(key, std::forward<Args>(args)...));
+  }
+
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args) {
+    return note_insert(
+        map_.try_emplace(std::move(key), std::forward<Args>(args)...));
+  }
+
+  template <class M>
+  std::pair<iterator, bool> insert_or_assign(const key_type& key, M&& obj) {
+    return note_insert(map_.insert_or_assign(key, std::forward<M>(obj)));
+  }
+
+  template <class M>
+  std::pair<iterator, bool> insert_or_assign(key_type&& key, M&& obj) {
+    return note_insert(
+        map_.insert_or_assign(std::move(key), std::forward<M>(obj)));
+  }
+
+  // -------------------------- 删除 --------------------------
+  // 键留在过滤器中，直到下一次重建或 clear()
+  iterator erase(const_iterator pos) { return map_.erase(pos); }
+  iterator erase(iterator pos) { return map_.erase(pos); }
+  size_type erase(const key_type& key) { return map_.erase(key); }
+
+  void clear() noexcept {
+    map_.clear();
+    filter_.clear();
+    added_ = 0;
+  }
+
+  // 预留 n 个元素的空间，过滤器一并按 n 重建
+  void reserve(size_type n) {
+    map_.reserve(n);
+    if (n > capacity_) {
+      rebuild(n);
+    }
+  }
+
+  void swap(filtered_unordered_map& other) noexcept {
+    using std::swap;
+    map_.swap(other.map_);
+    filter_.swap(other.filter_);
+    swap(false_positive_rate_, other.false_positive_rate_);
+    swap(capacity_, other.capacity_);
+    swap(added_, other.added_);
+    swap(lookups_, other.lookups_);
+    swap(filtered_, other.filtered_);
+    swap(false_positives_, other.false_positives_);
+  }
+
+  // -------------------------- 过滤器与统计 --------------------------
+  double false_positive_rate() const noexcept { return false_positive_rate_; }
+
+  filter_stats stats() const noexcept {
+    filter_stats s;
+    s.lookups = lookups_;
+    s.filtered = filtered_;
+    s.false_positives = false_positives_;
+    if (lookups_ > 0) {
+      s.filter_hit_rate = static_cast<double>(filtered_) / lookups_;
+    }
+    if (filtered_ + false_positives_ > 0) {
+      s.observed_false_positive_rate =
+          static_cast<double>(false_positives_) /
+          (filtered_ + false_positives_);
+    }
+    s.filter_bytes = filter_.bytes();
+    s.filter_capacity = capacity_;
+    s.filter_hashes = filter_.hash_count();
+    return s;
+  }
+
+  void reset_stats() noexcept {
+    lookups_ = 0;
+    filtered_ = 0;
+    false_positives_ = 0;
+  }
+
+  const map_type& map() const noexcept { return map_; }
+  hasher hash_function() const { return map_.hash_function(); }
+  key_equal key_eq() const { return map_.key_eq(); }
+
+ private:
+  bool probe(size_t h) const noexcept {
+    ++lookups_;
+    bool pass = filter_.may_contain(h);
+    filtered_ += !pass;
+    return pass;
+  }
+
+  std::pair<iterator, bool> note_insert(std::pair<iterator, bool> r) {
+    if (r.second) {
+      size_t h = map_.hash_function()(r.first->first);
+      if (++added_ <= capacity_ ||
+          !try_rebuild(std::max(min_filter_capacity, 2 * size()))) {
+        filter_.insert(h);
+      }
+    }
+    return r;
+  }
+
+  // 按容量 capacity 重新生成过滤器，加入现有的所有键
+  void rebuild(size_type capacity) {
+    blocked_bloom_filter filter(capacity, false_positive_rate_);
+    hasher hf = map_.hash_function();
+    for (const value_type& kv : map_) {
+      filter.insert(hf(kv.first));
+    }
+    filter_.swap(filter);
+    capacity_ = capacity;
+    added_ = size();
+  }
+
+  bool try_rebuild(size_type capacity) noexcept {
+    try {
+      rebuild(capacity);
+      return true;
+    } catch (...) {
+      return false;
+    }
+  }
+
+  map_type map_;
+  blocked_bloom_filter filter_;
+  double false_positive_rate_;
+  size_type capacity_ = 0;  // 重建前最多加入过滤器的键数
+  size_type added_ = 0;     // 自上次重建以来加入过滤器的键数（含已删除的）
+
+  mutable size_type lookups_ = 0;
+  mutable size_type filtered_ = 0;
+  mutable size_type false_positives_ = 0;
+};
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+void swap(
+    filtered_unordered_map<Key, T, Hash, KeyEqual, Allocator>& a,
+    filtered_unordered_map<Key, T, Hash, KeyEqual, Allocator>& b) noexcept {
+  a.swap(b);
+}
+
+}  // namespace mystl
+
+#endif  // TINYSTL_FILTERED_UNORDERED_MAP_H_
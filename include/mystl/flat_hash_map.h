@@ -0,0 +1,358 @@
+#ifndef TINYSTL_FLAT_HASH_MAP_H_
+#define TINYSTL_FLAT_HASH_MAP_H_
+
+#include <cstddef>           // for size_t, ptrdiff_t
+#include <functional>        // for hash, equal_to
+#include <initializer_list>  // for initializer_list
+#include <memory>            // for allocator
+#include <stdexcept>         // for out_of_range
+#include <tuple>             // for forward_as_tuple
+#include <type_traits>       // for is_nothrow_default_constructible_v, is_nothrow_move_constructible_v
+#include <utility>           // for pair, move, forward, piecewise_construct
+#include "__flat_hash_table.h"
+#include "unordered_map.h"  // for unordered_map_hasher, unordered_map_key_equal
+
+namespace mystl {
+
+// flat_hash_map：基于开放寻址（Swiss table）的哈希映射
+// 接口与 unordered_map 保持一致，但元素直接存放在连续的槽位数组中，
+// 查找时先用 SSE2 一次比较 16 个控制字节，命中后才访问槽位。
+// 代价是没有指针稳定性：rehash 会移动元素，使迭代器、指针和引用失效；
+// 也不提供桶接口（bucket / bucket_size / 局部迭代器）。
+template <class Key, class T, class Hash = std::hash<Key>,
+          class KeyEqual = std::equal_to<Key>,
+          class Allocator = std::allocator<std::pair<const Key, T>>>
+class flat_hash_map {
+ public:
+  // -------------------------- 类型别名 --------------------------
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+  using size_type = typename std::allocator_traits<Allocator>::size_type;
+  using difference_type =
+      typename std::allocator_traits<Allocator>::difference_type;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = typename std::allocator_traits<Allocator>::pointer;
+  using const_pointer =
+      typename std::allocator_traits<Allocator>::const_pointer;
+
+ private:
+  // -------------------------- 底层哈希表相关类型 --------------------------
+  // （1）槽位中存储的值：封装 value_type，供适配器提取键
+  struct slot_value {
+    value_type data_;
+
+    slot_value(const value_type& val) : data_(val) {}
+    slot_value(value_type&& val) : data_(std::move(val)) {}
+
+    slot_value(const slot_value& other) = default;
+
+    // rehash 搬移槽位时连键一起移动，避免 const Key 被迫拷贝
+    slot_value(slot_value&& other) noexcept(
+        std::is_nothrow_move_constructible_v<key_type> &&
+        std::is_nothrow_move_constructible_v<mapped_type>)
+        : data_(std::move(const_cast<key_type&>(other.data_.first)),
+                std::move(other.data_.second)) {}
+
+    template <class... Args>
+    slot_value(Args&&... args) : data_(std::forward<Args>(args)...) {}
+
+    const key_type& get_key() const noexcept { return data_.first; }
+
+    value_type& get_value() noexcept { return data_; }
+    const value_type& get_value() const noexcept { return data_; }
+  };
+
+  // （2）复用 unordered_map 的哈希与键比较适配器
+  using hasher_adapter =
+      unordered_map_hasher<key_type, slot_value, hasher, key_equal>;
+  using key_equal_adapter =
+      unordered_map_key_equal<key_type, slot_value, key_equal, hasher>;
+
+  // （3）重新绑定分配器
+  using slot_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<slot_value>;
+
+  // （4）底层开放寻址表
+  using base_hash_table = mystl::flat_hash_table<slot_value, hasher_adapter,
+                                                 key_equal_adapter,
+                                                 slot_allocator>;
+
+  base_hash_table table_;
+
+ public:
+  // -------------------------- 迭代器类型（复用 unordered_map 的迭代器适配器）--------------------------
+  using iterator = hash_map_iterator<typename base_hash_table::iterator>;
+  using const_iterator =
+      hash_map_const_iterator<typename base_hash_table::const_iterator>;
+
+  // -------------------------- 构造函数 --------------------------
+  flat_hash_map() noexcept(
+      std::is_nothrow_default_constructible_v<hasher_adapter> &&
+      std::is_nothrow_default_constructible_v<key_equal_adapter> &&
+      std::is_nothrow_default_constructible_v<slot_allocator>)
+      : table_() {}
+
+  explicit flat_hash_map(size_type bucket_count, const hasher& hf = hasher(),
+                         const key_equal& ke = key_equal(),
+                         const allocator_type& alloc = allocator_type())
+      : table_(hf, ke, slot_allocator(alloc)) {
+    table_.rehash_unique(bucket_count);
+  }
+
+  template <class InputIterator>
+  flat_hash_map(InputIterator first, InputIterator last,
+                size_type bucket_count = 0, const hasher& hf = hasher(),
+                const key_equal& ke = key_equal(),
+                const allocator_type& alloc = allocator_type())
+      : table_(hf, ke, slot_allocator(alloc)) {
+    if (bucket_count > 0) {
+      table_.rehash_unique(bucket_count);
+    }
+    insert(first, last);
+  }
+
+  flat_hash_map(std::initializer_list<value_type> il,
+                size_type bucket_count = 0, const hasher& hf = hasher(),
+                const key_equal& ke = key_equal(),
+                const allocator_type& alloc = allocator_type())
+      : flat_hash_map(il.begin(), il.end(), bucket_count, hf, ke, alloc) {}
+
+  flat_hash_map(const flat_hash_map& other) = default;
+  flat_hash_map(flat_hash_map&& other) noexcept = default;
+
+  ~flat_hash_map() = default;
+
+  // -------------------------- 赋值运算符 --------------------------
+  flat_hash_map& operator=(const flat_hash_map& other) = default;
+  flat_hash_map& operator=(flat_hash_map&& other) noexcept = default;
+
+  flat_hash_map& operator=(std::initializer_list<value_type> il) {
+    table_.clear();
+    insert(il.begin(), il.end());
+    return *this;
+  }
+
+  // -------------------------- 元素访问 --------------------------
+  mapped_type& operator[](const key_type& key) {
+    auto [base_it, inserted] = table_.emplace_unique_key_args(
+        key, std::piecewise_construct, std::forward_as_tuple(key),
+        std::forward_as_tuple());
+    return iterator(base_it)->second;
+  }
+
+  mapped_type& operator[](key_type&& key) {
+    auto [base_it, inserted] = table_.emplace_unique_key_args(
+        key, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+        std::forward_as_tuple());
+    return iterator(base_it)->second;
+  }
+
+  mapped_type& at(const key_type& key) {
+    auto it = find(key);
+    if (it == end()) {
+      throw std::out_of_range("tinystl::flat_hash_map::at: key not found");
+    }
+    return it->second;
+  }
+
+  const mapped_type& at(const key_type& key) const {
+    auto it = find(key);
+    if (it == end()) {
+      throw std::out_of_range("tinystl::flat_hash_map::at: key not found");
+    }
+    return it->second;
+  }
+
+  template <class K, class = enable_transparent_t<hasher, key_equal, K>>
+  mapped_type& at(const K& key) {
+    auto it = find(key);
+    if (it == end()) {
+      throw std::out_of_range("tinystl::flat_hash_map::at: key not found");
+    }
+    return it->second;
+  }
+
+  template <class K, class = enable_transparent_t<hasher, key_equal, K>>
+  const mapped_type& at(const K& key) const {
+    auto it = find(key);
+    if (it == end()) {
+      throw std::out_of_range("tinystl::flat_hash_map::at: key not found");
+    }
+    return it->second;
+  }
+
+  // -------------------------- 插入 --------------------------
+  // 先用键探测，只有未命中时才在槽位中构造 value_type
+  std::pair<iterator, bool> insert(const value_type& val) {
+    auto [base_it, inserted] = table_.emplace_unique_key_args(val.first, val);
+    return {iterator(base_it), inserted};
+  }
+
+  std::pair<iterator, bool> insert(value_type&& val) {
+    auto [base_it, inserted] =
+        table_.emplace_unique_key_args(val.first, std::move(val));
+    return {iterator(base_it), inserted};
+  }
+
+  template <class InputIterator>
+  void insert(InputIterator first, InputIterator last) {
+    for (; first != last; ++first) {
+      auto&& v = *first;
+      table_.emplace_unique_key_args(v.first, std::forward<decltype(v)>(v));
+    }
+  }
+
+  void insert(std::initializer_list<value_type> il) {
+    table_.reserve_unique(size() + il.size());
+    insert(il.begin(), il.end());
+  }
+
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    auto [base_it, inserted] =
+        table_.emplace_unique(std::forward<Args>(args)...);
+    return {iterator(base_it), inserted};
+  }
+
+  // -------------------------- 查找 --------------------------
+  iterator find(const key_type& key) { return iterator(table_.find(key)); }
+
+  const_iterator find(const key_type& key) const {
+    return const_iterator(table_.find(key));
+  }
+
+  size_type count(const key_type& key) const {
+    return table_.count_unique(key);
+  }
+
+  bool contains(const key_type& key) const { return find(key) != end(); }
+
+  // 异构查找：Hash 与 KeyEqual 均为透明时参与重载，规则同 unordered_map
+  template <class K, class = enable_transparent_t<hasher, key_equal, K>>
+  iterator find(const K& key) {
+    return iterator(table_.find(key));
+  }
+
+  template <class K, class = enable_transparent_t<hasher, key_equal, K>>
+  const_iterator find(const K& key) const {
+    return const_iterator(table_.find(key));
+  }
+
+  template <class K, class = enable_transparent_t<hasher, key_equal, K>>
+  size_type count(const K& key) const {
+    return table_.count_unique(key);
+  }
+
+  template <class K, class = enable_transparent_t<hasher, key_equal, K>>
+  bool contains(const K& key) const {
+    return find(key) != end();
+  }
+
+  // -------------------------- 删除 --------------------------
+  iterator erase(iterator pos) {
+    return iterator(table_.erase(pos.get_iterator()));
+  }
+
+  iterator erase(const_iterator pos) {
+    return iterator(table_.erase(pos.get_iterator()));
+  }
+
+  size_type erase(const key_type& key) { return table_.erase_unique(key); }
+
+  template <class K, class = enable_transparent_t<hasher, key_equal, K>,
+            std::enable_if_t<!std::is_convertible_v<const K&, iterator> &&
+                                 !std::is_convertible_v<const K&,
+                                                        const_iterator>,
+                             int> = 0>
+  size_type erase(const K& key) {
+    return table_.erase_unique(key);
+  }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    return iterator(table_.erase(first.get_iterator(), last.get_iterator()));
+  }
+
+  void clear() noexcept { table_.clear(); }
+
+  // -------------------------- 迭代器 --------------------------
+  iterator begin() noexcept { return iterator(table_.begin()); }
+  iterator end() noexcept { return iterator(table_.end()); }
+  const_iterator begin() const noexcept {
+    return const_iterator(table_.begin());
+  }
+  const_iterator end() const noexcept { return const_iterator(table_.end()); }
+  const_iterator cbegin() const noexcept {
+    return const_iterator(table_.begin());
+  }
+  const_iterator cend() const noexcept { return const_iterator(table_.end()); }
+
+  // -------------------------- 容量与负载因子 --------------------------
+  // bucket_count 返回槽位数
+  size_type bucket_count() const noexcept { return table_.bucket_count(); }
+
+  float load_factor() const noexcept { return table_.load_factor(); }
+
+  // 最大负载因子固定为 7/8
+  float max_load_factor() const noexcept { return table_.max_load_factor(); }
+
+  void rehash(size_type n) { table_.rehash_unique(n); }
+
+  void reserve(size_type n) { table_.reserve_unique(n); }
+
+  // -------------------------- 其他 --------------------------
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(table_.slot_alloc());
+  }
+
+  bool empty() const noexcept { return table_.size() == 0; }
+
+  size_type size() const noexcept { return table_.size(); }
+
+  size_type max_size() const noexcept { return table_.max_size(); }
+
+  void swap(flat_hash_map& other) noexcept { table_.swap(other.table_); }
+
+  hasher hash_function() const {
+    return table_.hash_function().hash_function();
+  }
+
+  key_equal key_eq() const { return table_.key_eq().key_eq(); }
+};
+
+// -------------------------- 非成员函数 --------------------------
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+void swap(flat_hash_map<Key, T, Hash, KeyEqual, Allocator>& lhs,
+          flat_hash_map<Key, T, Hash, KeyEqual, Allocator>&
+              rhs) noexcept(noexcept(lhs.swap(rhs))) {
+  lhs.swap(rhs);
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+bool operator==(const flat_hash_map<Key, T, Hash, KeyEqual, Allocator>& lhs,
+                const flat_hash_map<Key, T, Hash, KeyEqual, Allocator>& rhs) {
+  if (lhs.size() != rhs.size()) {
+    return false;
+  }
+  for (const auto& elem : lhs) {
+    auto it = rhs.find(elem.first);
+    if (it == rhs.end() || it->second != elem.second) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+bool operator!=(const flat_hash_map<Key, T, Hash, KeyEqual, Allocator>& lhs,
+                const flat_hash_map<Key, T, Hash, KeyEqual, Allocator>& rhs) {
+  return !(lhs == rhs);
+}
+
+}  // namespace mystl
+
+#endif  // TINYSTL_FLAT_HASH_MAP_H_
@@ -0,0 +1,276 @@
+#ifndef TINYSTL_FLAT_HASH_SET_H_
+#define TINYSTL_FLAT_HASH_SET_H_
+
+#include <cstddef>           // for size_t, ptrdiff_t
+#include <functional>        // for hash, equal_to
+#include <initializer_list>  // for initializer_list
+#include <memory>            // for allocator
+#include <type_traits>       // for is_nothrow_default_constructible_v
+#include <utility>           // for pair, move, forward
+#include "__flat_hash_table.h"
+#include "unordered_map.h"  // for unordered_map_hasher, unordered_map_key_equal
+
+namespace mystl {
+
+// flat_hash_set：基于开放寻址（Swiss table）的哈希集合
+// 与 flat_hash_map 共用 flat_hash_table，元素不可修改，
+// 因此 iterator 与 const_iterator 是同一类型。
+template <class Key, class Hash = std::hash<Key>,
+          class KeyEqual = std::equal_to<Key>,
+          class Allocator = std::allocator<Key>>
+class flat_hash_set {
+ public:
+  // -------------------------- 类型别名 --------------------------
+  using key_type = Key;
+  using value_type = Key;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+  using size_type = typename std::allocator_traits<Allocator>::size_type;
+  using difference_type =
+      typename std::allocator_traits<Allocator>::difference_type;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = typename std::allocator_traits<Allocator>::pointer;
+  using const_pointer =
+      typename std::allocator_traits<Allocator>::const_pointer;
+
+ private:
+  // -------------------------- 底层哈希表相关类型 --------------------------
+  // （1）槽位中存储的值：把键包一层，使适配器能区分“槽位值”和“键”
+  struct slot_value {
+    key_type key_;
+
+    slot_value(const slot_value& other) = default;
+    slot_value(slot_value&& other) = default;
+
+    template <class... Args>
+    slot_value(Args&&... args) : key_(std::forward<Args>(args)...) {}
+
+    const key_type& get_key() const noexcept { return key_; }
+
+    const key_type& get_value() const noexcept { return key_; }
+  };
+
+  // （2）复用 unordered_map 的哈希与键比较适配器
+  using hasher_adapter =
+      unordered_map_hasher<key_type, slot_value, hasher, key_equal>;
+  using key_equal_adapter =
+      unordered_map_key_equal<key_type, slot_value, key_equal, hasher>;
+
+  // （3）重新绑定分配器
+  using slot_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<slot_value>;
+
+  // （4）底层开放寻址表
+  using base_hash_table = mystl::flat_hash_table<slot_value, hasher_adapter,
+                                                 key_equal_adapter,
+                                                 slot_allocator>;
+
+  base_hash_table table_;
+
+ public:
+  // -------------------------- 迭代器类型 --------------------------
+  using iterator =
+      hash_map_const_iterator<typename base_hash_table::const_iterator>;
+  using const_iterator = iterator;
+
+  // -------------------------- 构造函数 --------------------------
+  flat_hash_set() noexcept(
+      std::is_nothrow_default_constructible_v<hasher_adapter> &&
+      std::is_nothrow_default_constructible_v<key_equal_adapter> &&
+      std::is_nothrow_default_constructible_v<slot_allocator>)
+      : table_() {}
+
+  explicit flat_hash_set(size_type bucket_count, const hasher& hf = hasher(),
+                         const key_equal& ke = key_equal(),
+                         const allocator_type& alloc = allocator_type())
+      : table_(hf, ke, slot_allocator(alloc)) {
+    table_.rehash_unique(bucket_count);
+  }
+
+  template <class InputIterator>
+  flat_hash_set(InputIterator first, InputIterator last,
+                size_type bucket_count = 0, const hasher& hf = hasher(),
+                const key_equal& ke = key_equal(),
+                const allocator_type& alloc = allocator_type())
+      : table_(hf, ke, slot_allocator(alloc)) {
+    if (bucket_count > 0) {
+      table_.rehash_unique(bucket_count);
+    }
+    insert(first, last);
+  }
+
+  flat_hash_set(std::initializer_list<value_type> il,
+                size_type bucket_count = 0, const hasher& hf = hasher(),
+                const key_equal& ke = key_equal(),
+                const allocator_type& alloc = allocator_type())
+      : flat_hash_set(il.begin(), il.end(), bucket_count, hf, ke, alloc) {}
+
+  flat_hash_set(const flat_hash_set& other) = default;
+  flat_hash_set(flat_hash_set&& other) noexcept = default;
+
+  ~flat_hash_set() = default;
+
+  // -------------------------- 赋值运算符 --------------------------
+  flat_hash_set& operator=(const flat_hash_set& other) = default;
+  flat_hash_set& operator=(flat_hash_set&& other) noexcept = default;
+
+  flat_hash_set& operator=(std::initializer_list<value_type> il) {
+    table_.clear();
+    insert(il.begin(), il.end());
+    return *this;
+  }
+
+  // -------------------------- 插入 --------------------------
+  std::pair<iterator, bool> insert(const value_type& val) {
+    auto [base_it, inserted] = table_.emplace_unique_key_args(val, val);
+    return {iterator(base_it), inserted};
+  }
+
+  std::pair<iterator, bool> insert(value_type&& val) {
+    auto [base_it, inserted] =
+        table_.emplace_unique_key_args(val, std::move(val));
+    return {iterator(base_it), inserted};
+  }
+
+  template <class InputIterator>
+  void insert(InputIterator first, InputIterator last) {
+    for (; first != last; ++first) {
+      insert(*first);
+    }
+  }
+
+  void insert(std::initializer_list<value_type> il) {
+    table_.reserve_unique(size() + il.size());
+    insert(il.begin(), il.end());
+  }
+
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    auto [base_it, inserted] =
+        table_.emplace_unique(std::forward<Args>(args)...);
+    return {iterator(base_it), inserted};
+  }
+
+  // -------------------------- 查找 --------------------------
+  const_iterator find(const key_type& key) const {
+    return const_iterator(table_.find(key));
+  }
+
+  size_type count(const key_type& key) const {
+    return table_.count_unique(key);
+  }
+
+  bool contains(const key_type& key) const { return find(key) != end(); }
+
+  // 异构查找：Hash 与 KeyEqual 均为透明时参与重载，规则同 unordered_map
+  template <class K, class = enable_transparent_t<hasher, key_equal, K>>
+  const_iterator find(const K& key) const {
+    return const_iterator(table_.find(key));
+  }
+
+  template <class K, class = enable_transparent_t<hasher, key_equal, K>>
+  size_type count(const K& key) const {
+    return table_.count_unique(key);
+  }
+
+  template <class K, class = enable_transparent_t<hasher, key_equal, K>>
+  bool contains(const K& key) const {
+    return find(key) != end();
+  }
+
+  // -------------------------- 删除 --------------------------
+  iterator erase(const_iterator pos) {
+    return iterator(table_.erase(pos.get_iterator()));
+  }
+
+  size_type erase(const key_type& key) { return table_.erase_unique(key); }
+
+  template <class K, class = enable_transparent_t<hasher, key_equal, K>,
+            std::enable_if_t<!std::is_convertible_v<const K&, iterator> &&
+                                 !std::is_convertible_v<const K&,
+                                                        const_iterator>,
+                             int> = 0>
+  size_type erase(const K& key) {
+    return table_.erase_unique(key);
+  }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    return iterator(table_.erase(first.get_iterator(), last.get_iterator()));
+  }
+
+  void clear() noexcept { table_.clear(); }
+
+  // -------------------------- 迭代器 --------------------------
+  const_iterator begin() const noexcept {
+    return const_iterator(table_.begin());
+  }
+  const_iterator end() const noexcept { return const_iterator(table_.end()); }
+  const_iterator cbegin() const noexcept {
+    return const_iterator(table_.begin());
+  }
+  const_iterator cend() const noexcept { return const_iterator(table_.end()); }
+
+  // -------------------------- 容量与负载因子 --------------------------
+  size_type bucket_count() const noexcept { return table_.bucket_count(); }
+
+  float load_factor() const noexcept { return table_.load_factor(); }
+
+  float max_load_factor() const noexcept { return table_.max_load_factor(); }
+
+  void rehash(size_type n) { table_.rehash_unique(n); }
+
+  void reserve(size_type n) { table_.reserve_unique(n); }
+
+  // -------------------------- 其他 --------------------------
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(table_.slot_alloc());
+  }
+
+  bool empty() const noexcept { return table_.size() == 0; }
+
+  size_type size() const noexcept { return table_.size(); }
+
+  size_type max_size() const noexcept { return table_.max_size(); }
+
+  void swap(flat_hash_set& other) noexcept { table_.swap(other.table_); }
+
+  hasher hash_function() const {
+    return table_.hash_function().hash_function();
+  }
+
+  key_equal key_eq() const { return table_.key_eq().key_eq(); }
+};
+
+// -------------------------- 非成员函数 --------------------------
+template <class Key, class Hash, class KeyEqual, class Allocator>
+void swap(flat_hash_set<Key, Hash, KeyEqual, Allocator>& lhs,
+          flat_hash_set<Key, Hash, KeyEqual, Allocator>&
+              rhs) noexcept(noexcept(lhs.swap(rhs))) {
+  lhs.swap(rhs);
+}
+
+template <class Key, class Hash, class KeyEqual, class Allocator>
+bool operator==(const flat_hash_set<Key, Hash, KeyEqual, Allocator>& lhs,
+                const flat_hash_set<Key, Hash, KeyEqual, Allocator>& rhs) {
+  if (lhs.size() != rhs.size()) {
+    return false;
+  }
+  for (const auto& key : lhs) {
+    if (!rhs.contains(key)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <class Key, class Hash, class KeyEqual, class Allocator>
+bool operator!=(const flat_hash_set<Key, Hash, KeyEqual, Allocator>& lhs,
+                const flat_hash_set<Key, Hash, KeyEqual, Allocator>& rhs) {
+  return !(lhs == rhs);
+}
+
+}  // namespace mystl
+
+#endif  // TINYSTL_FLAT_HASH_SET_H_
@@ -0,0 +1,525 @@
+#ifndef TINYSTL_FROZEN_MAP_H_
+#define TINYSTL_FROZEN_MAP_H_
+
+#include <algorithm>         // for max, sort
+#include <array>             // for array
+#include <cstddef>           // for size_t
+#include <cstdint>           // for uint32_t, uint64_t
+#include <functional>        // for hash, equal_to
+#include <initializer_list>  // for initializer_list
+#include <numeric>           // for iota
+#include <stdexcept>         // for out_of_range, invalid_argument, length_error
+#include <string_view>       // for string_view
+#include <type_traits>       // for enable_if_t, is_integral_v, is_enum_v
+#include <utility>           // for pair, move, swap, index_sequence
+#include <vector>            // for vector
+#include "unordered_map.h"
+
+namespace mystl {
+
+// frozen_map / static_frozen_map：只读的最小完美哈希映射
+// 构造时一次性为全部键求出一个最小完美哈希（hash-and-displace，CHD/PTHash 一类）：
+//   - 先按第一个哈希把键分到约 n/4 个桶；
+//   - 按桶从大到小，为每个桶搜索一个 pilot，使桶内所有键经 (哈希, pilot)
+//     再次混合后落到互不相同且尚未占用的位置；
+//   - 只有一个键的桶最后处理，直接记录一个空闲位置（pilot 最高位置 1）。
+// 元素按位置存放在恰好 n 个元素的连续数组中，没有链表也没有空槽。
+// 查找 = 计算哈希 → 读一个 pilot → 定位一个元素 → 比较一次键。
+// 构造之后不能插入、删除或修改元素。
+//
+// frozen_map 在运行期从 unordered_map 或任意范围构造；
+// static_frozen_map 可在编译期构造（见 make_frozen_map），
+// 用于替代为小型固定键集合生成的 switch 语句。
+
+// ==================== 编译期可用的哈希函数 ====================
+// std::hash 不是 constexpr，static_frozen_map 默认使用这里的哈希。
+// 支持整数、枚举和 std::string_view
+template <class Key, class = void>
+struct frozen_hash;
+
+template <class Key>
+struct frozen_hash<Key,
+                   std::enable_if_t<std::is_integral_v<Key> || std::is_enum_v<Key>>> {
+  // 整数直接返回，混合在表内部完成
+  constexpr std::size_t operator()(Key key) const noexcept {
+    return static_cast<std::size_t>(static_cast<std::uint64_t>(key));
+  }
+};
+
+template <>
+struct frozen_hash<std::string_view> {
+  // FNV-1a（64 位）
+  constexpr std::size_t operator()(std::string_view key) const noexcept {
+    std::uint64_t h = 0xcbf29ce484222325ULL;
+    for (char c : key) {
+      h ^= static_cast<unsigned char>(c);
+      h *= 0x100000001b3ULL;
+    }
+    return static_cast<std::size_t>(h);
+  }
+};
+
+namespace detail {
+
+// pilot 最高位为 1 表示低 31 位直接就是位置（单键桶）
+constexpr std::uint32_t frozen_direct_bit = 0x80000000u;
+// 多键桶最多尝试的 pilot 个数，超过后换一个种子重新构造
+constexpr std::uint32_t frozen_pilot_limit = 1u << 20;
+constexpr unsigned frozen_max_attempts = 16;
+// 位置直接编码在 pilot 的低 31 位
+constexpr std::size_t frozen_max_size = 0x7fffffffu;
+
+// MurmurHash3 的 fmix64
+constexpr std::uint64_t frozen_mix64(std::uint64_t x) noexcept {
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdULL;
+  x ^= x >> 33;
+  x *= 0xc4ceb9fe1a85ec53ULL;
+  x ^= x >> 33;
+  return x;
+}
+
+// 把 32 位随机数映射到 [0, n)，用乘法代替取模（n < 2^32）
+constexpr std::size_t frozen_reduce(std::uint64_t x32, std::size_t n) noexcept {
+  return static_cast<std::size_t>((x32 * static_cast<std::uint64_t>(n)) >> 32);
+}
+
+// 键的哈希与本次构造的种子混合，之后的分桶、定位都基于它
+constexpr std::uint64_t frozen_key_hash(std::size_t hash,
+                                        std::uint64_t seed) noexcept {
+  return frozen_mix64(static_cast<std::uint64_t>(hash) ^ seed);
+}
+
+constexpr std::size_t frozen_bucket_of(std::uint64_t hk,
+                                       std::size_t nb) noexcept {
+  return frozen_reduce(hk & 0xffffffffu, nb);
+}
+
+constexpr std::size_t frozen_slot_of(std::uint64_t hk, std::uint32_t pilot,
+                                     std::size_t n) noexcept {
+  if (pilot & frozen_direct_bit) {
+    return pilot & ~frozen_direct_bit;
+  }
+  return frozen_reduce(
+      frozen_mix64(hk ^ (pilot * 0x9e3779b97f4a7c15ULL)) >> 32, n);
+}
+
+// 平均每桶 4 个键
+constexpr std::size_t frozen_bucket_count(std::size_t n) noexcept {
+  return n / 4 + 1;
+}
+
+constexpr std::uint64_t frozen_seed(unsigned attempt) noexcept {
+  return attempt * 0xbf58476d1ce4e5b9ULL;
+}
+
+// 为 n 个键（已混合的哈希 hk[i]）求每个桶的 pilot，成功时 slot_of[i] 为
+// 键 i 的位置。start（nb + 1）、members（n）、taken（n）是临时空间。
+// 某个桶找不到 pilot 时返回 false，调用方换种子重试。
+// 只用指针和循环，运行期和编译期共用同一份实现
+constexpr bool frozen_place(const std::uint64_t* hk, std::size_t n,
+                            std::size_t nb, std::uint32_t* pilots,
+                            std::size_t* slot_of, std::size_t* start,
+                            std::size_t* members, unsigned char* taken) {
+  for (std::size_t b = 0; b <= nb; ++b) {
+    start[b] = 0;
+  }
+  for (std::size_t b = 0; b < nb; ++b) {
+    pilots[b] = 0;
+  }
+  for (std::size_t i = 0; i < n; ++i) {
+    taken[i] = 0;
+    ++start[frozen_bucket_of(hk[i], nb) + 1];
+  }
+  // 按桶分组（计数排序），start[b] .. start[b + 1] 是桶 b 的键
+  std::size_t max_size = 0;
+  for (std::size_t b = 0; b < nb; ++b) {
+    max_size = std::max(max_size, start[b + 1]);
+    start[b + 1] += start[b];
+  }
+  for (std::size_t i = 0; i < n; ++i) {
+    members[start[frozen_bucket_of(hk[i], nb)]++] = i;
+  }
+  for (std::size_t b = nb; b > 0; --b) {
+    start[b] = start[b - 1];
+  }
+  start[0] = 0;
+
+  // 大桶先放：空位越少，放下多个键越难
+  for (std::size_t size = max_size; size >= 2; --size) {
+    for (std::size_t b = 0; b < nb; ++b) {
+      if (start[b + 1] - start[b] != size) {
+        continue;
+      }
+      bool placed = false;
+      for (std::uint32_t p = 0; p < frozen_pilot_limit && !placed; ++p) {
+        std::size_t j = start[b];
+        for (; j < start[b + 1]; ++j) {
+          const std::size_t s = frozen_slot_of(hk[members[j]], p, n);
+          if (taken[s]) {
+            break;
+          }
+          taken[s] = 1;
+          slot_of[members[j]] = s;
+        }
+        if (j == start[b + 1]) {
+          pilots[b] = p;
+          placed = true;
+        } else {
+          for (std::size_t k = start[b]; k < j; ++k) {
+            taken[slot_of[members[k]]] = 0;
+          }
+        }
+      }
+      if (!placed) {
+        return false;
+      }
+    }
+  }
+
+  // 单键桶：依次取空位，直接记录位置
+  std::size_t cursor = 0;
+  for (std::size_t b = 0; b < nb; ++b) {
+    if (start[b + 1] - start[b] != 1) {
+      continue;
+    }
+    while (taken[cursor]) {
+      ++cursor;
+    }
+    taken[cursor] = 1;
+    slot_of[members[start[b]]] = cursor;
+    pilots[b] = frozen_direct_bit | static_cast<std::uint32_t>(cursor);
+  }
+  return true;
+}
+
+}  // namespace detail
+
+// ==================== frozen_map：运行期构造 ====================
+template <class Key, class T, class Hash = std::hash<Key>,
+          class KeyEqual = std::equal_to<Key>>
+class frozen_map {
+ public:
+  // -------------------------- 类型别名 --------------------------
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using const_reference = const value_type&;
+  using const_pointer = const value_type*;
+  // 元素不可修改，只提供 const 迭代器
+  using const_iterator = typename std::vector<value_type>::const_iterator;
+  using iterator = const_iterator;
+
+  // -------------------------- 构造与赋值 --------------------------
+  frozen_map() : pilots_(1, 0) {}
+
+  // 重复的键只保留第一次出现的元素（与 insert 一致）。
+  // 两个不同的键哈希值完全相同时无法分开，抛出 std::invalid_argument
+  template <class InputIt>
+  frozen_map(InputIt first, InputIt last, const hasher& hash = hasher(),
+             const key_equal& equal = key_equal())
+      : hash_(hash), equal_(equal) {
+    std::vector<std::pair<Key, T>> items;
+    for (; first != last; ++first) {
+      items.emplace_back(first->first, first->second);
+    }
+    build(items);
+  }
+
+  frozen_map(std::initializer_list<value_type> ilist,
+             const hasher& hash = hasher(),
+             const key_equal& equal = key_equal())
+      : frozen_map(ilist.begin(), ilist.end(), hash, equal) {}
+
+  template <class H, class E, class A, class P, class C>
+  explicit frozen_map(const unordered_map<Key, T, H, E, A, P, C>& map,
+                      const hasher& hash = hasher(),
+                      const key_equal& equal = key_equal())
+      : frozen_map(map.begin(), map.end(), hash, equal) {}
+
+  frozen_map(const frozen_map&) = default;
+  frozen_map(frozen_map&&) noexcept = default;
+
+  // value_type 的键是 const，不能逐个赋值，整体替换
+  frozen_map& operator=(const frozen_map& other) {
+    if (this != &other) {
+      frozen_map tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+  frozen_map& operator=(frozen_map&& other) noexcept {
+    swap(other);
+    return *this;
+  }
+
+  // -------------------------- 迭代器（按位置顺序）--------------------------
+  const_iterator begin() const noexcept { return entries_.begin(); }
+  const_iterator end() const noexcept { return entries_.end(); }
+  const_iterator cbegin() const noexcept { return entries_.cbegin(); }
+  const_iterator cend() const noexcept { return entries_.cend(); }
+
+  // -------------------------- 容量 --------------------------
+  bool empty() const noexcept { return entries_.empty(); }
+  size_type size() const noexcept { return entries_.size(); }
+
+  // -------------------------- 查找 --------------------------
+  const_iterator find(const key_type& key) const {
+    if (entries_.empty()) {
+      return end();
+    }
+    const std::uint64_t hk = detail::frozen_key_hash(hash_(key), seed_);
+    const std::size_t s = detail::frozen_slot_of(
+        hk, pilots_[detail::frozen_bucket_of(hk, pilots_.size())],
+        entries_.size());
+    return equal_(entries_[s].first, key) ? begin() + s : end();
+  }
+
+  bool contains(const key_type& key) const { return find(key) != end(); }
+
+  size_type count(const key_type& key) const { return contains(key) ? 1 : 0; }
+
+  const mapped_type& at(const key_type& key) const {
+    const_iterator it = find(key);
+    if (it == end()) {
+      throw std::out_of_range("frozen_map::at: key not found");
+    }
+    return it->second;
+  }
+
+  // -------------------------- 观察器 --------------------------
+  hasher hash_function() const { return hash_; }
+  key_equal key_eq() const { return equal_; }
+
+  // pilot 表的长度（桶数）
+  size_type bucket_count() const noexcept { return pilots_.size(); }
+
+  void swap(frozen_map& other) noexcept {
+    entries_.swap(other.entries_);
+    pilots_.swap(other.pilots_);
+    std::swap(seed_, other.seed_);
+    std::swap(hash_, other.hash_);
+    std::swap(equal_, other.equal_);
+  }
+
+ private:
+  void build(std::vector<std::pair<Key, T>>& items) {
+    // （1）计算哈希，按 (哈希, 下标) 排序后去重
+    std::vector<std::size_t> hashes(items.size());
+    for (std::size_t i = 0; i < items.size(); ++i) {
+      hashes[i] = hash_(items[i].first);
+    }
+    std::vector<std::size_t> order(items.size());
+    std::iota(order.begin(), order.end(), std::size_t(0));
+    std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+      return hashes[a] != hashes[b] ? hashes[a] < hashes[b] : a < b;
+    });
+    std::vector<std::size_t> keep;
+    keep.reserve(items.size());
+    for (std::size_t i = 0; i < order.size();) {
+      std::size_t j = i + 1;
+      for (; j < order.size() && hashes[order[j]] == hashes[order[i]]; ++j) {
+        if (!equal_(items[order[j]].first, items[order[i]].first)) {
+          throw std::invalid_argument(
+              "frozen_map: distinct keys with identical hash values");
+        }
+      }
+      keep.push_back(order[i]);
+      i = j;
+    }
+
+    const std::size_t n = keep.size();
+    if (n > detail::frozen_max_size) {
+      throw std::length_error("frozen_map: too many elements");
+    }
+
+    // （2）求最小完美哈希
+    const std::size_t nb = detail::frozen_bucket_count(n);
+    std::vector<std::uint64_t> hk(n);
+    std::vector<std::uint32_t> pilots(nb);
+    std::vector<std::size_t> slot_of(n);
+    std::vector<std::size_t> start(nb + 1);
+    std::vector<std::size_t> members(n);
+    std::vector<unsigned char> taken(n);
+    unsigned attempt = 0;
+    for (;; ++attempt) {
+      if (attempt == detail::frozen_max_attempts) {
+        throw std::invalid_argument(
+            "frozen_map: failed to build a perfect hash");
+      }
+      for (std::size_t i = 0; i < n; ++i) {
+        hk[i] = detail::frozen_key_hash(hashes[keep[i]],
+                                        detail::frozen_seed(attempt));
+      }
+      if (detail::frozen_place(hk.data(), n, nb, pilots.data(),
+                               slot_of.data(), start.data(), members.data(),
+                               taken.data())) {
+        break;
+      }
+    }
+
+    // （3）按位置顺序搬入元素
+    std::vector<std::size_t> item_at(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      item_at[slot_of[i]] = keep[i];
+    }
+    std::vector<value_type> entries;
+    entries.reserve(n);
+    for (std::size_t s = 0; s < n; ++s) {
+      entries.emplace_back(std::move(items[item_at[s]].first),
+                           std::move(items[item_at[s]].second));
+    }
+    entries_.swap(entries);
+    pilots_.swap(pilots);
+    seed_ = detail::frozen_seed(attempt);
+  }
+
+  std::vector<value_type> entries_;    // 按位置存放，恰好 size() 个
+  std::vector<std::uint32_t> pilots_;  // 每桶一个，至少一个
+  std::uint64_t seed_ = 0;
+  hasher hash_;
+  key_equal equal_;
+};
+
+template <class Key, class T, class Hash, class KeyEqual>
+void swap(frozen_map<Key, T, Hash, KeyEqual>& lhs,
+          frozen_map<Key, T, Hash, KeyEqual>& rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+// ==================== static_frozen_map：编译期构造 ====================
+// 元素个数 N 是类型的一部分，数据全部放在 std::array 中，
+// 构造和查找都是 constexpr。构造使用与 frozen_map 相同的算法；
+// 有重复键或无法构造时，常量求值中会抛出异常，从而编译失败。
+// Hash 和 KeyEqual 必须是 constexpr 可调用的（默认 frozen_hash）
+template <class Key, class T, std::size_t N, class Hash = frozen_hash<Key>,
+          class KeyEqual = std::equal_to<Key>>
+class static_frozen_map {
+  static_assert(N > 0, "static_frozen_map requires at least one element");
+  static_assert(N <= detail::frozen_max_size, "too many elements");
+
+ public:
+  // -------------------------- 类型别名 --------------------------
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using size_type = std::size_t;
+  using const_reference = const value_type&;
+  using const_iterator = const value_type*;
+  using iterator = const_iterator;
+
+ private:
+  static constexpr std::size_t bucket_count_ = detail::frozen_bucket_count(N);
+
+  struct layout {
+    std::array<std::size_t, N> item_at{};
+    std::array<std::uint32_t, bucket_count_> pilots{};
+    std::uint64_t seed = 0;
+  };
+
+ public:
+  // -------------------------- 构造 --------------------------
+  constexpr explicit static_frozen_map(const std::pair<Key, T> (&items)[N])
+      : static_frozen_map(items, make_layout(items),
+                          std::make_index_sequence<N>()) {}
+
+  // -------------------------- 迭代器（按位置顺序）--------------------------
+  constexpr const_iterator begin() const noexcept { return entries_.data(); }
+  constexpr const_iterator end() const noexcept { return entries_.data() + N; }
+
+  // -------------------------- 容量 --------------------------
+  constexpr bool empty() const noexcept { return false; }
+  constexpr size_type size() const noexcept { return N; }
+
+  // -------------------------- 查找 --------------------------
+  constexpr const_iterator find(const key_type& key) const {
+    const std::uint64_t hk = detail::frozen_key_hash(hasher()(key), seed_);
+    const std::size_t s = detail::frozen_slot_of(
+        hk, pilots_[detail::frozen_bucket_of(hk, bucket_count_)], N);
+    return key_equal()(entries_[s].first, key) ? begin() + s : end();
+  }
+
+  constexpr bool contains(const key_type& key) const {
+    return find(key) != end();
+  }
+
+  constexpr size_type count(const key_type& key) const {
+    return contains(key) ? 1 : 0;
+  }
+
+  constexpr const mapped_type& at(const key_type& key) const {
+    const_iterator it = find(key);
+    if (it == end()) {
+      throw std::out_of_range("static_frozen_map::at: key not found");
+    }
+    return it->second;
+  }
+
+  constexpr size_type bucket_count() const noexcept { return bucket_count_; }
+
+ private:
+  template <std::size_t... I>
+  constexpr static_frozen_map(const std::pair<Key, T> (&items)[N],
+                              const layout& l, std::index_sequence<I...>)
+      : entries_{{value_type(items[l.item_at[I]])...}},
+        pilots_(l.pilots),
+        seed_(l.seed) {}
+
+  static constexpr layout make_layout(const std::pair<Key, T> (&items)[N]) {
+    for (std::size_t i = 0; i < N; ++i) {
+      for (std::size_t j = i + 1; j < N; ++j) {
+        if (key_equal()(items[i].first, items[j].first)) {
+          throw std::invalid_argument("static_frozen_map: duplicate key");
+        }
+      }
+    }
+    std::array<std::uint64_t, N> hk{};
+    std::array<std::size_t, N> slot_of{};
+    std::array<std::size_t, bucket_count_ + 1> start{};
+    std::array<std::size_t, N> members{};
+    std::array<unsigned char, N> taken{};
+    layout l{};
+    for (unsigned attempt = 0; attempt < detail::frozen_max_attempts;
+         ++attempt) {
+      l.seed = detail::frozen_seed(attempt);
+      for (std::size_t i = 0; i < N; ++i) {
+        hk[i] = detail::frozen_key_hash(hasher()(items[i].first), l.seed);
+      }
+      if (detail::frozen_place(hk.data(), N, bucket_count_, l.pilots.data(),
+                               slot_of.data(), start.data(), members.data(),
+                               taken.data())) {
+        for (std::size_t i = 0; i < N; ++i) {
+          l.item_at[slot_of[i]] = i;
+        }
+        return l;
+      }
+    }
+    throw std::invalid_argument(
+        "static_frozen_map: failed to build a perfect hash");
+  }
+
+  std::array<value_type, N> entries_;
+  std::array<std::uint32_t, bucket_count_> pilots_;
+  std::uint64_t seed_;
+};
+
+// 从花括号列表构造编译期映射，N 由列表长度推导：
+//   constexpr auto colors = mystl::make_frozen_map<std::string_view, int>(
+//       {{"red", 1}, {"green", 2}, {"blue", 3}});
+//   static_assert(colors.at("green") == 2);
+template <class Key, class T, class Hash = frozen_hash<Key>,
+          class KeyEqual = std::equal_to<Key>, std::size_t N>
+constexpr static_frozen_map<Key, T, N, Hash, KeyEqual> make_frozen_map(
+    const std::pair<Key, T> (&items)[N]) {
+  return static_frozen_map<Key, T, N, Hash, KeyEqual>(items);
+}
+
+}  // namespace mystl
+
+#endif  // TINYSTL_FROZEN_MAP_H_
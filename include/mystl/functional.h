@@ -2,5 +2,6 @@
 #define TINYSTL_FUNCTIONAL_H
 
 #include <mystl/__functional/function.h>
+#include <mystl/__functional/hash.h>
 
 #endif
\ No newline at end of file
@@ -2,6 +2,8 @@
 #define TINYSTL_LIST_H
 
 #include <cstddef>
+#include <memory>
+#include <mystl/__memory/footprint.h>
 
 namespace mystl {
 
@@ -166,6 +168,18 @@ class list {
 
   size_type size() const { return _size; }
   bool empty() const { return _size == 0; }
+
+  // 内存占用：每个元素一个节点，prev/next 与对齐填充计入 overhead；
+  // 哨兵节点内嵌在 list 对象中，不占堆内存
+  memory_footprint memory_usage() const noexcept {
+    using node_alloc = std::allocator<list_node<T>>;
+    memory_footprint f;
+    f.payload_bytes = _size * sizeof(T);
+    f.overhead_bytes = _size * (sizeof(list_node<T>) - sizeof(T));
+    f.rounding_bytes = _size * allocation_rounding<node_alloc>::bytes(1);
+    f.allocations = _size;
+    return f;
+  }
 };
 
 }  // namespace mystl
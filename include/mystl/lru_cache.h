@@ -0,0 +1,617 @@
+#ifndef TINYSTL_LRU_CACHE_H_
+#define TINYSTL_LRU_CACHE_H_
+
+#include <algorithm>    // for fill, max
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint64_t
+#include <functional>   // for hash, equal_to, function
+#include <limits>       // for numeric_limits
+#include <memory>       // for allocator, allocator_traits
+#include <mutex>        // for mutex, lock_guard
+#include <new>          // for placement new
+#include <optional>     // for optional
+#include <thread>       // for thread::hardware_concurrency
+#include <tuple>        // for forward_as_tuple
+#include <utility>      // for pair, move, forward, piecewise_construct
+#include <vector>       // for vector
+#include "__functional/hash.h"  // for hash_int
+#include "__hash_table.h"
+#include "list.h"           // for list_node_base
+#include "unordered_map.h"  // for hash_map_value, unordered_map_hasher, unordered_map_key_equal
+
+namespace mystl {
+
+// 缓存准入策略
+//   always：新键总是放入缓存，容量已满时淘汰最久未使用的键（经典 LRU）；
+//   tiny_lfu：容量已满时用频率草图比较新键与待淘汰键的近期访问次数，
+//             新键更频繁才放入（TinyLFU），一次性扫描不会冲掉热点数据。
+enum class cache_admission { always, tiny_lfu };
+
+// 命中、未命中、淘汰与拒绝准入的次数：lru_cache::stats() 的返回值
+struct cache_stats {
+  size_t hits = 0;
+  size_t misses = 0;
+  size_t evictions = 0;   // 因容量不足淘汰的键（不含 erase 与 clear）
+  size_t rejections = 0;  // tiny_lfu 拒绝放入的新键
+  double hit_rate = 0.0;  // hits / (hits + misses)
+};
+
+// ============================================================================
+// frequency_sketch：TinyLFU 的频率草图
+// ============================================================================
+// count-min sketch：每个计数器 4 位，16 个打包在一个 uint64_t 中，每个键
+// 用 4 个哈希位置，估计值取其中最小者。增量次数达到容量的 10 倍时所有
+// 计数器减半，历史访问逐渐衰减。键以调用方算好的哈希值表示。
+// 默认构造的草图不分配内存，不能使用。
+class frequency_sketch {
+ public:
+  frequency_sketch() noexcept = default;
+
+  explicit frequency_sketch(size_t capacity) {
+    size_t counters = 64;
+    bits_ = 6;
+    while (counters < capacity * 4) {
+      counters <<= 1;
+      ++bits_;
+    }
+    table_.assign(counters / 16, 0);
+    sample_ = std::max<size_t>(capacity, 16) * 10;
+  }
+
+  void increment(size_t hash) noexcept {
+    uint64_t x = hash_int(hash);
+    bool added = false;
+    for (int i = 0; i < 4; ++i) {
+      size_t idx = index_of(x, i);
+      uint64_t& word = table_[idx >> 4];
+      unsigned shift = static_cast<unsigned>(idx & 15) * 4;
+      if (((word >> shift) & 15) < 15) {
+        word += uint64_t(1) << shift;
+        added = true;
+      }
+    }
+    if (added && ++additions_ >= sample_) {
+      halve();
+    }
+  }
+
+  unsigned estimate(size_t hash) const noexcept {
+    uint64_t x = hash_int(hash);
+    unsigned r = 15;
+    for (int i = 0; i < 4; ++i) {
+      size_t idx = index_of(x, i);
+      unsigned c = static_cast<unsigned>(
+          (table_[idx >> 4] >> ((idx & 15) * 4)) & 15);
+      r = c < r ? c : r;
+    }
+    return r;
+  }
+
+  void clear() noexcept {
+    std::fill(table_.begin(), table_.end(), 0);
+    additions_ = 0;
+  }
+
+ private:
+  // 第 i 个位置：乘以不同的奇数常数后取最高 bits_ 位
+  size_t index_of(uint64_t x, int i) const noexcept {
+    static constexpr uint64_t seeds[4] = {
+        0x9e3779b97f4a7c15ULL, 0xc2b2ae3d27d4eb4fULL, 0x165667b19e3779f9ULL,
+        0xd6e8feb86659fd93ULL};
+    return static_cast<size_t>((x * seeds[i]) >> (64 - bits_));
+  }
+
+  void halve() noexcept {
+    for (uint64_t& word : table_) {
+      word = (word >> 1) & 0x7777777777777777ULL;
+    }
+    additions_ /= 2;
+  }
+
+  std::vector<uint64_t> table_;
+  unsigned bits_ = 0;  // 计数器总数为 2^bits_
+  size_t additions_ = 0;
+  size_t sample_ = 0;
+};
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+class concurrent_lru_cache;
+
+// ============================================================================
+// lru_cache：有容量上限的 LRU 缓存
+// ============================================================================
+// 每个元素只有一个节点：节点挂在 hash_table 的桶链上，同时通过内嵌的
+// list_node_base 挂在最近使用链表上（表头最新，表尾最旧）。命中只做一次
+// 哈希查找，再把节点摘下移到表头，不分配内存；插入只分配一个节点。
+//
+// get 命中时更新最近使用顺序并返回值的指针（未命中为 nullptr），指针在
+// 下一次修改缓存前有效；peek 与 contains 不更新顺序。put 插入或覆盖，
+// 超出容量时淘汰表尾的键，淘汰前调用 set_eviction_callback 设置的回调
+// （erase 与 clear 不调用）。cache_admission::tiny_lfu 模式下 put 可能
+// 拒绝新键，见 cache_admission。
+//
+// 不是线程安全的；多线程使用见 concurrent_lru_cache。
+template <class Key, class T, class Hash = std::hash<Key>,
+          class KeyEqual = std::equal_to<Key>,
+          class Allocator = std::allocator<std::pair<const Key, T>>>
+class lru_cache {
+ public:
+  // -------------------------- 类型别名 --------------------------
+  using key_type = Key;
+  using mapped_type = T;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+  using size_type = typename std::allocator_traits<Allocator>::size_type;
+  using eviction_callback = std::function<void(const key_type&, mapped_type&)>;
+
+ private:
+  // 表中的值：最近使用链表的链接、用户的值，以及淘汰时定位节点用的键与哈希值
+  struct entry : list_node_base {
+    mapped_type value;
+    const key_type* key = nullptr;
+    size_t hash = 0;
+
+    template <class... Args>
+    explicit entry(Args&&... args)
+        : list_node_base{nullptr, nullptr},
+          value(std::forward<Args>(args)...) {}
+  };
+
+  using node_value = hash_map_value<Key, entry>;
+  using hasher_adapter =
+      unordered_map_hasher<key_type, node_value, hasher, key_equal>;
+  using key_equal_adapter =
+      unordered_map_key_equal<key_type, node_value, key_equal, hasher>;
+  using node_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<node_value>;
+  using table_type = hash_table<node_value, hasher_adapter, key_equal_adapter,
+                                node_allocator>;
+
+  template <class, class, class, class, class>
+  friend class concurrent_lru_cache;
+
+ public:
+  // -------------------------- 构造与析构 --------------------------
+  explicit lru_cache(size_type capacity,
+                     cache_admission admission = cache_admission::always,
+                     const hasher& hf = hasher(),
+                     const key_equal& ke = key_equal(),
+                     const allocator_type& alloc = allocator_type())
+      : table_(hasher_adapter(hf), key_equal_adapter(ke),
+               node_allocator(alloc)),
+        capacity_(capacity),
+        admission_(admission) {
+    if (admission_ == cache_admission::tiny_lfu) {
+      sketch_ = frequency_sketch(capacity_);
+    }
+    // 插入新键后才淘汰，表中最多有 capacity + 1 个元素
+    table_.reserve_unique(capacity_ + 1);
+  }
+
+  lru_cache(const lru_cache&) = delete;
+  lru_cache& operator=(const lru_cache&) = delete;
+
+  // 节点地址不变，只需把哨兵重新接到链表两端
+  lru_cache(lru_cache&& other) noexcept
+      : table_(std::move(other.table_)),
+        capacity_(other.capacity_),
+        admission_(other.admission_),
+        sketch_(std::move(other.sketch_)),
+        on_evict_(std::move(other.on_evict_)),
+        stats_(other.stats_) {
+    move_links(head_, other.head_);
+  }
+
+  lru_cache& operator=(lru_cache&& other) noexcept {
+    lru_cache tmp(std::move(other));
+    swap(tmp);
+    return *this;
+  }
+
+  // -------------------------- 查找 --------------------------
+  // 命中时移到最近使用位置，返回值的指针；未命中返回 nullptr
+  mapped_type* get(const key_type& key) {
+    return get_hash(table_.hash_function()(key), key);
+  }
+
+  // 只读查找：不更新最近使用顺序，也不计入统计
+  const mapped_type* peek(const key_type& key) const {
+    auto it = table_.find(key);
+    return it == table_.end() ? nullptr : &it->get_value().second.value;
+  }
+
+  bool contains(const key_type& key) const { return peek(key) != nullptr; }
+
+  // -------------------------- 修改 --------------------------
+  // 插入或覆盖，并移到最近使用位置；超出容量时淘汰最久未使用的键。
+  // 返回之后键是否在缓存中（tiny_lfu 拒绝准入或容量为 0 时为 false）
+  template <class M>
+  bool put(const key_type& key, M&& value) {
+    return put_hash(table_.hash_function()(key), key, std::forward<M>(value));
+  }
+
+  template <class M>
+  bool put(key_type&& key, M&& value) {
+    size_t hash = table_.hash_function()(key);
+    return put_hash(hash, std::move(key), std::forward<M>(value));
+  }
+
+  bool erase(const key_type& key) {
+    return erase_hash(table_.hash_function()(key), key);
+  }
+
+  // 删除所有键，不调用淘汰回调；容量、回调与统计保留
+  void clear() noexcept {
+    table_.clear();
+    head_.prev = head_.next = &head_;
+  }
+
+  // 修改容量，缩小时立即按最近使用顺序淘汰多出的键
+  void set_capacity(size_type capacity) {
+    capacity_ = capacity;
+    while (size() > capacity_) {
+      evict_one();
+    }
+  }
+
+  void set_eviction_callback(eviction_callback fn) {
+    on_evict_ = std::move(fn);
+  }
+
+  // 从最近到最久依次调用 fn(const key_type&, const mapped_type&)，不更新顺序
+  template <class F>
+  void for_each(F&& fn) const {
+    for (const list_node_base* p = head_.next; p != &head_; p = p->next) {
+      const entry* e = static_cast<const entry*>(p);
+      fn(*e->key, e->value);
+    }
+  }
+
+  void swap(lru_cache& other) noexcept {
+    // 写明 std::swap：成员类型在 mystl 中，ADL 会同时找到 mystl::swap
+    list_node_base tmp;
+    move_links(tmp, head_);
+    move_links(head_, other.head_);
+    move_links(other.head_, tmp);
+    table_.swap(other.table_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(admission_, other.admission_);
+    std::swap(sketch_, other.sketch_);
+    std::swap(on_evict_, other.on_evict_);
+    std::swap(stats_, other.stats_);
+  }
+
+  // -------------------------- 容量与统计 --------------------------
+  size_type size() const noexcept { return table_.size(); }
+  bool empty() const noexcept { return size() == 0; }
+  size_type capacity() const noexcept { return capacity_; }
+  cache_admission admission() const noexcept { return admission_; }
+
+  cache_stats stats() const noexcept {
+    cache_stats s = stats_;
+    if (s.hits + s.misses > 0) {
+      s.hit_rate = static_cast<double>(s.hits) / (s.hits + s.misses);
+    }
+    return s;
+  }
+
+  void reset_stats() noexcept { stats_ = cache_stats(); }
+
+ private:
+  mapped_type* get_hash(size_t hash, const key_type& key) {
+    if (admission_ == cache_admission::tiny_lfu) {
+      sketch_.increment(hash);
+    }
+    auto it = table_.find_hash(hash, key);
+    if (it == table_.end()) {
+      ++stats_.misses;
+      return nullptr;
+    }
+    ++stats_.hits;
+    entry& e = it->get_value().second;
+    move_to_front(&e);
+    return &e.value;
+  }
+
+  // 插入与查找共用一次哈希查找：键已存在时 emplace 不构造节点，直接覆盖；
+  // 新键先挂到表头，再淘汰表尾。tiny_lfu 在表满时先查一次，决定是否准入
+  template <class K, class M>
+  bool put_hash(size_t hash, K&& key, M&& value) {
+    if (capacity_ == 0) {
+      return false;
+    }
+    if (admission_ == cache_admission::tiny_lfu) {
+      sketch_.increment(hash);
+      if (size() >= capacity_ &&
+          sketch_.estimate(hash) <= sketch_.estimate(lru()->hash) &&
+          table_.find_hash(hash, key) == table_.end()) {
+        ++stats_.rejections;
+        return false;
+      }
+    }
+    auto r = table_.emplace_unique_key_hash(
+        hash, key, std::piecewise_construct,
+        std::forward_as_tuple(std::forward<K>(key)),
+        std::forward_as_tuple(std::forward<M>(value)));
+    auto& kv = r.first->get_value();
+    entry& e = kv.second;
+    if (!r.second) {
+      e.value = std::forward<M>(value);
+      move_to_front(&e);
+      return true;
+    }
+    e.key = &kv.first;
+    e.hash = hash;
+    link_front(&e);
+    if (size() > capacity_) {
+      evict_one();
+    }
+    return true;
+  }
+
+  bool erase_hash(size_t hash, const key_type& key) {
+    auto it = table_.find_hash(hash, key);
+    if (it == table_.end()) {
+      return false;
+    }
+    unlink(&it->get_value().second);
+    table_.erase(it);
+    return true;
+  }
+
+  entry* lru() noexcept { return static_cast<entry*>(head_.prev); }
+
+  // 淘汰最久未使用的键：先调用回调，再删除节点
+  void evict_one() {
+    entry* victim = lru();
+    if (on_evict_) {
+      on_evict_(*victim->key, victim->value);
+    }
+    unlink(victim);
+    table_.erase_unique_hash(victim->hash, *victim->key);
+    ++stats_.evictions;
+  }
+
+  void link_front(list_node_base* p) noexcept {
+    p->prev = &head_;
+    p->next = head_.next;
+    head_.next->prev = p;
+    head_.next = p;
+  }
+
+  static void unlink(list_node_base* p) noexcept {
+    p->prev->next = p->next;
+    p->next->prev = p->prev;
+  }
+
+  void move_to_front(list_node_base* p) noexcept {
+    if (head_.next != p) {
+      unlink(p);
+      link_front(p);
+    }
+  }
+
+  // 把哨兵 from 上的链表接到哨兵 to 上，from 置为空链表
+  static void move_links(list_node_base& to, list_node_base& from) noexcept {
+    if (from.next == &from) {
+      to.prev = to.next = &to;
+    } else {
+      to.next = from.next;
+      to.prev = from.prev;
+      to.next->prev = &to;
+      to.prev->next = &to;
+    }
+    from.prev = from.next = &from;
+  }
+
+  table_type table_;
+  list_node_base head_{&head_, &head_};  // 最近使用链表的哨兵
+  size_type capacity_;
+  cache_admission admission_;
+  frequency_sketch sketch_;  // 仅 tiny_lfu 使用
+  eviction_callback on_evict_;
+  cache_stats stats_;
+};
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+void swap(lru_cache<Key, T, Hash, KeyEqual, Allocator>& a,
+          lru_cache<Key, T, Hash, KeyEqual, Allocator>& b) noexcept {
+  a.swap(b);
+}
+
+// ============================================================================
+// concurrent_lru_cache：分片加锁的 LRU 缓存
+// ============================================================================
+// 与 concurrent_unordered_map 相同，键按混合后哈希值的高位分到 2 的幂个
+// 分片，每个分片是一个 lru_cache，由各自的互斥锁保护（get 也要修改最近
+// 使用顺序，因此不用读写锁）。分片数受限于每片至少 min_shard_capacity 个
+// 元素，容量除不尽的余数分给前面的分片，各分片容量之和恰好等于 capacity。
+// 最近使用顺序与淘汰只在分片内部成立，整体上是近似 LRU。
+//
+// get 返回值的拷贝；淘汰回调在持有分片锁时调用，回调中不得再访问同一个缓存。
+template <class Key, class T, class Hash = std::hash<Key>,
+          class KeyEqual = std::equal_to<Key>,
+          class Allocator = std::allocator<std::pair<const Key, T>>>
+class concurrent_lru_cache {
+ public:
+  using cache_type = lru_cache<Key, T, Hash, KeyEqual, Allocator>;
+  using key_type = Key;
+  using mapped_type = T;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+  using size_type = typename cache_type::size_type;
+  using eviction_callback = typename cache_type::eviction_callback;
+
+ private:
+  struct alignas(64) shard {
+    mutable std::mutex mutex;
+    cache_type cache;
+
+    shard(size_type capacity, cache_admission admission, const hasher& hf,
+          const key_equal& ke, const allocator_type& a)
+        : cache(capacity, admission, hf, ke, a) {}
+  };
+
+  using lock_type = std::lock_guard<std::mutex>;
+
+ public:
+  // -------------------------- 构造与析构 --------------------------
+  // shard_count 向上取整为 2 的幂，0 表示按硬件线程数自动选择；
+  // 容量太小时分片数会减少，保证每个分片至少有 min_shard_capacity 个元素
+  explicit concurrent_lru_cache(
+      size_type capacity, size_type shard_count = 0,
+      cache_admission admission = cache_admission::always,
+      const hasher& hf = hasher(), const key_equal& ke = key_equal(),
+      const allocator_type& alloc = allocator_type())
+      : hasher_(hf), capacity_(capacity) {
+    if (shard_count == 0) {
+      size_type threads = std::thread::hardware_concurrency();
+      shard_count = threads == 0 ? 16 : threads * 4;
+    }
+    size_type max_shards =
+        std::max<size_type>(1, capacity / min_shard_capacity);
+    while ((size_type(1) << shard_bits_) < shard_count &&
+           (size_type(2) << shard_bits_) <= max_shards) {
+      ++shard_bits_;
+    }
+    shard_count_ = size_type(1) << shard_bits_;
+    size_type per_shard = capacity / shard_count_;
+    size_type remainder = capacity % shard_count_;
+    shards_ = std::allocator<shard>().allocate(shard_count_);
+    size_type built = 0;
+    try {
+      for (; built < shard_count_; ++built) {
+        ::new (static_cast<void*>(shards_ + built))
+            shard(per_shard + (built < remainder ? 1 : 0), admission, hf, ke,
+                  std::allocator_traits<allocator_type>::
+                      select_on_container_copy_construction(alloc));
+      }
+    } catch (...) {
+      destroy_shards(built);
+      throw;
+    }
+  }
+
+  concurrent_lru_cache(const concurrent_lru_cache&) = delete;
+  concurrent_lru_cache& operator=(const concurrent_lru_cache&) = delete;
+
+  ~concurrent_lru_cache() { destroy_shards(shard_count_); }
+
+  // -------------------------- 操作 --------------------------
+  // 命中时返回值的拷贝并更新最近使用顺序
+  std::optional<mapped_type> get(const key_type& key) {
+    size_t hash = hasher_(key);
+    shard& s = shard_of(hash);
+    lock_type lock(s.mutex);
+    mapped_type* p = s.cache.get_hash(hash, key);
+    if (p == nullptr) {
+      return std::nullopt;
+    }
+    return *p;
+  }
+
+  bool contains(const key_type& key) const {
+    size_t hash = hasher_(key);
+    const shard& s = shard_of(hash);
+    lock_type lock(s.mutex);
+    return s.cache.contains(key);
+  }
+
+  template <class M>
+  bool put(const key_type& key, M&& value) {
+    size_t hash = hasher_(key);
+    shard& s = shard_of(hash);
+    lock_type lock(s.mutex);
+    return s.cache.put_hash(hash, key, std::forward<M>(value));
+  }
+
+  bool erase(const key_type& key) {
+    size_t hash = hasher_(key);
+    shard& s = shard_of(hash);
+    lock_type lock(s.mutex);
+    return s.cache.erase_hash(hash, key);
+  }
+
+  void clear() {
+    for (size_type i = 0; i < shard_count_; ++i) {
+      lock_type lock(shards_[i].mutex);
+      shards_[i].cache.clear();
+    }
+  }
+
+  void set_eviction_callback(const eviction_callback& fn) {
+    for (size_type i = 0; i < shard_count_; ++i) {
+      lock_type lock(shards_[i].mutex);
+      shards_[i].cache.set_eviction_callback(fn);
+    }
+  }
+
+  // -------------------------- 容量与统计 --------------------------
+  // 逐个分片加锁求和，并发修改时只是近似值
+  size_type size() const {
+    size_type n = 0;
+    for (size_type i = 0; i < shard_count_; ++i) {
+      lock_type lock(shards_[i].mutex);
+      n += shards_[i].cache.size();
+    }
+    return n;
+  }
+
+  size_type capacity() const noexcept { return capacity_; }
+
+  size_type shard_count() const noexcept { return shard_count_; }
+
+  cache_stats stats() const {
+    cache_stats total;
+    for (size_type i = 0; i < shard_count_; ++i) {
+      lock_type lock(shards_[i].mutex);
+      cache_stats s = shards_[i].cache.stats();
+      total.hits += s.hits;
+      total.misses += s.misses;
+      total.evictions += s.evictions;
+      total.rejections += s.rejections;
+    }
+    if (total.hits + total.misses > 0) {
+      total.hit_rate =
+          static_cast<double>(total.hits) / (total.hits + total.misses);
+    }
+    return total;
+  }
+
+ private:
+  // 用混合后哈希值的高位选分片；分片内的桶下标由低位决定，两者互不相关
+  size_type shard_index(size_t hash) const noexcept {
+    if (shard_bits_ == 0) {
+      return 0;
+    }
+    return static_cast<size_type>(
+        hash_mix(hash) >> (std::numeric_limits<size_t>::digits - shard_bits_));
+  }
+
+  shard& shard_of(size_t hash) noexcept { return shards_[shard_index(hash)]; }
+
+  const shard& shard_of(size_t hash) const noexcept {
+    return shards_[shard_index(hash)];
+  }
+
+  void destroy_shards(size_type n) noexcept {
+    for (size_type i = 0; i < n; ++i) {
+      shards_[i].~shard();
+    }
+    std::allocator<shard>().deallocate(shards_, shard_count_);
+  }
+
+  static constexpr size_type min_shard_capacity = 8;
+
+  hasher hasher_;
+  size_type capacity_;
+  shard* shards_ = nullptr;
+  size_type shard_count_ = 0;
+  unsigned shard_bits_ = 0;
+};
+
+}  // namespace mystl
+
+#endif  // TINYSTL_LRU_CACHE_H_
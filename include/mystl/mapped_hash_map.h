@@ -0,0 +1,498 @@
+#ifndef TINYSTL_MAPPED_HASH_MAP_H_
+#define TINYSTL_MAPPED_HASH_MAP_H_
+
+#include <algorithm>     // for min
+#include <cerrno>        // for errno
+#include <cstddef>       // for size_t
+#include <cstdint>       // for uint32_t, uint64_t
+#include <cstdio>        // for FILE, fopen, fwrite, rename, remove
+#include <cstring>       // for memcmp, memcpy
+#include <functional>    // for hash, equal_to
+#include <stdexcept>     // for runtime_error, out_of_range
+#include <string>        // for string
+#include <system_error>  // for system_error, generic_category
+#include <type_traits>   // for is_trivially_copyable
+#include <typeinfo>      // for typeid
+#include <utility>       // for move, swap
+#include <vector>        // for vector
+
+#if defined(_WIN32)
+#error "mapped_hash_map 目前只支持 POSIX 平台（mmap）"
+#endif
+
+#include <fcntl.h>     // for open
+#include <sys/mman.h>  // for mmap, munmap
+#include <sys/stat.h>  // for fstat
+#include <unistd.h>    // for close
+
+namespace mystl {
+
+// ============================================================================
+// 哈希表快照：不含指针、可直接映射的磁盘格式
+// ============================================================================
+// write_hash_snapshot 把一张哈希表写成文件，mapped_hash_map 用 mmap 打开文件，
+// 直接在映射上查找，不做任何反序列化。启动代价从 O(元素数) 的重建降为
+// 实际访问到的页面的缺页次数。
+//
+// 文件布局（各段按 64 字节对齐，整数为写入方的本机字节序）：
+//   hash_snapshot_header
+//   buckets[bucket_count + 1] ：uint64_t，桶 b 的元素为 [buckets[b], buckets[b+1])
+//   hashes[size]              ：uint64_t，各元素的完整哈希值，按桶连续存放
+//   entries[size]             ：hash_snapshot_entry<Key, T>，与 hashes 一一对应
+// 同一个桶的元素相邻存放，查找时先顺序比较连续的哈希值，命中才读取元素。
+//
+// 只支持可平凡复制的 Key 与 T（不含指针，才能跨进程直接映射）。
+
+// 格式版本：布局变化时递增，旧文件在打开时被拒绝
+inline constexpr uint32_t hash_snapshot_version = 1;
+
+struct hash_snapshot_header {
+  char magic[8];          // "TSTLHMAP"
+  uint32_t version;       // hash_snapshot_version
+  uint32_t endian;        // 0x01020304，用于识别字节序不同的文件
+  uint64_t hash_id;       // 哈希函数标识（见 snapshot_hash_id）
+  uint32_t key_size;      // sizeof(Key)
+  uint32_t mapped_size;   // sizeof(T)
+  uint32_t entry_size;    // sizeof(hash_snapshot_entry<Key, T>)
+  uint32_t entry_align;   // alignof(hash_snapshot_entry<Key, T>)
+  uint64_t size;          // 元素个数
+  uint64_t bucket_count;  // 桶数，2 的幂
+  uint64_t buckets_offset;
+  uint64_t hashes_offset;
+  uint64_t entries_offset;
+  uint64_t file_size;
+};
+
+template <class Key, class T>
+struct hash_snapshot_entry {
+  Key key;
+  T value;
+};
+
+// 快照文件格式不对或与读取方的类型、哈希函数不匹配
+class hash_snapshot_error : public std::runtime_error {
+ public:
+  using std::runtime_error::runtime_error;
+};
+
+// ============================================================================
+// 哈希函数标识
+// ============================================================================
+// 快照中的桶下标由写入时的哈希值决定，读取方必须使用同一个哈希函数。
+// 默认标识由哈希函数的类型名与它对 Key{} 的结果组合而成，能区分不同的
+// 哈希类型以及不同标准库实现的 std::hash；哈希函数的实现可能在版本之间
+// 变化时，应特化本模板并返回显式的版本号
+template <class Hash, class Key>
+struct snapshot_hash_id {
+  static uint64_t value() {
+    uint64_t h = 0xcbf29ce484222325ULL;  // FNV-1a
+    for (const char* p = typeid(Hash).name(); *p != '\0'; ++p) {
+      h = (h ^ static_cast<unsigned char>(*p)) * 0x100000001b3ULL;
+    }
+    h ^= static_cast<uint64_t>(Hash()(Key()));
+    return h * 0x9e3779b97f4a7c15ULL;
+  }
+};
+
+namespace detail {
+
+inline constexpr char hash_snapshot_magic[8] = {'T', 'S', 'T', 'L',
+                                                'H', 'M', 'A', 'P'};
+inline constexpr uint32_t hash_snapshot_endian = 0x01020304u;
+inline constexpr uint64_t hash_snapshot_align = 64;
+
+// 与 size_t 宽度无关的 64 位混合（murmur3 fmix64），桶下标取其低位
+inline uint64_t hash_snapshot_mix(uint64_t x) noexcept {
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdULL;
+  x ^= x >> 33;
+  x *= 0xc4ceb9fe1a85ec53ULL;
+  x ^= x >> 33;
+  return x;
+}
+
+inline uint64_t hash_snapshot_round_up(uint64_t n) noexcept {
+  return (n + hash_snapshot_align - 1) / hash_snapshot_align *
+         hash_snapshot_align;
+}
+
+// 平均每桶约两个元素：桶数组每元素 4 字节，链内哈希值连续，比较代价很低
+inline uint64_t hash_snapshot_bucket_count(uint64_t n) noexcept {
+  uint64_t bc = 1;
+  while (bc < n / 2) {
+    bc <<= 1;
+  }
+  return bc;
+}
+
+// 写文件的小封装：出错时抛出 system_error，析构时关闭文件
+class snapshot_file_writer {
+  std::FILE* file_;
+  std::string path_;
+  uint64_t written_ = 0;
+
+ public:
+  explicit snapshot_file_writer(const std::string& path)
+      : file_(std::fopen(path.c_str(), "wb")), path_(path) {
+    if (file_ == nullptr) {
+      throw std::system_error(errno, std::generic_category(),
+                              "无法创建快照文件 " + path);
+    }
+  }
+
+  snapshot_file_writer(const snapshot_file_writer&) = delete;
+  snapshot_file_writer& operator=(const snapshot_file_writer&) = delete;
+
+  ~snapshot_file_writer() {
+    if (file_ != nullptr) {
+      std::fclose(file_);
+    }
+  }
+
+  void write(const void* data, uint64_t n) {
+    if (n != 0 && std::fwrite(data, 1, n, file_) != n) {
+      throw std::system_error(errno, std::generic_category(),
+                              "写入快照文件失败 " + path_);
+    }
+    written_ += n;
+  }
+
+  // 用 0 填充到 offset
+  void pad_to(uint64_t offset) {
+    static const char zeros[hash_snapshot_align] = {};
+    while (written_ < offset) {
+      write(zeros, std::min<uint64_t>(offset - written_, sizeof(zeros)));
+    }
+  }
+
+  void close() {
+    std::FILE* f = file_;
+    file_ = nullptr;
+    if (std::fclose(f) != 0) {
+      throw std::system_error(errno, std::generic_category(),
+                              "写入快照文件失败 " + path_);
+    }
+  }
+};
+
+}  // namespace detail
+
+// ============================================================================
+// 写入快照
+// ============================================================================
+// 把 map（unordered_map 等，元素为 pair<const Key, T>）写成快照文件。
+// 先写到 path + ".tmp" 再改名，读取方不会看到写了一半的文件。
+// 哈希值用 map.hash_function() 计算，读取方需使用同一类型的无状态哈希函数
+template <class Map>
+void write_hash_snapshot(
+    const Map& map, const std::string& path,
+    uint64_t hash_id = snapshot_hash_id<typename Map::hasher,
+                                        typename Map::key_type>::value()) {
+  using key_type = typename Map::key_type;
+  using mapped_type = typename Map::mapped_type;
+  using entry = hash_snapshot_entry<key_type, mapped_type>;
+  static_assert(std::is_trivially_copyable<key_type>::value &&
+                    std::is_trivially_copyable<mapped_type>::value,
+                "快照只支持可平凡复制的 Key 与 T");
+
+  const uint64_t n = map.size();
+  const uint64_t bc = detail::hash_snapshot_bucket_count(n);
+  const uint64_t mask = bc - 1;
+  auto hasher = map.hash_function();
+
+  // 计数排序：先数出每个桶的元素个数，再按桶顺序放置
+  std::vector<uint64_t> buckets(bc + 1, 0);
+  std::vector<uint64_t> hashes(n);
+  uint64_t i = 0;
+  for (const auto& kv : map) {
+    hashes[i] = static_cast<uint64_t>(hasher(kv.first));
+    ++buckets[(detail::hash_snapshot_mix(hashes[i]) & mask) + 1];
+    ++i;
+  }
+  for (uint64_t b = 0; b < bc; ++b) {
+    buckets[b + 1] += buckets[b];
+  }
+  std::vector<uint64_t> pos(buckets.begin(), buckets.end() - 1);
+  std::vector<uint64_t> sorted_hashes(n);
+  std::vector<entry> entries(n);
+  i = 0;
+  for (const auto& kv : map) {
+    uint64_t h = hashes[i++];
+    uint64_t slot = pos[detail::hash_snapshot_mix(h) & mask]++;
+    sorted_hashes[slot] = h;
+    std::memcpy(static_cast<void*>(&entries[slot].key), &kv.first,
+                sizeof(key_type));
+    std::memcpy(static_cast<void*>(&entries[slot].value), &kv.second,
+                sizeof(mapped_type));
+  }
+
+  hash_snapshot_header header{};
+  std::memcpy(header.magic, detail::hash_snapshot_magic, sizeof(header.magic));
+  header.version = hash_snapshot_version;
+  header.endian = detail::hash_snapshot_endian;
+  header.hash_id = hash_id;
+  header.key_size = sizeof(key_type);
+  header.mapped_size = sizeof(mapped_type);
+  header.entry_size = sizeof(entry);
+  header.entry_align = alignof(entry);
+  header.size = n;
+  header.bucket_count = bc;
+  header.buckets_offset = detail::hash_snapshot_round_up(sizeof(header));
+  header.hashes_offset = detail::hash_snapshot_round_up(
+      header.buckets_offset + (bc + 1) * sizeof(uint64_t));
+  header.entries_offset = detail::hash_snapshot_round_up(
+      header.hashes_offset + n * sizeof(uint64_t));
+  header.file_size = header.entries_offset + n * sizeof(entry);
+
+  const std::string tmp = path + ".tmp";
+  try {
+    detail::snapshot_file_writer out(tmp);
+    out.write(&header, sizeof(header));
+    out.pad_to(header.buckets_offset);
+    out.write(buckets.data(), buckets.size() * sizeof(uint64_t));
+    out.pad_to(header.hashes_offset);
+    out.write(sorted_hashes.data(), n * sizeof(uint64_t));
+    out.pad_to(header.entries_offset);
+    out.write(entries.data(), n * sizeof(entry));
+    out.close();
+  } catch (...) {
+    std::remove(tmp.c_str());
+    throw;
+  }
+  if (std::rename(tmp.c_str(), path.c_str()) != 0) {
+    int err = errno;
+    std::remove(tmp.c_str());
+    throw std::system_error(err, std::generic_category(),
+                            "无法替换快照文件 " + path);
+  }
+}
+
+// ============================================================================
+// mapped_hash_map：只读映射视图
+// ============================================================================
+// 打开时只校验文件头（格式、版本、字节序、类型大小、哈希函数标识以及各段
+// 边界），不读取桶与元素；find 直接返回指向映射内存的指针。
+// 元素内容没有校验和，文件在映射期间被其他进程改写时结果未定义；
+// 桶边界损坏时查找结果可能错误，但不会越界访问。
+// 视图只读，可以被多个线程同时查找。
+template <class Key, class T, class Hash = std::hash<Key>,
+          class KeyEqual = std::equal_to<Key>>
+class mapped_hash_map {
+  static_assert(std::is_trivially_copyable<Key>::value &&
+                    std::is_trivially_copyable<T>::value,
+                "快照只支持可平凡复制的 Key 与 T");
+
+ public:
+  // -------------------------- 类型别名 --------------------------
+  using key_type = Key;
+  using mapped_type = T;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using size_type = size_t;
+  using entry_type = hash_snapshot_entry<Key, T>;
+
+  // -------------------------- 构造与析构 --------------------------
+  mapped_hash_map() noexcept = default;
+
+  // 映射并校验 path；hash_id 需与写入时一致
+  explicit mapped_hash_map(
+      const std::string& path,
+      uint64_t hash_id = snapshot_hash_id<Hash, Key>::value()) {
+    map_file(path);
+    try {
+      validate(hash_id);
+    } catch (...) {
+      unmap();
+      throw;
+    }
+  }
+
+  mapped_hash_map(mapped_hash_map&& other) noexcept { swap(other); }
+
+  mapped_hash_map& operator=(mapped_hash_map&& other) noexcept {
+    if (this != &other) {
+      unmap();
+      swap(other);
+    }
+    return *this;
+  }
+
+  mapped_hash_map(const mapped_hash_map&) = delete;
+  mapped_hash_map& operator=(const mapped_hash_map&) = delete;
+
+  ~mapped_hash_map() { unmap(); }
+
+  // -------------------------- 查找 --------------------------
+  // 键存在时返回指向映射中值的指针，视图存活期间有效
+  const mapped_type* find(const key_type& key) const {
+    if (size_ == 0) {
+      return nullptr;
+    }
+    uint64_t h = static_cast<uint64_t>(hasher()(key));
+    uint64_t b = detail::hash_snapshot_mix(h) & mask_;
+    // 打开时只校验了桶数组两端，中间的桶边界按元素个数截断，
+    // 损坏的文件只会让查找失败，不会读出映射范围
+    uint64_t last = std::min(buckets_[b + 1], size_);
+    for (uint64_t i = buckets_[b]; i < last; ++i) {
+      if (hashes_[i] == h && key_equal()(entries_[i].key, key)) {
+        return &entries_[i].value;
+      }
+    }
+    return nullptr;
+  }
+
+  const mapped_type& at(const key_type& key) const {
+    const mapped_type* p = find(key);
+    if (p == nullptr) {
+      throw std::out_of_range("mapped_hash_map::at: key not found");
+    }
+    return *p;
+  }
+
+  bool contains(const key_type& key) const { return find(key) != nullptr; }
+
+  size_type count(const key_type& key) const { return contains(key) ? 1 : 0; }
+
+  // -------------------------- 遍历与容量 --------------------------
+  // 按桶顺序调用 fn(const Key&, const T&)
+  template <class F>
+  void for_each(F&& fn) const {
+    for (uint64_t i = 0; i < size_; ++i) {
+      fn(entries_[i].key, entries_[i].value);
+    }
+  }
+
+  size_type size() const noexcept { return static_cast<size_type>(size_); }
+  bool empty() const noexcept { return size_ == 0; }
+  bool is_open() const noexcept { return data_ != nullptr; }
+  size_type bucket_count() const noexcept {
+    return static_cast<size_type>(mask_ + (data_ != nullptr));
+  }
+
+  // 映射的文件字节数
+  size_type mapped_bytes() const noexcept { return length_; }
+
+  void swap(mapped_hash_map& other) noexcept {
+    std::swap(data_, other.data_);
+    std::swap(length_, other.length_);
+    std::swap(size_, other.size_);
+    std::swap(mask_, other.mask_);
+    std::swap(buckets_, other.buckets_);
+    std::swap(hashes_, other.hashes_);
+    std::swap(entries_, other.entries_);
+  }
+
+ private:
+  void map_file(const std::string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+      throw std::system_error(errno, std::generic_category(),
+                              "无法打开快照文件 " + path);
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+      int err = errno;
+      ::close(fd);
+      throw std::system_error(err, std::generic_category(),
+                              "无法读取快照文件信息 " + path);
+    }
+    if (static_cast<uint64_t>(st.st_size) < sizeof(hash_snapshot_header)) {
+      ::close(fd);
+      throw hash_snapshot_error("快照文件过短: " + path);
+    }
+    length_ = static_cast<size_t>(st.st_size);
+    void* p = ::mmap(nullptr, length_, PROT_READ, MAP_SHARED, fd, 0);
+    int err = errno;
+    ::close(fd);  // 映射建立后不再需要文件描述符
+    if (p == MAP_FAILED) {
+      length_ = 0;
+      throw std::system_error(err, std::generic_category(),
+                              "无法映射快照文件 " + path);
+    }
+    data_ = static_cast<const char*>(p);
+  }
+
+  void validate(uint64_t hash_id) {
+    hash_snapshot_header h;
+    std::memcpy(&h, data_, sizeof(h));
+    if (std::memcmp(h.magic, detail::hash_snapshot_magic, sizeof(h.magic)) !=
+        0) {
+      throw hash_snapshot_error("不是哈希表快照文件");
+    }
+    if (h.endian != detail::hash_snapshot_endian) {
+      throw hash_snapshot_error("快照文件的字节序与本机不同");
+    }
+    if (h.version != hash_snapshot_version) {
+      throw hash_snapshot_error("快照文件版本不受支持: " +
+                                std::to_string(h.version));
+    }
+    if (h.key_size != sizeof(Key) || h.mapped_size != sizeof(T) ||
+        h.entry_size != sizeof(entry_type) ||
+        h.entry_align != alignof(entry_type)) {
+      throw hash_snapshot_error("快照文件的键值类型与视图不匹配");
+    }
+    if (h.hash_id != hash_id) {
+      throw hash_snapshot_error("快照文件的哈希函数与视图不匹配");
+    }
+    // 各段必须对齐、互不越界（先检查个数，避免乘法溢出）
+    const uint64_t len = length_;
+    bool ok = h.file_size == len && h.bucket_count != 0 &&
+              (h.bucket_count & (h.bucket_count - 1)) == 0 &&
+              h.bucket_count < len / sizeof(uint64_t) &&
+              h.size <= len / sizeof(entry_type) &&
+              h.buckets_offset % detail::hash_snapshot_align == 0 &&
+              h.hashes_offset % detail::hash_snapshot_align == 0 &&
+              h.entries_offset % alignof(entry_type) == 0 &&
+              h.buckets_offset >= sizeof(h) &&
+              h.buckets_offset <= len &&
+              (h.bucket_count + 1) * sizeof(uint64_t) <=
+                  len - h.buckets_offset &&
+              h.hashes_offset <= len &&
+              h.size * sizeof(uint64_t) <= len - h.hashes_offset &&
+              h.entries_offset <= len &&
+              h.size * sizeof(entry_type) <= len - h.entries_offset;
+    if (!ok) {
+      throw hash_snapshot_error("快照文件头损坏或文件被截断");
+    }
+    buckets_ = reinterpret_cast<const uint64_t*>(data_ + h.buckets_offset);
+    hashes_ = reinterpret_cast<const uint64_t*>(data_ + h.hashes_offset);
+    entries_ = reinterpret_cast<const entry_type*>(data_ + h.entries_offset);
+    // 桶边界只检查两端（逐桶检查就是 O(桶数) 的启动代价）
+    if (buckets_[0] != 0 || buckets_[h.bucket_count] != h.size) {
+      throw hash_snapshot_error("快照文件的桶数组损坏");
+    }
+    size_ = h.size;
+    mask_ = h.bucket_count - 1;
+  }
+
+  void unmap() noexcept {
+    if (data_ != nullptr) {
+      ::munmap(const_cast<char*>(data_), length_);
+    }
+    data_ = nullptr;
+    length_ = 0;
+    size_ = 0;
+    mask_ = 0;
+    buckets_ = nullptr;
+    hashes_ = nullptr;
+    entries_ = nullptr;
+  }
+
+  const char* data_ = nullptr;
+  size_t length_ = 0;
+  uint64_t size_ = 0;
+  uint64_t mask_ = 0;
+  const uint64_t* buckets_ = nullptr;
+  const uint64_t* hashes_ = nullptr;
+  const entry_type* entries_ = nullptr;
+};
+
+template <class Key, class T, class Hash, class KeyEqual>
+void swap(mapped_hash_map<Key, T, Hash, KeyEqual>& x,
+          mapped_hash_map<Key, T, Hash, KeyEqual>& y) noexcept {
+  x.swap(y);
+}
+
+}  // namespace mystl
+
+#endif  // TINYSTL_MAPPED_HASH_MAP_H_
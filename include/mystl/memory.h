@@ -3,6 +3,8 @@
 
 #include <mystl/__memory/allocator.h>
 #include <mystl/__memory/construct.h>
+#include <mystl/__memory/footprint.h>
+#include <mystl/__memory/node_pool_allocator.h>
 #include <mystl/__memory/shared_ptr.h>
 #include <mystl/__memory/uninitialized_algorithms.h>
 #include <mystl/__memory/unique_ptr.h>
@@ -0,0 +1,281 @@
+#ifndef TINYSTL_RCU_UNORDERED_MAP_H_
+#define TINYSTL_RCU_UNORDERED_MAP_H_
+
+#include <algorithm>   // for min
+#include <atomic>      // for atomic
+#include <cstdint>     // for uint64_t
+#include <functional>  // for hash, equal_to
+#include <limits>      // for numeric_limits
+#include <memory>      // for allocator, unique_ptr
+#include <mutex>       // for mutex, lock_guard
+#include <utility>     // for pair, move, forward
+#include <vector>      // for vector
+#include "unordered_map.h"
+
+namespace mystl {
+
+// rcu_unordered_map：读多写少场景下读路径无锁的哈希表（RCU 风格）
+// 表的每个版本是一张不可修改的 unordered_map。写者在互斥锁内拷贝当前版本、
+// 修改副本、以 release 语义发布新指针；读者只需一次 acquire 读取当前指针。
+//
+// 旧版本用静止状态（quiescent-state）方案回收：每个读者线程注册一个独占
+// 缓存行的槽位，每次退出读区间时把全局纪元写入自己的槽位（普通 release 写，
+// 不是读-改-写，也不与其他线程共享缓存行）。写者发布新版本时推进全局纪元，
+// 所有在用槽位都达到该纪元后，旧版本才会释放。因此：
+//   - 读区间必须显式标出（read_section），区间内拿到的指针、引用只在区间内有效；
+//   - 长期不读的已注册线程会推迟回收（不会阻塞写者），空闲时应析构其 reader。
+//
+// 用法：
+//   mystl::rcu_unordered_map<K, V> map;
+//   auto reader = map.register_reader();      // 每个读者线程一个
+//   { auto s = reader.read(); const V* v = s.find(k); ... }
+//   map.update([](auto& m) { m[k] = v; });     // 写者：一次拷贝，批量修改
+template <class Key, class T, class Hash = std::hash<Key>,
+          class KeyEqual = std::equal_to<Key>,
+          class Allocator = std::allocator<std::pair<const Key, T>>,
+          class BucketPolicy = hash_default_bucket_policy>
+class rcu_unordered_map {
+ public:
+  // -------------------------- 类型别名 --------------------------
+  using map_type =
+      unordered_map<Key, T, Hash, KeyEqual, Allocator, BucketPolicy>;
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = typename map_type::value_type;
+  using size_type = typename map_type::size_type;
+
+ private:
+  // 读者槽位：epoch 为该读者最近一次静止时观察到的全局纪元
+  struct alignas(64) reader_slot {
+    std::atomic<std::uint64_t> epoch{0};
+    bool in_use = false;  // 受 registry_mutex_ 保护
+  };
+
+  // 等待回收的旧版本：全局纪元到达 epoch 之后不再有读者持有它
+  struct retired_version {
+    const map_type* map;
+    std::uint64_t epoch;
+  };
+
+ public:
+  class read_section;
+
+  // -------------------------- 读者句柄（每个线程一个，不可跨线程共享）--------------------------
+  class reader {
+   public:
+    reader() = default;
+    reader(reader&& other) noexcept
+        : owner_(other.owner_), slot_(other.slot_), depth_(other.depth_) {
+      other.owner_ = nullptr;
+      other.slot_ = nullptr;
+    }
+    reader& operator=(reader&& other) noexcept {
+      if (this != &other) {
+        release();
+        owner_ = other.owner_;
+        slot_ = other.slot_;
+        depth_ = other.depth_;
+        other.owner_ = nullptr;
+        other.slot_ = nullptr;
+      }
+      return *this;
+    }
+    reader(const reader&) = delete;
+    reader& operator=(const reader&) = delete;
+
+    ~reader() { release(); }
+
+    // 进入读区间；可以嵌套，最外层区间退出时才记录静止状态
+    read_section read() { return read_section(*this); }
+
+    // 不在读区间内时显式声明静止（长时间不读的线程可以周期性调用）
+    void quiescent() noexcept {
+      if (depth_ == 0) {
+        mark_quiescent();
+      }
+    }
+
+   private:
+    friend class rcu_unordered_map;
+    friend class read_section;
+
+    reader(rcu_unordered_map* owner, reader_slot* slot)
+        : owner_(owner), slot_(slot) {}
+
+    void mark_quiescent() noexcept {
+      slot_->epoch.store(owner_->epoch_.load(std::memory_order_acquire),
+                         std::memory_order_release);
+    }
+
+    void release() noexcept {
+      if (slot_ != nullptr) {
+        owner_->unregister_slot(slot_);
+        slot_ = nullptr;
+      }
+    }
+
+    rcu_unordered_map* owner_ = nullptr;
+    reader_slot* slot_ = nullptr;
+    unsigned depth_ = 0;
+  };
+
+  // -------------------------- 读区间：持有某个版本的只读视图 --------------------------
+  class read_section {
+   public:
+    read_section(const read_section&) = delete;
+    read_section& operator=(const read_section&) = delete;
+
+    ~read_section() {
+      if (--reader_.depth_ == 0) {
+        reader_.mark_quiescent();
+      }
+    }
+
+    // 键存在时返回指向值的指针，只在本区间内有效
+    const mapped_type* find(const key_type& key) const {
+      auto it = map_->find(key);
+      return it == map_->end() ? nullptr : &it->second;
+    }
+
+    bool contains(const key_type& key) const { return map_->contains(key); }
+
+    size_type size() const noexcept { return map_->size(); }
+
+    // 完整的只读接口（遍历、桶信息等）
+    const map_type& get() const noexcept { return *map_; }
+    const map_type* operator->() const noexcept { return map_; }
+
+   private:
+    friend class reader;
+
+    explicit read_section(reader& r)
+        : reader_(r),
+          map_(r.owner_->current_.load(std::memory_order_acquire)) {
+      ++reader_.depth_;
+    }
+
+    reader& reader_;
+    const map_type* map_;
+  };
+
+  // -------------------------- 构造与析构 --------------------------
+  rcu_unordered_map() : current_(new map_type()) {}
+
+  explicit rcu_unordered_map(map_type initial)
+      : current_(new map_type(std::move(initial))) {}
+
+  rcu_unordered_map(const rcu_unordered_map&) = delete;
+  rcu_unordered_map& operator=(const rcu_unordered_map&) = delete;
+
+  // 析构前所有 reader 必须已经析构
+  ~rcu_unordered_map() {
+    delete current_.load(std::memory_order_relaxed);
+    for (const retired_version& r : retired_) {
+      delete r.map;
+    }
+  }
+
+  // 注册读者线程
+  reader register_reader() {
+    std::lock_guard<std::mutex> lock(registry_mutex_);
+    reader_slot* slot = nullptr;
+    for (const std::unique_ptr<reader_slot>& s : slots_) {
+      if (!s->in_use) {
+        slot = s.get();
+        break;
+      }
+    }
+    if (slot == nullptr) {
+      slots_.push_back(std::make_unique<reader_slot>());
+      slot = slots_.back().get();
+    }
+    slot->in_use = true;
+    slot->epoch.store(epoch_.load(std::memory_order_acquire),
+                      std::memory_order_release);
+    return reader(this, slot);
+  }
+
+  // -------------------------- 写接口（写者之间互斥）--------------------------
+  // （1）update：拷贝当前版本，调用 fn(map_type&) 修改副本后发布。
+  // 每次调用都会拷贝整张表，多处修改应合并到一次 update 中
+  template <class F>
+  void update(F&& fn) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    std::unique_ptr<map_type> next(
+        new map_type(*current_.load(std::memory_order_relaxed)));
+    fn(*next);
+    publish(next.release());
+  }
+
+  // （2）assign：用一张新表整体替换当前版本（例如定期全量重建）
+  void assign(map_type map) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    publish(new map_type(std::move(map)));
+  }
+
+  // 单次修改的便捷接口，代价与 update 相同
+  void insert_or_assign(const key_type& key, const mapped_type& value) {
+    update([&](map_type& m) { m.insert_or_assign(key, value); });
+  }
+
+  void erase(const key_type& key) {
+    update([&](map_type& m) { m.erase(key); });
+  }
+
+  // 释放所有读者都已离开的旧版本，返回仍在等待回收的版本数
+  size_type reclaim() {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    return reclaim_locked();
+  }
+
+ private:
+  // 发布新版本并推进纪元，旧版本进入待回收列表
+  void publish(map_type* next) {
+    next->finish_rehash();
+    retired_.reserve(retired_.size() + 1);  // 发布之后不再有可能失败的操作
+    const map_type* old = current_.load(std::memory_order_relaxed);
+    current_.store(next, std::memory_order_release);
+    std::uint64_t epoch = epoch_.fetch_add(1, std::memory_order_acq_rel) + 1;
+    retired_.push_back(retired_version{old, epoch});
+    reclaim_locked();
+  }
+
+  size_type reclaim_locked() {
+    std::uint64_t min_epoch = std::numeric_limits<std::uint64_t>::max();
+    {
+      std::lock_guard<std::mutex> lock(registry_mutex_);
+      for (const std::unique_ptr<reader_slot>& s : slots_) {
+        if (s->in_use) {
+          min_epoch =
+              std::min(min_epoch, s->epoch.load(std::memory_order_acquire));
+        }
+      }
+    }
+    size_type kept = 0;
+    for (const retired_version& r : retired_) {
+      if (r.epoch <= min_epoch) {
+        delete r.map;
+      } else {
+        retired_[kept++] = r;
+      }
+    }
+    retired_.resize(kept);
+    return kept;
+  }
+
+  void unregister_slot(reader_slot* slot) noexcept {
+    std::lock_guard<std::mutex> lock(registry_mutex_);
+    slot->in_use = false;
+  }
+
+  std::atomic<const map_type*> current_;
+  std::atomic<std::uint64_t> epoch_{0};
+  std::mutex write_mutex_;  // 写者互斥，保护 retired_
+  std::vector<retired_version> retired_;
+  std::mutex registry_mutex_;  // 保护 slots_ 及 in_use
+  std::vector<std::unique_ptr<reader_slot>> slots_;
+};
+
+}  // namespace mystl
+
+#endif  // TINYSTL_RCU_UNORDERED_MAP_H_
@@ -0,0 +1,737 @@
+#ifndef TINYSTL_SMALL_UNORDERED_MAP_H_
+#define TINYSTL_SMALL_UNORDERED_MAP_H_
+
+#include <cstddef>           // for size_t, ptrdiff_t
+#include <cstdint>           // for uint32_t, uint64_t
+#include <functional>        // for hash, equal_to
+#include <initializer_list>  // for initializer_list
+#include <iterator>          // for forward_iterator_tag
+#include <memory>            // for allocator, addressof
+#include <new>               // for placement new, launder
+#include <stdexcept>         // for out_of_range
+#include <tuple>             // for forward_as_tuple
+#include <type_traits>       // for conditional_t, is_integral_v
+#include <utility>           // for pair, move, forward, piecewise_construct
+#include "__flat_hash_table.h"  // for TINYSTL_FLAT_HASH_HAVE_SSE2
+#include "unordered_map.h"
+
+namespace mystl {
+
+// small_unordered_map：元素少时不分配内存的哈希映射
+// 不超过 N 个元素时，元素直接存放在对象内部的数组里，查找就是线性扫描；
+// 插入第 N + 1 个元素时一次性迁移到内部的 unordered_map，之后行为与
+// unordered_map 相同。clear() 之后回到内联存储，可以在请求之间复用。
+//
+// 接口与 unordered_map 保持一致，差别在于：
+//   - 内联阶段删除元素时，最后一个元素被移到空出的位置（与 erase 返回的
+//     迭代器位置相同），指向最后一个元素的迭代器、指针和引用失效；
+//   - 迁移到哈希表时所有迭代器、指针和引用失效；
+//   - 不提供桶接口、节点句柄和 merge。
+// 键是 4 或 8 字节的整数、且比较函数为 std::equal_to 时，内联阶段另存一份
+// 键的数组，用 SSE2 一次比较 16 字节。
+template <class Key, class T, std::size_t N = 8, class Hash = std::hash<Key>,
+          class KeyEqual = std::equal_to<Key>,
+          class Allocator = std::allocator<std::pair<const Key, T>>>
+class small_unordered_map;
+
+namespace detail {
+
+// 内联阶段能否按位比较键：整数键，且比较函数就是 ==
+template <class Key, class KeyEqual>
+inline constexpr bool small_map_word_keys_v =
+    std::is_integral_v<Key> && !std::is_same_v<Key, bool> &&
+    (sizeof(Key) == 4 || sizeof(Key) == 8) &&
+    (std::is_same_v<KeyEqual, std::equal_to<Key>> ||
+     std::is_same_v<KeyEqual, std::equal_to<>>);
+
+// 内联键的镜像数组。通用版本不保存任何东西
+template <class Key, std::size_t N, bool = false>
+class small_map_key_index {
+ public:
+  void set(std::size_t, const Key&) noexcept {}
+};
+
+// 整数键：按 16 字节对齐、补齐到整组，一次比较一组
+template <class Key, std::size_t N>
+class small_map_key_index<Key, N, true> {
+  using word = std::conditional_t<sizeof(Key) == 4, uint32_t, uint64_t>;
+  static constexpr std::size_t group_width = 16 / sizeof(word);
+  static constexpr std::size_t capacity =
+      (N + group_width - 1) / group_width * group_width;
+
+  alignas(16) word words_[capacity] = {};
+
+ public:
+  void set(std::size_t i, Key key) noexcept {
+    words_[i] = static_cast<word>(key);
+  }
+
+  // 返回前 n 个键中等于 key 的下标，没有时返回 n
+  std::size_t find(Key key, std::size_t n) const noexcept {
+    const word w = static_cast<word>(key);
+#if TINYSTL_FLAT_HASH_HAVE_SSE2
+    const int lo = static_cast<int>(static_cast<uint32_t>(w));
+    const int hi = static_cast<int>(static_cast<uint64_t>(w) >> 32);
+    const __m128i needle = sizeof(word) == 4 ? _mm_set1_epi32(lo)
+                                             : _mm_set_epi32(hi, lo, hi, lo);
+    for (std::size_t i = 0; i < n; i += group_width) {
+      __m128i eq = _mm_cmpeq_epi32(
+          _mm_load_si128(reinterpret_cast<const __m128i*>(words_ + i)),
+          needle);
+      uint32_t mask;
+      if constexpr (sizeof(word) == 4) {
+        mask = static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(eq)));
+      } else {
+        // 64 位相等 = 高低两个 32 位都相等
+        eq = _mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1)));
+        mask = static_cast<uint32_t>(_mm_movemask_pd(_mm_castsi128_pd(eq)));
+      }
+      if (mask != 0) {
+        // 最低的匹配位在 n 之后说明 n 之前没有匹配（之后是旧值或 0）
+        const std::size_t j = i + flat_countr_zero(mask);
+        return j < n ? j : n;
+      }
+    }
+    return n;
+#else
+    for (std::size_t i = 0; i < n; ++i) {
+      if (words_[i] == w) {
+        return i;
+      }
+    }
+    return n;
+#endif
+  }
+};
+
+}  // namespace detail
+
+template <class Key, class T, std::size_t N, class Hash, class KeyEqual,
+          class Allocator>
+class small_unordered_map {
+  static_assert(N > 0, "small_unordered_map requires N > 0");
+
+ public:
+  // -------------------------- 类型别名 --------------------------
+  using map_type = unordered_map<Key, T, Hash, KeyEqual, Allocator>;
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+
+  // 内联容量
+  static constexpr size_type inline_capacity = N;
+
+ private:
+  static constexpr bool word_keys =
+      detail::small_map_word_keys_v<Key, KeyEqual>;
+
+  // -------------------------- 迭代器：内联阶段是数组指针，否则是哈希表迭代器 --------------------------
+  template <bool Const>
+  class basic_iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::pair<const Key, T>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const value_type*, value_type*>;
+    using reference =
+        std::conditional_t<Const, const value_type&, value_type&>;
+
+   private:
+    using map_iterator =
+        std::conditional_t<Const, typename map_type::const_iterator,
+                           typename map_type::iterator>;
+    using element_pointer = pointer;
+
+   public:
+
+    basic_iterator() = default;
+
+    // iterator 可以隐式转换为 const_iterator
+    template <bool C = Const, class = std::enable_if_t<C>>
+    basic_iterator(const basic_iterator<false>& other)
+        : ptr_(other.ptr_), it_(other.it_), inline_(other.inline_) {}
+
+    reference operator*() const { return inline_ ? *ptr_ : *it_; }
+    pointer operator->() const {
+      return inline_ ? ptr_ : std::addressof(*it_);
+    }
+
+    basic_iterator& operator++() {
+      if (inline_) {
+        ++ptr_;
+      } else {
+        ++it_;
+      }
+      return *this;
+    }
+
+    basic_iterator operator++(int) {
+      basic_iterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    friend bool operator==(const basic_iterator& lhs,
+                           const basic_iterator& rhs) {
+      return lhs.inline_ ? lhs.ptr_ == rhs.ptr_ : lhs.it_ == rhs.it_;
+    }
+    friend bool operator!=(const basic_iterator& lhs,
+                           const basic_iterator& rhs) {
+      return !(lhs == rhs);
+    }
+
+   private:
+    friend class small_unordered_map;
+    template <bool>
+    friend class basic_iterator;
+
+    explicit basic_iterator(element_pointer p) : ptr_(p), inline_(true) {}
+    explicit basic_iterator(map_iterator it) : it_(it), inline_(false) {}
+
+    element_pointer ptr_ = nullptr;
+    map_iterator it_{};
+    bool inline_ = true;
+  };
+
+ public:
+  using iterator = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+
+  // -------------------------- 构造与析构 --------------------------
+  small_unordered_map() : large_() {}
+
+  explicit small_unordered_map(const hasher& hf,
+                               const key_equal& ke = key_equal(),
+                               const allocator_type& alloc = allocator_type())
+      : large_(std::initializer_list<value_type>(), 0, hf, ke, alloc) {}
+
+  template <class InputIterator>
+  small_unordered_map(InputIterator first, InputIterator last,
+                      const hasher& hf = hasher(),
+                      const key_equal& ke = key_equal(),
+                      const allocator_type& alloc = allocator_type())
+      : small_unordered_map(hf, ke, alloc) {
+    insert(first, last);
+  }
+
+  small_unordered_map(std::initializer_list<value_type> il,
+                      const hasher& hf = hasher(),
+                      const key_equal& ke = key_equal(),
+                      const allocator_type& alloc = allocator_type())
+      : small_unordered_map(il.begin(), il.end(), hf, ke, alloc) {}
+
+  small_unordered_map(const small_unordered_map& other)
+      : large_(other.inline_ ? empty_map_like(other.large_) : other.large_),
+        inline_(other.inline_) {
+    if (inline_) {
+      for (size_type i = 0; i < other.size_; ++i) {
+        construct_at_end(*other.slot(i));
+      }
+    }
+  }
+
+  small_unordered_map(small_unordered_map&& other) noexcept(
+      std::is_nothrow_move_constructible_v<map_type> &&
+      std::is_nothrow_move_constructible_v<key_type> &&
+      std::is_nothrow_move_constructible_v<mapped_type>)
+      : large_(std::move(other.large_)), inline_(other.inline_) {
+    if (inline_) {
+      for (size_type i = 0; i < other.size_; ++i) {
+        relocate(other, i, i);
+      }
+      size_ = other.size_;
+      other.size_ = 0;
+    }
+    other.inline_ = true;
+  }
+
+  ~small_unordered_map() { destroy_inline(); }
+
+  // -------------------------- 赋值 --------------------------
+  small_unordered_map& operator=(const small_unordered_map& other) {
+    if (this != &other) {
+      small_unordered_map tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  small_unordered_map& operator=(small_unordered_map&& other) noexcept(
+      std::is_nothrow_move_constructible_v<small_unordered_map>) {
+    if (this != &other) {
+      small_unordered_map tmp(std::move(other));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  small_unordered_map& operator=(std::initializer_list<value_type> il) {
+    clear();
+    insert(il);
+    return *this;
+  }
+
+  // -------------------------- 访问 --------------------------
+  mapped_type& operator[](const key_type& key) {
+    return try_emplace(key).first->second;
+  }
+
+  mapped_type& operator[](key_type&& key) {
+    return try_emplace(std::move(key)).first->second;
+  }
+
+  mapped_type& at(const key_type& key) {
+    iterator it = find(key);
+    if (it == end()) {
+      throw std::out_of_range(
+          "tinystl::small_unordered_map::at: key not found");
+    }
+    return it->second;
+  }
+
+  const mapped_type& at(const key_type& key) const {
+    const_iterator it = find(key);
+    if (it == end()) {
+      throw std::out_of_range(
+          "tinystl::small_unordered_map::at: key not found");
+    }
+    return it->second;
+  }
+
+  // -------------------------- 插入 --------------------------
+  std::pair<iterator, bool> insert(const value_type& val) {
+    return emplace(val);
+  }
+
+  std::pair<iterator, bool> insert(value_type&& val) {
+    return emplace(std::move(val));
+  }
+
+  // 带提示的插入：提示被忽略（与 std::unordered_map 相同），供 std::inserter 使用
+  iterator insert(const_iterator /*hint*/, const value_type& val) {
+    return emplace(val).first;
+  }
+
+  iterator insert(const_iterator /*hint*/, value_type&& val) {
+    return emplace(std::move(val)).first;
+  }
+
+  template <class InputIterator>
+  void insert(InputIterator first, InputIterator last) {
+    for (; first != last; ++first) {
+      emplace(*first);
+    }
+  }
+
+  void insert(std::initializer_list<value_type> il) {
+    insert(il.begin(), il.end());
+  }
+
+  // 内联阶段有空位时直接在数组末尾构造，键已存在再销毁
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    if (!inline_) {
+      auto [it, inserted] = large_.emplace(std::forward<Args>(args)...);
+      return {iterator(it), inserted};
+    }
+    if (size_ < N) {
+      value_type* p = ::new (static_cast<void*>(slot(size_)))
+          value_type(std::forward<Args>(args)...);
+      size_type i = find_index(p->first);
+      if (i != size_) {
+        p->~value_type();
+        return {iterator(slot(i)), false};
+      }
+      index_.set(size_, p->first);
+      ++size_;
+      return {iterator(p), true};
+    }
+    value_type val(std::forward<Args>(args)...);
+    size_type i = find_index(val.first);
+    if (i != size_) {
+      return {iterator(slot(i)), false};
+    }
+    migrate();
+    auto [it, inserted] = large_.emplace(std::move(val));
+    return {iterator(it), inserted};
+  }
+
+  template <class... Args>
+  iterator emplace_hint(const_iterator /*hint*/, Args&&... args) {
+    return emplace(std::forward<Args>(args)...).first;
+  }
+
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args) {
+    return try_emplace_impl(key, std::forward<Args>(args)...);
+  }
+
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args) {
+    return try_emplace_impl(std::move(key), std::forward<Args>(args)...);
+  }
+
+  template <class... Args>
+  iterator try_emplace(const_iterator /*hint*/, const key_type& key,
+                       Args&&... args) {
+    return try_emplace(key, std::forward<Args>(args)...).first;
+  }
+
+  template <class... Args>
+  iterator try_emplace(const_iterator /*hint*/, key_type&& key,
+                       Args&&... args) {
+    return try_emplace(std::move(key), std::forward<Args>(args)...).first;
+  }
+
+  template <class M>
+  std::pair<iterator, bool> insert_or_assign(const key_type& key, M&& obj) {
+    auto result = try_emplace(key, std::forward<M>(obj));
+    if (!result.second) {
+      result.first->second = std::forward<M>(obj);
+    }
+    return result;
+  }
+
+  template <class M>
+  std::pair<iterator, bool> insert_or_assign(key_type&& key, M&& obj) {
+    auto result = try_emplace(std::move(key), std::forward<M>(obj));
+    if (!result.second) {
+      result.first->second = std::forward<M>(obj);
+    }
+    return result;
+  }
+
+  // -------------------------- 查找 --------------------------
+  iterator find(const key_type& key) {
+    if (!inline_) {
+      return iterator(large_.find(key));
+    }
+    return iterator(slot(find_index(key)));
+  }
+
+  const_iterator find(const key_type& key) const {
+    if (!inline_) {
+      return const_iterator(large_.find(key));
+    }
+    return const_iterator(slot(find_index(key)));
+  }
+
+  size_type count(const key_type& key) const {
+    return contains(key) ? 1 : 0;
+  }
+
+  bool contains(const key_type& key) const { return find(key) != end(); }
+
+  std::pair<iterator, iterator> equal_range(const key_type& key) {
+    iterator it = find(key);
+    iterator next = it;
+    return {it, it == end() ? it : ++next};
+  }
+
+  std::pair<const_iterator, const_iterator> equal_range(
+      const key_type& key) const {
+    const_iterator it = find(key);
+    const_iterator next = it;
+    return {it, it == end() ? it : ++next};
+  }
+
+  // -------------------------- 删除 --------------------------
+  // 内联阶段：最后一个元素移到 pos，返回指向 pos 的迭代器
+  iterator erase(const_iterator pos) {
+    if (!inline_) {
+      return iterator(large_.erase(pos.it_));
+    }
+    const size_type i = static_cast<size_type>(pos.ptr_ - slot(0));
+    remove_inline(i);
+    return iterator(slot(i));
+  }
+
+  iterator erase(iterator pos) { return erase(const_iterator(pos)); }
+
+  size_type erase(const key_type& key) {
+    if (!inline_) {
+      return large_.erase(key);
+    }
+    const size_type i = find_index(key);
+    if (i == size_) {
+      return 0;
+    }
+    remove_inline(i);
+    return 1;
+  }
+
+  // 内联阶段把 last 之后的元素整体前移
+  iterator erase(const_iterator first, const_iterator last) {
+    if (!inline_) {
+      return iterator(large_.erase(first.it_, last.it_));
+    }
+    const size_type from = static_cast<size_type>(first.ptr_ - slot(0));
+    const size_type to = static_cast<size_type>(last.ptr_ - slot(0));
+    if (from == to) {
+      return iterator(slot(from));
+    }
+    for (size_type i = from; i < to; ++i) {
+      slot(i)->~value_type();
+    }
+    size_type out = from;
+    for (size_type i = to; i < size_; ++i, ++out) {
+      relocate(*this, i, out);
+    }
+    size_ = out;
+    return iterator(slot(from));
+  }
+
+  // 清空并回到内联存储，哈希表的内存随之释放
+  void clear() noexcept {
+    destroy_inline();
+    if (!inline_) {
+      map_type empty = empty_map_like(large_);
+      large_.swap(empty);
+      inline_ = true;
+    }
+  }
+
+  // -------------------------- 迭代器 --------------------------
+  iterator begin() noexcept {
+    return inline_ ? iterator(slot(0)) : iterator(large_.begin());
+  }
+  iterator end() noexcept {
+    return inline_ ? iterator(slot(size_)) : iterator(large_.end());
+  }
+  const_iterator begin() const noexcept {
+    return inline_ ? const_iterator(slot(0)) : const_iterator(large_.begin());
+  }
+  const_iterator end() const noexcept {
+    return inline_ ? const_iterator(slot(size_)) : const_iterator(large_.end());
+  }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  // -------------------------- 容量 --------------------------
+  bool empty() const noexcept { return size() == 0; }
+  size_type size() const noexcept { return inline_ ? size_ : large_.size(); }
+  size_type max_size() const noexcept { return large_.max_size(); }
+
+  // 预计超过内联容量时提前迁移，避免之后再搬一次
+  void reserve(size_type n) {
+    if (n > N && inline_) {
+      migrate();
+    }
+    if (!inline_) {
+      large_.reserve(n);
+    }
+  }
+
+  // 内联阶段只有请求的桶数超过内联容量时才迁移
+  void rehash(size_type n) {
+    if (n > N && inline_) {
+      migrate();
+    }
+    if (!inline_) {
+      large_.rehash(n);
+    }
+  }
+
+  // 是否仍在使用内联存储（扩展接口）
+  bool is_inline() const noexcept { return inline_; }
+
+  // -------------------------- 其他 --------------------------
+  void swap(small_unordered_map& other) noexcept(
+      std::is_nothrow_move_constructible_v<key_type> &&
+      std::is_nothrow_move_constructible_v<mapped_type>) {
+    if (this == &other) {
+      return;
+    }
+    large_.swap(other.large_);
+    std::swap(inline_, other.inline_);
+    // 交换内联元素（处于哈希表阶段的一方 size_ 为 0）
+    small_unordered_map* a = this;
+    small_unordered_map* b = &other;
+    if (a->size_ < b->size_) {
+      std::swap(a, b);
+    }
+    // a 的元素更多：公共部分经由临时对象逐个交换，多出来的搬到 b
+    const size_type common = b->size_;
+    for (size_type i = 0; i < common; ++i) {
+      value_type* p = a->slot(i);
+      value_type tmp(std::move(const_cast<key_type&>(p->first)),
+                     std::move(p->second));
+      p->~value_type();
+      a->relocate(*b, i, i);
+      ::new (static_cast<void*>(b->slot(i)))
+          value_type(std::move(const_cast<key_type&>(tmp.first)),
+                     std::move(tmp.second));
+      b->index_.set(i, b->slot(i)->first);
+    }
+    for (size_type i = common; i < a->size_; ++i) {
+      b->relocate(*a, i, i);
+    }
+    std::swap(a->size_, b->size_);
+  }
+
+  allocator_type get_allocator() const noexcept {
+    return large_.get_allocator();
+  }
+  hasher hash_function() const { return large_.hash_function(); }
+  key_equal key_eq() const { return large_.key_eq(); }
+
+ private:
+  // 与 m 使用相同函数对象和分配器的空表（不分配桶数组）
+  static map_type empty_map_like(const map_type& m) {
+    return map_type(std::initializer_list<value_type>(), 0, m.hash_function(),
+                    m.key_eq(), m.get_allocator());
+  }
+
+  value_type* slot(size_type i) noexcept {
+    return std::launder(reinterpret_cast<value_type*>(storage_)) + i;
+  }
+  const value_type* slot(size_type i) const noexcept {
+    return std::launder(reinterpret_cast<const value_type*>(storage_)) + i;
+  }
+
+  // 内联阶段：返回键的下标，没有时返回 size_
+  size_type find_index(const key_type& key) const {
+    if constexpr (word_keys) {
+      return index_.find(key, size_);
+    } else {
+      const key_equal eq = large_.key_eq();
+      for (size_type i = 0; i < size_; ++i) {
+        if (eq(slot(i)->first, key)) {
+          return i;
+        }
+      }
+      return size_;
+    }
+  }
+
+  template <class... Args>
+  void construct_at_end(Args&&... args) {
+    value_type* p = ::new (static_cast<void*>(slot(size_)))
+        value_type(std::forward<Args>(args)...);
+    index_.set(size_, p->first);
+    ++size_;
+  }
+
+  // 把 src 下标 from 的元素搬到本对象的空位 to（不修改两边的 size_）
+  void relocate(small_unordered_map& src, size_type from, size_type to) {
+    value_type* p = src.slot(from);
+    ::new (static_cast<void*>(slot(to)))
+        value_type(std::move(const_cast<key_type&>(p->first)),
+                   std::move(p->second));
+    p->~value_type();
+    index_.set(to, slot(to)->first);
+  }
+
+  void remove_inline(size_type i) {
+    slot(i)->~value_type();
+    if (i != size_ - 1) {
+      relocate(*this, size_ - 1, i);
+    }
+    --size_;
+  }
+
+  void destroy_inline() noexcept {
+    for (size_type i = 0; i < size_; ++i) {
+      slot(i)->~value_type();
+    }
+    size_ = 0;
+  }
+
+  template <class K, class... Args>
+  std::pair<iterator, bool> try_emplace_impl(K&& key, Args&&... args) {
+    if (inline_) {
+      size_type i = find_index(key);
+      if (i != size_) {
+        return {iterator(slot(i)), false};
+      }
+      if (size_ < N) {
+        construct_at_end(std::piecewise_construct,
+                         std::forward_as_tuple(std::forward<K>(key)),
+                         std::forward_as_tuple(std::forward<Args>(args)...));
+        return {iterator(slot(size_ - 1)), true};
+      }
+      migrate();
+    }
+    auto [it, inserted] =
+        large_.try_emplace(std::forward<K>(key), std::forward<Args>(args)...);
+    return {iterator(it), inserted};
+  }
+
+  // 迁移到哈希表。键和值都可拷贝时先把全部元素拷贝进新表，成功后才
+  // 销毁内联元素，失败时保持原状；否则只能移动，中途失败时已移走的
+  // 内联元素无法复原，清空本对象后重新抛出（基本保证）
+  void migrate() {
+    map_type table = empty_map_like(large_);
+    table.reserve(N + 1);
+    if constexpr (std::is_copy_constructible_v<key_type> &&
+                  std::is_copy_constructible_v<mapped_type>) {
+      for (size_type i = 0; i < size_; ++i) {
+        table.emplace(slot(i)->first, slot(i)->second);
+      }
+    } else {
+      try {
+        for (size_type i = 0; i < size_; ++i) {
+          value_type* p = slot(i);
+          table.emplace(std::move(const_cast<key_type&>(p->first)),
+                        std::move(p->second));
+        }
+      } catch (...) {
+        destroy_inline();
+        throw;
+      }
+    }
+    large_.swap(table);
+    destroy_inline();
+    inline_ = false;
+  }
+
+  alignas(value_type) unsigned char storage_[N * sizeof(value_type)];
+  detail::small_map_key_index<Key, N, word_keys> index_;
+  size_type size_ = 0;   // 内联元素个数，只在内联阶段有意义
+  map_type large_;       // 内联阶段为空表，不占用桶数组
+  bool inline_ = true;
+};
+
+template <class Key, class T, std::size_t N, class Hash, class KeyEqual,
+          class Allocator>
+void swap(small_unordered_map<Key, T, N, Hash, KeyEqual, Allocator>& lhs,
+          small_unordered_map<Key, T, N, Hash, KeyEqual, Allocator>& rhs)
+    noexcept(noexcept(lhs.swap(rhs))) {
+  lhs.swap(rhs);
+}
+
+template <class Key, class T, std::size_t N, class Hash, class KeyEqual,
+          class Allocator>
+bool operator==(
+    const small_unordered_map<Key, T, N, Hash, KeyEqual, Allocator>& lhs,
+    const small_unordered_map<Key, T, N, Hash, KeyEqual, Allocator>& rhs) {
+  if (lhs.size() != rhs.size()) {
+    return false;
+  }
+  for (const auto& elem : lhs) {
+    auto it = rhs.find(elem.first);
+    if (it == rhs.end() || it->second != elem.second) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <class Key, class T, std::size_t N, class Hash, class KeyEqual,
+          class Allocator>
+bool operator!=(
+    const small_unordered_map<Key, T, N, Hash, KeyEqual, Allocator>& lhs,
+    const small_unordered_map<Key, T, N, Hash, KeyEqual, Allocator>& rhs) {
+  return !(lhs == rhs);
+}
+
+}  // namespace mystl
+
+#endif  // TINYSTL_SMALL_UNORDERED_MAP_H_
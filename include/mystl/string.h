@@ -10,6 +10,9 @@
 #include <stdexcept>
 #include <utility>
 
+#include <mystl/__memory/footprint.h>
+#include <mystl/__type_traits/is_trivially_relocatable.h>
+
 namespace mystl {
 
 // char_traits
@@ -314,6 +317,21 @@ class basic_string {
     return is_long() ? get_long_cap() : min_cap - 1;
   }
 
+  // 内存占用：短字符串存放在对象内部，不占堆内存；长字符串申请
+  // capacity() + 1 个字符，结尾的空字符计入 overhead
+  memory_footprint memory_usage() const noexcept {
+    memory_footprint f;
+    if (is_long()) {
+      f.payload_bytes = get_long_size() * sizeof(value_type);
+      f.slack_bytes = (get_long_cap() - get_long_size()) * sizeof(value_type);
+      f.overhead_bytes = sizeof(value_type);
+      f.rounding_bytes =
+          allocation_rounding<allocator_type>::bytes(get_long_cap() + 1);
+      f.allocations = 1;
+    }
+    return f;
+  }
+
   bool empty() const noexcept { return size() == 0; }
 
   void reserve(size_type new_cap = 0) {
@@ -575,6 +593,11 @@ std::ostream& operator<<(std::ostream& os,
   return os.write(str.data(), str.size());
 }
 
+// 短字符串直接存放在对象内部，不保存指向自身的指针，可以整体 memcpy
+template <class CharT, class Traits, class Allocator>
+struct is_trivially_relocatable<basic_string<CharT, Traits, Allocator>>
+    : public is_trivially_relocatable<Allocator> {};
+
 using string = basic_string<char>;
 using wstring = basic_string<wchar_t>;
 
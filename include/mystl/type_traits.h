@@ -12,6 +12,7 @@
 #include <mystl/__type_traits/is_trivially_constructible.h>
 #include <mystl/__type_traits/is_trivially_copyable.h>
 #include <mystl/__type_traits/is_trivially_destructible.h>
+#include <mystl/__type_traits/is_trivially_relocatable.h>
 #include <mystl/__type_traits/is_void.h>
 #include <mystl/__type_traits/remove_cv.h>
 #include <mystl/__type_traits/remove_reference.h>
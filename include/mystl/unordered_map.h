@@ -7,9 +7,11 @@
 #include <iterator>          // for forward_iterator_tag
 #include <memory>            // for allocator, addressof
 #include <stdexcept>         // for out_of_range
+#include <tuple>             // for forward_as_tuple
 #include <type_traits>       // for remove_reference_t, declval
 #include <utility>           // for pair, move, forward
 #include "__hash_table.h"
+#include "__node_handle.h"
 
 namespace mystl {
 
@@ -21,6 +23,41 @@ class unordered_map_hasher;
 template <class Key, class ValueType, class Hash, class KeyEqual>
 class unordered_map_key_equal;
 
+// 异构查找判定：Hash 与 KeyEqual 都声明 is_transparent 时，
+// find/count/contains/erase/at/bucket 接受任意可哈希、可比较的键类型，
+// 例如以 std::string 为键的表可直接用 std::string_view 查找，不构造临时 string
+template <class Hash, class KeyEqual, class = void>
+struct is_transparent_lookup : std::false_type {};
+
+template <class Hash, class KeyEqual>
+struct is_transparent_lookup<Hash, KeyEqual,
+                             std::void_t<typename Hash::is_transparent,
+                                         typename KeyEqual::is_transparent>>
+    : std::true_type {};
+
+// K 仅用于让条件依赖成员模板参数，从而可以 SFINAE
+template <class Hash, class KeyEqual, class K>
+using enable_transparent_t =
+    std::enable_if_t<is_transparent_lookup<Hash, KeyEqual>::value, K>;
+
+// 批量插入判定：前向迭代器，且元素的 first 就是 Key。
+// 满足时可以先取出键求哈希、查找，键不存在才构造节点
+template <class Iterator, class Key, class = void>
+struct is_keyed_forward_range : std::false_type {};
+
+template <class Iterator, class Key>
+struct is_keyed_forward_range<
+    Iterator, Key,
+    std::enable_if_t<
+        std::is_base_of_v<
+            std::forward_iterator_tag,
+            typename std::iterator_traits<Iterator>::iterator_category> &&
+        std::is_same_v<
+            std::decay_t<decltype(std::declval<typename std::iterator_traits<
+                                      Iterator>::reference>()
+                                      .first)>,
+            Key>>> : std::true_type {};
+
 // 2. 迭代器适配器（将 hash_table 迭代器转换为返回 value_type 的迭代器）
 // 参考标准库的 hash_map_iterator 实现
 template <class HashIterator>
@@ -28,12 +65,12 @@ class hash_map_iterator {
  private:
   HashIterator i_;
 
-  // 从 get_value() 的返回类型提取 value_type
   using node_value_type = typename HashIterator::value_type;
-  using value_type = std::remove_reference_t<
-      decltype(std::declval<node_value_type>().get_value())>;
 
  public:
+  // 从 get_value() 的返回类型提取 value_type（对外公开，iterator_traits 可用）
+  using value_type = std::remove_reference_t<
+      decltype(std::declval<node_value_type>().get_value())>;
   using iterator_category = std::forward_iterator_tag;
   using difference_type = typename HashIterator::difference_type;
   using reference = value_type&;
@@ -67,7 +104,7 @@ class hash_map_iterator {
   }
 
   // 允许 unordered_map 访问底层迭代器
-  template <class, class, class, class, class>
+  template <class, class, class, class, class, class, class>
   friend class unordered_map;
 
   // 获取底层迭代器（供 erase 等方法使用）
@@ -80,12 +117,12 @@ class hash_map_const_iterator {
  private:
   HashIterator i_;
 
-  // 从 get_value() 的返回类型提取 value_type
   using node_value_type = typename HashIterator::value_type;
-  using value_type = std::remove_reference_t<
-      decltype(std::declval<const node_value_type>().get_value())>;
 
  public:
+  // 从 get_value() 的返回类型提取 value_type（去掉 const，与标准一致）
+  using value_type = std::remove_cv_t<std::remove_reference_t<
+      decltype(std::declval<const node_value_type>().get_value())>>;
   using iterator_category = std::forward_iterator_tag;
   using difference_type = typename HashIterator::difference_type;
   using reference = const value_type&;
@@ -123,18 +160,75 @@ class hash_map_const_iterator {
     return i_ != other.i_;
   }
 
-  template <class, class, class, class, class>
+  template <class, class, class, class, class, class, class>
   friend class unordered_map;
 
   HashIterator get_iterator() const { return i_; }
 };
 
-// 2. unordered_map 主类（模板参数对齐 C++ 标准）
+// 3. hash_table 存储的 "节点值类型"：封装 value_type，供适配器提取键
+// 只依赖 Key 与 T，因此 Hash、KeyEqual、BucketPolicy 不同（HashCache 相同）的
+// unordered_map 节点类型相同，节点句柄可以在它们之间转移（extract / insert / merge）
+template <class Key, class T>
+struct hash_map_value {
+  using key_type = Key;
+  using value_type = std::pair<const Key, T>;
+
+  value_type data_;
+
+  // 构造函数（支持拷贝、移动）
+  hash_map_value(const value_type& val) : data_(val) {}
+  hash_map_value(value_type&& val) : data_(std::move(val)) {}
+
+  // 显式声明拷贝和移动构造函数（因为定义了赋值操作符）
+  hash_map_value(const hash_map_value& other) : data_(other.data_) {}
+  hash_map_value(hash_map_value&& other) noexcept
+      : data_(std::move(other.data_)) {}
+
+  // 支持 emplace：可变参数构造函数，用于直接构造 pair
+  template <class... Args>
+  hash_map_value(Args&&... args) : data_(std::forward<Args>(args)...) {}
+
+  // 供适配器提取键的接口（hash_table 需要通过节点值获取 Key）
+  const key_type& get_key() const noexcept { return data_.first; }
+
+  // 提供获取 value_type 的接口（供迭代器适配器使用）
+  value_type& get_value() noexcept { return data_; }
+  const value_type& get_value() const noexcept { return data_; }
+
+  // 支持赋值（因为 pair<const Key, T> 的赋值操作符被删除）
+  hash_map_value& operator=(const hash_map_value& other) {
+    // 通过修改非 const 引用来赋值（类似标准库的 ref() 方法）
+    const_cast<key_type&>(data_.first) = other.data_.first;
+    data_.second = other.data_.second;
+    return *this;
+  }
+
+  hash_map_value& operator=(hash_map_value&& other) noexcept {
+    const_cast<key_type&>(data_.first) =
+        std::move(const_cast<key_type&>(other.data_.first));
+    data_.second = std::move(other.data_.second);
+    return *this;
+  }
+};
+
+// 4. unordered_map 主类（前五个模板参数对齐 C++ 标准）
+// BucketPolicy 为扩展参数，决定桶数取值与哈希值到桶的映射：
+//   hash_default_bucket_policy：与标准库一致（质数取模，或用户请求的 2 的幂）
+//   hash_prime_bucket_policy  ：预计算质数表 + 乘法快速取模，无除法
+//   hash_power2_bucket_policy ：桶数为 2 的幂，混合哈希后取掩码
+//   hash_mask_bucket_policy   ：桶数为 2 的幂，直接取掩码（配合 mystl::hash）
+// HashCache 为扩展参数，决定节点中缓存的哈希信息：
+//   hash_cache_full       ：保存完整哈希值（默认）
+//   hash_cache_fingerprint：保存 32 位指纹，仍可在比较键之前快速拒绝
+//   hash_cache_none       ：不保存，需要时重新计算（适合整数、指针键）
 template <class Key, class T,
           class Hash = std::hash<Key>,          // 默认哈希函数（标准库）
           class KeyEqual = std::equal_to<Key>,  // 默认键相等性比较（标准库）
           class Allocator =
-              std::allocator<std::pair<const Key, T>>  // 默认分配器（标准库）
+              std::allocator<std::pair<const Key, T>>,  // 默认分配器（标准库）
+          class BucketPolicy = hash_default_bucket_policy,  // 桶数策略
+          class HashCache = hash_cache_full  // 哈希值缓存策略
           >
 class unordered_map {
  public:
@@ -145,6 +239,8 @@ class unordered_map {
   using hasher = Hash;
   using key_equal = KeyEqual;
   using allocator_type = Allocator;
+  using bucket_policy = BucketPolicy;
+  using hash_cache = HashCache;
   using size_type = typename std::allocator_traits<Allocator>::size_type;
   using difference_type =
       typename std::allocator_traits<Allocator>::difference_type;
@@ -156,45 +252,8 @@ class unordered_map {
 
  private:
   // -------------------------- 底层哈希表相关类型（适配 hash_table）--------------------------
-  // （1）hash_table 存储的 "节点值类型"：封装 value_type，供适配器提取键
-  struct hash_node_value {
-    value_type data_;
-
-    // 构造函数（支持拷贝、移动）
-    hash_node_value(const value_type& val) : data_(val) {}
-    hash_node_value(value_type&& val) : data_(std::move(val)) {}
-
-    // 显式声明拷贝和移动构造函数（因为定义了赋值操作符）
-    hash_node_value(const hash_node_value& other) : data_(other.data_) {}
-    hash_node_value(hash_node_value&& other) noexcept
-        : data_(std::move(other.data_)) {}
-
-    // 支持 emplace：可变参数构造函数，用于直接构造 pair
-    template <class... Args>
-    hash_node_value(Args&&... args) : data_(std::forward<Args>(args)...) {}
-
-    // 供适配器提取键的接口（hash_table 需要通过节点值获取 Key）
-    const key_type& get_key() const noexcept { return data_.first; }
-
-    // 提供获取 value_type 的接口（供迭代器适配器使用）
-    value_type& get_value() noexcept { return data_; }
-    const value_type& get_value() const noexcept { return data_; }
-
-    // 支持赋值（因为 pair<const Key, T> 的赋值操作符被删除）
-    hash_node_value& operator=(const hash_node_value& other) {
-      // 通过修改非 const 引用来赋值（类似标准库的 ref() 方法）
-      const_cast<key_type&>(data_.first) = other.data_.first;
-      data_.second = other.data_.second;
-      return *this;
-    }
-
-    hash_node_value& operator=(hash_node_value&& other) noexcept {
-      const_cast<key_type&>(data_.first) =
-          std::move(const_cast<key_type&>(other.data_.first));
-      data_.second = std::move(other.data_.second);
-      return *this;
-    }
-  };
+  // （1）hash_table 存储的 "节点值类型"（见 hash_map_value）
+  using hash_node_value = hash_map_value<Key, T>;
 
   // （2）适配 hash_table 的哈希函数（由 unordered_map_hasher 实现）
   using hasher_adapter =
@@ -213,7 +272,9 @@ class unordered_map {
       mystl::hash_table<hash_node_value,    // 哈希表存储的节点值类型
                         hasher_adapter,     // 哈希函数适配器
                         key_equal_adapter,  // 键相等性比较适配器
-                        node_allocator      // 节点分配器
+                        node_allocator,     // 节点分配器
+                        bucket_policy,      // 桶数策略
+                        hash_cache          // 哈希值缓存策略
                         >;
 
   // 底层哈希表实例（核心依赖）
@@ -232,6 +293,18 @@ class unordered_map {
   using const_local_iterator =
       hash_map_const_iterator<typename base_hash_table::const_local_iterator>;
 
+  // 节点句柄类型（C++17）
+  using node_type =
+      map_node_handle<typename base_hash_table::node_type, allocator_type>;
+  using insert_return_type = node_insert_return<iterator, node_type>;
+
+ private:
+  // merge 需要访问其他实例化的底层表
+  template <class, class, class, class, class, class, class>
+  friend class unordered_map;
+
+ public:
+
   // -------------------------- 构造函数（覆盖标准核心接口）--------------------------
   // （1）默认构造
   unordered_map() noexcept(
@@ -269,11 +342,8 @@ class unordered_map {
       : unordered_map(il.begin(), il.end(), bucket_count, hf, ke, alloc) {}
 
   // （5）拷贝构造
-  unordered_map(const unordered_map& other) : table_(other.table_) {
-    // 重新设置桶数并插入元素（标准库的实现方式）
-    table_.rehash_unique(other.bucket_count());
-    insert(other.begin(), other.end());
-  }
+  // 底层表按对方的桶数一次分配，逐个复制节点并沿用保存的哈希值
+  unordered_map(const unordered_map& other) : table_(other.table_) {}
 
   // （6）移动构造
   unordered_map(unordered_map&& other) noexcept(
@@ -282,11 +352,7 @@ class unordered_map {
 
   // （7）分配器扩展构造（拷贝 + 自定义分配器）
   unordered_map(const unordered_map& other, const allocator_type& alloc)
-      : table_(other.table_, node_allocator(alloc)) {
-    // 重新设置桶数并插入元素
-    table_.rehash_unique(other.bucket_count());
-    insert(other.begin(), other.end());
-  }
+      : table_(other.table_, node_allocator(alloc)) {}
 
   // （8）分配器扩展构造（移动 + 自定义分配器）
   unordered_map(unordered_map&& other, const allocator_type& alloc)
@@ -352,6 +418,25 @@ class unordered_map {
     return it->second;
   }
 
+  // 异构版本：键直接传给 hash_table，不转换为 key_type
+  template <class K, class = enable_transparent_t<hasher, key_equal, K>>
+  mapped_type& at(const K& key) {
+    auto it = find(key);
+    if (it == end()) {
+      throw std::out_of_range("tinystl::unordered_map::at: key not found");
+    }
+    return it->second;
+  }
+
+  template <class K, class = enable_transparent_t<hasher, key_equal, K>>
+  const mapped_type& at(const K& key) const {
+    auto it = find(key);
+    if (it == end()) {
+      throw std::out_of_range("tinystl::unordered_map::at: key not found");
+    }
+    return it->second;
+  }
+
   // -------------------------- 插入接口（覆盖标准核心接口）--------------------------
   // （1）插入单个 value_type（返回 pair<iterator, bool>，bool 表示是否插入成功）
   std::pair<iterator, bool> insert(const value_type& val) {
@@ -364,11 +449,42 @@ class unordered_map {
     return {iterator(base_it), inserted};
   }
 
-  // （2）插入迭代器范围
+  // （2）插入迭代器范围：前向范围走批量插入（只扩容一次，键已存在时不构造节点）
   template <class InputIterator>
   void insert(InputIterator first, InputIterator last) {
-    for (; first != last; ++first) {
-      table_.insert_unique(*first);
+    if constexpr (is_keyed_forward_range<InputIterator, key_type>::value) {
+      insert_bulk(first, last);
+    } else {
+      for (; first != last; ++first) {
+        table_.insert_unique(*first);
+      }
+    }
+  }
+
+  // （2'）insert_bulk：批量插入前向范围（扩展接口）
+  // 按最终元素个数一次扩容，再按块先算哈希值、后插入，插入时预取后续桶槽。
+  // hash_threads > 1 时用多个线程计算哈希值，适合大量字符串键等哈希较贵的场景，
+  // 此时哈希函数须可被多个线程同时调用
+  template <class ForwardIterator>
+  void insert_bulk(ForwardIterator first, ForwardIterator last,
+                   unsigned hash_threads = 1) {
+    static_assert(
+        std::is_base_of_v<
+            std::forward_iterator_tag,
+            typename std::iterator_traits<ForwardIterator>::iterator_category>,
+        "insert_bulk requires a forward range");
+    auto n = static_cast<size_type>(std::distance(first, last));
+    if constexpr (is_keyed_forward_range<ForwardIterator, key_type>::value) {
+      table_.insert_unique_bulk(
+          first, n,
+          [](const auto& v) -> const key_type& { return v.first; },
+          hash_threads);
+    } else {
+      // 元素需先转换为 value_type 才能取得键，退化为预留空间后逐个插入
+      table_.reserve_unique(size() + n);
+      for (; first != last; ++first) {
+        table_.insert_unique(*first);
+      }
     }
   }
 
@@ -386,6 +502,69 @@ class unordered_map {
     return {iterator(base_it), inserted};
   }
 
+  // （5）try_emplace：键不存在时才用 args 原地构造 mapped_type（C++17）
+  // 先用裸键求哈希并查找，命中时不分配节点、不构造 mapped_type，args 也不会被移走
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args) {
+    auto [base_it, inserted] = table_.emplace_unique_key_args(
+        key, std::piecewise_construct, std::forward_as_tuple(key),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+    return {iterator(base_it), inserted};
+  }
+
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args) {
+    auto [base_it, inserted] = table_.emplace_unique_key_args(
+        key, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+    return {iterator(base_it), inserted};
+  }
+
+  // hint 仅为接口兼容，不影响插入位置
+  template <class... Args>
+  iterator try_emplace(const_iterator /*hint*/, const key_type& key,
+                       Args&&... args) {
+    return try_emplace(key, std::forward<Args>(args)...).first;
+  }
+
+  template <class... Args>
+  iterator try_emplace(const_iterator /*hint*/, key_type&& key,
+                       Args&&... args) {
+    return try_emplace(std::move(key), std::forward<Args>(args)...).first;
+  }
+
+  // （6）insert_or_assign：键不存在时插入，存在时把 obj 赋给已有的 mapped_type（C++17）
+  template <class M>
+  std::pair<iterator, bool> insert_or_assign(const key_type& key, M&& obj) {
+    auto r = try_emplace(key, std::forward<M>(obj));
+    if (!r.second) {
+      // 命中时 try_emplace 没有使用 obj，这里再转发一次是安全的
+      r.first->second = std::forward<M>(obj);
+    }
+    return r;
+  }
+
+  template <class M>
+  std::pair<iterator, bool> insert_or_assign(key_type&& key, M&& obj) {
+    auto r = try_emplace(std::move(key), std::forward<M>(obj));
+    if (!r.second) {
+      r.first->second = std::forward<M>(obj);
+    }
+    return r;
+  }
+
+  template <class M>
+  iterator insert_or_assign(const_iterator /*hint*/, const key_type& key,
+                            M&& obj) {
+    return insert_or_assign(key, std::forward<M>(obj)).first;
+  }
+
+  template <class M>
+  iterator insert_or_assign(const_iterator /*hint*/, key_type&& key,
+                            M&& obj) {
+    return insert_or_assign(std::move(key), std::forward<M>(obj)).first;
+  }
+
   // -------------------------- 查找与计数接口（覆盖标准核心接口）--------------------------
   // （1）find()：按键查找（返回迭代器）
   iterator find(const key_type& key) { return iterator(table_.find(key)); }
@@ -402,6 +581,58 @@ class unordered_map {
   // （3）contains()：判断键是否存在（C++20+，可选实现）
   bool contains(const key_type& key) const { return find(key) != end(); }
 
+  // （4）异构查找（C++20）：仅当 Hash 与 KeyEqual 均为透明时参与重载
+  template <class K, class = enable_transparent_t<hasher, key_equal, K>>
+  iterator find(const K& key) {
+    return iterator(table_.find(key));
+  }
+
+  template <class K, class = enable_transparent_t<hasher, key_equal, K>>
+  const_iterator find(const K& key) const {
+    return const_iterator(table_.find(key));
+  }
+
+  template <class K, class = enable_transparent_t<hasher, key_equal, K>>
+  size_type count(const K& key) const {
+    return table_.count_unique(key);
+  }
+
+  template <class K, class = enable_transparent_t<hasher, key_equal, K>>
+  bool contains(const K& key) const {
+    return find(key) != end();
+  }
+
+  // （5）find_batch()：批量查找，out[i] 为 keys[i] 的结果，未找到为 end()
+  // 组内先统一求哈希并预取桶槽与节点，再逐个比较，大表上可隐藏内存延迟
+  void find_batch(const key_type* keys, size_type n, iterator* out) {
+    table_.find_batch(keys, n, out);
+  }
+
+  void find_batch(const key_type* keys, size_type n,
+                  const_iterator* out) const {
+    table_.find_batch(keys, n, out);
+  }
+
+  template <class K, class = enable_transparent_t<hasher, key_equal, K>>
+  void find_batch(const K* keys, size_type n, iterator* out) {
+    table_.find_batch(keys, n, out);
+  }
+
+  template <class K, class = enable_transparent_t<hasher, key_equal, K>>
+  void find_batch(const K* keys, size_type n, const_iterator* out) const {
+    table_.find_batch(keys, n, out);
+  }
+
+  // （6）find_hash()：哈希值已知的查找（扩展接口）。hash 必须等于
+  // hash_function()(key)，供已在表外算过哈希值的调用方避免重复计算
+  iterator find_hash(size_type hash, const key_type& key) {
+    return iterator(table_.find_hash(hash, key));
+  }
+
+  const_iterator find_hash(size_type hash, const key_type& key) const {
+    return const_iterator(table_.find_hash(hash, key));
+  }
+
   // -------------------------- 删除接口（覆盖标准核心接口）--------------------------
   // （1）按迭代器删除
   iterator erase(iterator pos) {
@@ -418,6 +649,16 @@ class unordered_map {
   // （2）按键删除（返回删除的元素个数，0 或 1）
   size_type erase(const key_type& key) { return table_.erase_unique(key); }
 
+  // 异构版本（C++23）：可转换为迭代器的类型仍走按迭代器删除
+  template <class K, class = enable_transparent_t<hasher, key_equal, K>,
+            std::enable_if_t<!std::is_convertible_v<const K&, iterator> &&
+                                 !std::is_convertible_v<const K&,
+                                                        const_iterator>,
+                             int> = 0>
+  size_type erase(const K& key) {
+    return table_.erase_unique(key);
+  }
+
   // （3）按迭代器范围删除
   iterator erase(iterator first, iterator last) {
     auto base_it = table_.erase(first.get_iterator(), last.get_iterator());
@@ -433,6 +674,64 @@ class unordered_map {
   // （4）清空容器
   void clear() noexcept { table_.clear(); }
 
+  // （4'）并行清空（扩展接口）：多个线程分桶区间释放节点，适合上千万元素的
+  // 大表。分配器须能在多个线程中同时释放（见 hash_concurrent_deallocate），
+  // 否则退回串行 clear
+  void clear(parallel_policy policy) noexcept { table_.clear(policy); }
+
+  // -------------------------- 节点句柄接口（extract、insert、merge，C++17）--------------------------
+  // 在表之间转移元素只重新链接节点，不分配内存、不拷贝元素。
+  // 两表分配器不相等时（例如各自持有独立池的 node_pool_allocator），
+  // insert 与 merge 退化为在目标表分配新节点并移动元素。
+  // （1）extract：摘下节点，返回持有它的句柄；键不存在时返回空句柄
+  node_type extract(const_iterator pos) {
+    return table_.template node_handle_extract<node_type>(pos.get_iterator());
+  }
+
+  node_type extract(const key_type& key) {
+    return table_.template node_handle_extract_unique<node_type>(key);
+  }
+
+  // 异构版本（C++23）：可转换为迭代器的类型仍走按迭代器摘取
+  template <class K, class = enable_transparent_t<hasher, key_equal, K>,
+            std::enable_if_t<!std::is_convertible_v<const K&, iterator> &&
+                                 !std::is_convertible_v<const K&,
+                                                        const_iterator>,
+                             int> = 0>
+  node_type extract(const K& key) {
+    return table_.template node_handle_extract_unique<node_type>(key);
+  }
+
+  // （2）insert：插入句柄持有的节点；键已存在时节点留在返回值的 node 中
+  insert_return_type insert(node_type&& nh) {
+    auto r = table_.template node_handle_insert_unique<
+        node_type, node_insert_return<typename base_hash_table::iterator,
+                                      node_type>>(std::move(nh));
+    return insert_return_type{iterator(r.position), r.inserted,
+                              std::move(r.node)};
+  }
+
+  // hint 仅为接口兼容，不影响插入位置
+  iterator insert(const_iterator /*hint*/, node_type&& nh) {
+    return insert(std::move(nh)).position;
+  }
+
+  // （3）merge：把 source 中本表没有的键移入本表，已有的键留在 source。
+  // 哈希函数为同一无状态类型时直接沿用节点缓存的哈希值，不再重新计算
+  template <class H2, class E2, class P2>
+  void merge(
+      unordered_map<Key, T, H2, E2, Allocator, P2, HashCache>& source) {
+    constexpr bool reuse_hash =
+        std::is_same_v<Hash, H2> && std::is_empty_v<Hash>;
+    table_.node_handle_merge_unique(source.table_, reuse_hash);
+  }
+
+  template <class H2, class E2, class P2>
+  void merge(
+      unordered_map<Key, T, H2, E2, Allocator, P2, HashCache>&& source) {
+    merge(source);
+  }
+
   // -------------------------- 迭代器接口（覆盖标准核心接口）--------------------------
   iterator begin() noexcept { return iterator(table_.begin()); }
   iterator end() noexcept { return iterator(table_.end()); }
@@ -452,6 +751,11 @@ class unordered_map {
   // （2）获取键对应的桶索引
   size_type bucket(const key_type& key) const { return table_.bucket(key); }
 
+  template <class K, class = enable_transparent_t<hasher, key_equal, K>>
+  size_type bucket(const K& key) const {
+    return table_.bucket(key);
+  }
+
   // （3）获取指定桶的大小（元素个数）
   size_type bucket_size(size_type n) const { return table_.bucket_size(n); }
 
@@ -480,6 +784,44 @@ class unordered_map {
   // （4）预留元素空间（确保能容纳 n 个元素而不扩容）
   void reserve(size_type n) { table_.reserve_unique(n); }
 
+  // （3'）（4'）并行 rehash / reserve（扩展接口）：多个线程分桶区间重新链接
+  // 节点，适合上千万元素的大表。哈希函数须可被多个线程同时调用；
+  // 元素太少时按串行实现执行。用法：map.rehash(n, mystl::par)
+  void rehash(size_type n, parallel_policy policy) {
+    table_.rehash_unique(n, policy);
+  }
+
+  void reserve(size_type n, parallel_policy policy) {
+    table_.reserve_unique(n, policy);
+  }
+
+  // （5）渐进式 rehash（扩展接口，默认关闭）
+  // 开启后插入触发的扩容分摊到后续的插入、查找与删除上完成，单次插入
+  // 不再因搬移全部节点而卡顿；查找在迁移期间依然正确。
+  // 细节见 hash_table::set_incremental_rehash
+  void set_incremental_rehash(bool enable) noexcept {
+    table_.set_incremental_rehash(enable);
+  }
+
+  bool incremental_rehash() const noexcept {
+    return table_.incremental_rehash();
+  }
+
+  bool rehash_in_progress() const noexcept {
+    return table_.rehash_in_progress();
+  }
+
+  void finish_rehash() noexcept { table_.finish_rehash(); }
+
+  // （6）统计信息（扩展接口）：链长分布、空桶比例、平均探测次数、内存占用，
+  // 以及 TINYSTL_HASH_TABLE_COUNTERS 开启时的 rehash 计数器
+  hash_table_stats stats() const { return table_.stats(); }
+
+  // 内存占用，见 memory_footprint
+  memory_footprint memory_usage() const noexcept {
+    return table_.memory_usage();
+  }
+
   // -------------------------- 其他辅助接口 --------------------------
   // （1）获取分配器
   allocator_type get_allocator() const noexcept {
@@ -531,14 +873,19 @@ class unordered_map_hasher {
   // 核心：计算 Key 的哈希值（供 hash_table 查找时使用）
   size_t operator()(const Key& key) const { return hash_(key); }
 
+  // 异构查找：Hash 为透明哈希时，直接对其他键类型求哈希
+  template <class K, class H = Hash, class = typename H::is_transparent>
+  size_t operator()(const K& key) const {
+    return hash_(key);
+  }
+
   // 暴露原始哈希函数（供 unordered_map::hash_function() 使用）
   const Hash& hash_function() const noexcept { return hash_; }
 
   // 交换两个适配器
   void swap(unordered_map_hasher& other) noexcept(
       std::is_nothrow_swappable_v<Hash>) {
-    using std::swap;
-    swap(hash_, other.hash_);
+    std::swap(hash_, other.hash_);
   }
 };
 
@@ -573,30 +920,46 @@ class unordered_map_key_equal {
     return key_eq_(key, val.get_key());
   }
 
+  // 异构查找：KeyEqual 为透明比较时，直接与其他键类型比较
+  template <class K, class E = KeyEqual, class = typename E::is_transparent>
+  bool operator()(const ValueType& val, const K& key) const {
+    return key_eq_(val.get_key(), key);
+  }
+
+  template <class K, class E = KeyEqual, class = typename E::is_transparent>
+  bool operator()(const K& key, const ValueType& val) const {
+    return key_eq_(key, val.get_key());
+  }
+
   // 暴露原始键比较函数（供 unordered_map::key_eq() 使用）
   const KeyEqual& key_eq() const noexcept { return key_eq_; }
 
   // 交换两个适配器
   void swap(unordered_map_key_equal& other) noexcept(
       std::is_nothrow_swappable_v<KeyEqual>) {
-    using std::swap;
-    swap(key_eq_, other.key_eq_);
+    std::swap(key_eq_, other.key_eq_);
   }
 };
 
 // -------------------------- 非成员函数（覆盖标准核心接口）--------------------------
 // （1）交换两个 unordered_map
-template <class Key, class T, class Hash, class KeyEqual, class Allocator>
-void swap(unordered_map<Key, T, Hash, KeyEqual, Allocator>& lhs,
-          unordered_map<Key, T, Hash, KeyEqual, Allocator>&
-              rhs) noexcept(noexcept(lhs.swap(rhs))) {
+template <class Key, class T, class Hash, class KeyEqual, class Allocator,
+          class BucketPolicy, class HashCache>
+void swap(
+    unordered_map<Key, T, Hash, KeyEqual, Allocator, BucketPolicy, HashCache>&
+        lhs,
+    unordered_map<Key, T, Hash, KeyEqual, Allocator, BucketPolicy, HashCache>&
+        rhs) noexcept(noexcept(lhs.swap(rhs))) {
   lhs.swap(rhs);
 }
 
 // （2）相等性比较（==、!=）
-template <class Key, class T, class Hash, class KeyEqual, class Allocator>
-bool operator==(const unordered_map<Key, T, Hash, KeyEqual, Allocator>& lhs,
-                const unordered_map<Key, T, Hash, KeyEqual, Allocator>& rhs) {
+template <class Key, class T, class Hash, class KeyEqual, class Allocator,
+          class BucketPolicy, class HashCache>
+bool operator==(const unordered_map<Key, T, Hash, KeyEqual, Allocator,
+                                    BucketPolicy, HashCache>& lhs,
+                const unordered_map<Key, T, Hash, KeyEqual, Allocator,
+                                    BucketPolicy, HashCache>& rhs) {
   if (lhs.size() != rhs.size()) {
     return false;
   }
@@ -610,9 +973,12 @@ bool operator==(const unordered_map<Key, T, Hash, KeyEqual, Allocator>& lhs,
   return true;
 }
 
-template <class Key, class T, class Hash, class KeyEqual, class Allocator>
-bool operator!=(const unordered_map<Key, T, Hash, KeyEqual, Allocator>& lhs,
-                const unordered_map<Key, T, Hash, KeyEqual, Allocator>& rhs) {
+template <class Key, class T, class Hash, class KeyEqual, class Allocator,
+          class BucketPolicy, class HashCache>
+bool operator!=(const unordered_map<Key, T, Hash, KeyEqual, Allocator,
+                                    BucketPolicy, HashCache>& lhs,
+                const unordered_map<Key, T, Hash, KeyEqual, Allocator,
+                                    BucketPolicy, HashCache>& rhs) {
   return !(lhs == rhs);
 }
 
@@ -5,8 +5,10 @@
 #include <mystl/utility.h>
 #include <mystl/iterator.h>
 #include <mystl/type_traits.h>
+#include <algorithm>
 #include <cstddef>
 #include <initializer_list>
+#include <stdexcept>
 namespace mystl {
 
 template <class T, class Alloc = mystl::allocator<T>>
@@ -83,6 +85,21 @@ class vector {
   size_type size() const { return _finish - _start; }
   size_type capacity() const { return _end_of_storage - _start; }
   bool empty() const { return _start == _finish; }
+  size_type max_size() const noexcept {
+    return static_cast<size_type>(-1) / sizeof(T);
+  }
+
+  // 内存占用：一块连续存储，[size, capacity) 为 slack
+  memory_footprint memory_usage() const noexcept {
+    memory_footprint f;
+    f.payload_bytes = size() * sizeof(T);
+    f.slack_bytes = (capacity() - size()) * sizeof(T);
+    if (capacity() != 0) {
+      f.rounding_bytes = allocation_rounding<Alloc>::bytes(capacity());
+      f.allocations = 1;
+    }
+    return f;
+  }
 
   iterator begin() { return _start; }
 
@@ -92,10 +109,36 @@ class vector {
 
   const_iterator end() const { return _finish; }
 
+  const_iterator cbegin() const { return _start; }
+
+  const_iterator cend() const { return _finish; }
+
   reference operator[](size_type n) { return _start[n]; }
 
   const_reference operator[](size_type n) const { return _start[n]; }
 
+  reference at(size_type n) {
+    if (n >= size()) {
+      throw std::out_of_range("vector");
+    }
+    return _start[n];
+  }
+
+  const_reference at(size_type n) const {
+    if (n >= size()) {
+      throw std::out_of_range("vector");
+    }
+    return _start[n];
+  }
+
+  reference front() { return *_start; }
+  const_reference front() const { return *_start; }
+  reference back() { return *(_finish - 1); }
+  const_reference back() const { return *(_finish - 1); }
+
+  pointer data() noexcept { return _start; }
+  const_pointer data() const noexcept { return _start; }
+
   ~vector() {
     if (_start) {
       allocator.destroy(_start, _finish);
@@ -104,23 +147,65 @@ class vector {
     _start = _finish = _end_of_storage = nullptr;
   }
 
-  void push_back(const value_type& value) {
-    if (_finish == _end_of_storage) {
-      size_type old_size = size();
-      size_type old_capacity = capacity();
-      size_type new_capacity = old_capacity == 0 ? 1 : old_capacity * 2;
-      pointer new_start = allocator.allocate(new_capacity);
-      // 优先使用移动，如果不行则拷贝
-      mystl::uninitialized_move(_start, _finish, new_start);
-      // 销毁旧对象并释放旧内存
-      allocator.destroy(_start, _finish);
-      allocator.deallocate(_start, old_capacity);
-      _finish = new_start + old_size;
-      _start = new_start;
-      _end_of_storage = _start + new_capacity;
+  // -------------------------- 容量 --------------------------
+  // 只扩容不缩容；n 不超过 capacity() 时什么也不做
+  void reserve(size_type n) {
+    if (n > capacity()) {
+      if (n > max_size()) {
+        throw std::length_error("vector");
+      }
+      reallocate(n);
+    }
+  }
+
+  void shrink_to_fit() {
+    if (size() < capacity()) {
+      reallocate(size());
+    }
+  }
+
+  void resize(size_type n) {
+    if (n <= size()) {
+      erase_at_end(_start + n);
+      return;
+    }
+    if (n > capacity()) {
+      reserve(recommend(n));
+    }
+    pointer cur = _finish;
+    try {
+      for (; cur != _start + n; ++cur) {
+        allocator.construct(cur);
+      }
+    } catch (...) {
+      allocator.destroy(_finish, cur);
+      throw;
+    }
+    _finish = cur;
+  }
+
+  void resize(size_type n, const value_type& value) {
+    if (n <= size()) {
+      erase_at_end(_start + n);
+    } else {
+      insert(end(), n - size(), value);
+    }
+  }
+
+  // -------------------------- 修改器 --------------------------
+  void push_back(const value_type& value) { emplace_back(value); }
+
+  void push_back(value_type&& value) { emplace_back(mystl::move(value)); }
+
+  template <class... Args>
+  reference emplace_back(Args&&... args) {
+    if (_finish != _end_of_storage) {
+      allocator.construct(_finish, mystl::forward<Args>(args)...);
+      ++_finish;
+    } else {
+      realloc_emplace(_finish, mystl::forward<Args>(args)...);
     }
-    allocator.construct(_finish, value);
-    _finish++;
+    return back();
   }
 
   void pop_back() {
@@ -130,17 +215,92 @@ class vector {
     }
   }
 
-  void shrink_to_fit() {
-    if (size() < capacity()) {
-      size_type old_size = size();
-      pointer new_start = allocator.allocate(old_size);
-      mystl::uninitialized_move(_start, _finish, new_start);
-      allocator.destroy(_start, _finish);
-      allocator.deallocate(_start, capacity());
-      _start = new_start;
-      _finish = _start + old_size;
-      _end_of_storage = _start + old_size;
+  void clear() noexcept { erase_at_end(_start); }
+
+  template <class... Args>
+  iterator emplace(const_iterator pos, Args&&... args) {
+    pointer p = _start + (pos - _start);
+    if (_finish == _end_of_storage) {
+      return realloc_emplace(p, mystl::forward<Args>(args)...);
+    }
+    if (p == _finish) {
+      allocator.construct(_finish, mystl::forward<Args>(args)...);
+      ++_finish;
+      return p;
+    }
+    // 先构造出新值，参数可能引用容器内的元素
+    value_type tmp(mystl::forward<Args>(args)...);
+    allocator.construct(_finish, mystl::move(*(_finish - 1)));
+    ++_finish;
+    move_backward(p, _finish - 2, _finish - 1);
+    *p = mystl::move(tmp);
+    return p;
+  }
+
+  iterator insert(const_iterator pos, const value_type& value) {
+    return emplace(pos, value);
+  }
+
+  iterator insert(const_iterator pos, value_type&& value) {
+    return emplace(pos, mystl::move(value));
+  }
+
+  iterator insert(const_iterator pos, size_type n, const value_type& value) {
+    pointer p = _start + (pos - _start);
+    if (n == 0) {
+      return p;
+    }
+    if (n > size_type(_end_of_storage - _finish)) {
+      size_type new_cap = recommend(size() + n);
+      if constexpr (allocator_can_reallocate<Alloc>::value) {
+        // value 可能引用容器内的元素，调整内存块之前先复制一份
+        size_type off = static_cast<size_type>(p - _start);
+        value_type tmp(value);
+        resize_storage(new_cap);
+        return fill_insert(_start + off, n, tmp);
+      } else {
+        // 新元素先构造到新内存中，value 引用容器内元素时依然有效
+        pointer new_start = allocator.allocate(new_cap);
+        pointer new_pos = new_start + (p - _start);
+        try {
+          mystl::uninitialized_fill_n(new_pos, n, value);
+        } catch (...) {
+          allocator.deallocate(new_start, new_cap);
+          throw;
+        }
+        return adopt_storage(new_start, new_cap, p, n);
+      }
+    }
+    value_type tmp(value);
+    return fill_insert(p, n, tmp);
+  }
+
+  // 前向迭代器一次算出元素个数，至多重新分配一次
+  template <class InputIterator,
+            typename = typename mystl::enable_if<
+                !mystl::is_integral<InputIterator>::value>::type>
+  iterator insert(const_iterator pos, InputIterator first,
+                  InputIterator last) {
+    return insert_range(_start + (pos - _start), first, last,
+                        mystl::iterator_category(first));
+  }
+
+  iterator insert(const_iterator pos, std::initializer_list<T> il) {
+    return insert(pos, il.begin(), il.end());
+  }
+
+  iterator erase(const_iterator pos) {
+    pointer p = _start + (pos - _start);
+    erase_at_end(move_forward(p + 1, _finish, p));
+    return p;
+  }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    pointer p = _start + (first - _start);
+    if (first != last) {
+      erase_at_end(move_forward(_start + (last - _start), _finish, p));
     }
+    return p;
   }
 
   //利用 RAII，会自动构析销毁原数据
@@ -166,11 +326,206 @@ class vector {
   }
 
  private:
+  // 扩容后的容量：至少翻倍，保证 push_back 均摊 O(1)
+  size_type recommend(size_type new_size) const {
+    if (new_size > max_size()) {
+      throw std::length_error("vector");
+    }
+    size_type cap = capacity();
+    if (cap >= max_size() / 2) {
+      return max_size();
+    }
+    return cap * 2 > new_size ? cap * 2 : new_size;
+  }
+
+  // 析构 [new_end, _finish)
+  void erase_at_end(pointer new_end) noexcept {
+    allocator.destroy(new_end, _finish);
+    _finish = new_end;
+  }
+
+  // 把全部元素重定位到容量为 new_cap 的新内存
+  void reallocate(size_type new_cap) {
+    if constexpr (allocator_can_reallocate<Alloc>::value) {
+      resize_storage(new_cap);
+    } else {
+      pointer new_start = allocator.allocate(new_cap);
+      adopt_storage(new_start, new_cap, _finish, 0);
+    }
+  }
+
+  // 分配器支持 reallocate（见 mystl::allocator）时直接调整原内存块的大小，
+  // 元素按字节随块搬迁：能原地扩展或由 mremap 重新映射时不复制数据
+  void resize_storage(size_type new_cap) {
+    size_type n = size();
+    _start = allocator.reallocate(_start, capacity(), new_cap);
+    _finish = _start + n;
+    _end_of_storage = _start + new_cap;
+  }
+
+  // 新内存中 [pos 对应位置, +n) 已经构造好新元素，把旧元素重定位到它的
+  // 两侧并释放旧内存，返回指向第一个新元素的指针。
+  // 可平凡重定位的类型直接 memcpy；否则先全部移动，成功后再析构旧元素，
+  // 移动抛出异常时容器保持原样
+  pointer adopt_storage(pointer new_start, size_type new_cap, pointer pos,
+                        size_type n) {
+    pointer new_pos = new_start + (pos - _start);
+    size_type new_size = size() + n;
+    if constexpr (is_trivially_relocatable<T>::value) {
+      mystl::uninitialized_relocate(_start, pos, new_start);
+      mystl::uninitialized_relocate(pos, _finish, new_pos + n);
+    } else {
+      try {
+        mystl::uninitialized_move(_start, pos, new_start);
+        try {
+          mystl::uninitialized_move(pos, _finish, new_pos + n);
+        } catch (...) {
+          allocator.destroy(new_start, new_pos);
+          throw;
+        }
+      } catch (...) {
+        allocator.destroy(new_pos, new_pos + n);
+        allocator.deallocate(new_start, new_cap);
+        throw;
+      }
+      allocator.destroy(_start, _finish);
+    }
+    if (_start) {
+      allocator.deallocate(_start, capacity());
+    }
+    _start = new_start;
+    _finish = new_start + new_size;
+    _end_of_storage = new_start + new_cap;
+    return new_pos;
+  }
+
+  // 容量不足时的 emplace：先在新内存中构造新元素，再搬迁旧元素
+  template <class... Args>
+  pointer realloc_emplace(pointer pos, Args&&... args) {
+    size_type new_cap = recommend(size() + 1);
+    if constexpr (allocator_can_reallocate<Alloc>::value) {
+      if (pos == _finish) {
+        // 参数可能引用容器内的元素，调整内存块之前先构造出新值
+        value_type tmp(mystl::forward<Args>(args)...);
+        resize_storage(new_cap);
+        allocator.construct(_finish, mystl::move(tmp));
+        return _finish++;
+      }
+    }
+    pointer new_start = allocator.allocate(new_cap);
+    pointer new_pos = new_start + (pos - _start);
+    try {
+      allocator.construct(new_pos, mystl::forward<Args>(args)...);
+    } catch (...) {
+      allocator.deallocate(new_start, new_cap);
+      throw;
+    }
+    return adopt_storage(new_start, new_cap, pos, 1);
+  }
+
+  // 容量足够时在 pos 处插入 n 个 v；v 不能引用容器内的元素
+  pointer fill_insert(pointer pos, size_type n, const value_type& v) {
+    size_type elems_after = static_cast<size_type>(_finish - pos);
+    pointer old_finish = _finish;
+    if (elems_after > n) {
+      _finish = mystl::uninitialized_move(_finish - n, _finish, _finish);
+      move_backward(pos, old_finish - n, old_finish);
+      std::fill_n(pos, n, v);
+    } else {
+      _finish = mystl::uninitialized_fill_n(_finish, n - elems_after, v);
+      _finish = mystl::uninitialized_move(pos, old_finish, _finish);
+      std::fill_n(pos, elems_after, v);
+    }
+    return pos;
+  }
+
+  // 单遍输入迭代器：逐个插入
+  template <class InputIterator>
+  pointer insert_range(pointer pos, InputIterator first, InputIterator last,
+                       mystl::input_iterator_tag) {
+    size_type off = static_cast<size_type>(pos - _start);
+    for (size_type i = off; first != last; ++first, ++i) {
+      emplace(_start + i, *first);
+    }
+    return _start + off;
+  }
+
+  template <class ForwardIterator>
+  pointer insert_range(pointer pos, ForwardIterator first,
+                       ForwardIterator last, mystl::forward_iterator_tag) {
+    size_type n = static_cast<size_type>(mystl::distance(first, last));
+    if (n == 0) {
+      return pos;
+    }
+    if (n > size_type(_end_of_storage - _finish)) {
+      size_type new_cap = recommend(size() + n);
+      pointer new_start = allocator.allocate(new_cap);
+      pointer new_pos = new_start + (pos - _start);
+      try {
+        mystl::uninitialized_copy(first, last, new_pos);
+      } catch (...) {
+        allocator.deallocate(new_start, new_cap);
+        throw;
+      }
+      return adopt_storage(new_start, new_cap, pos, n);
+    }
+    size_type elems_after = static_cast<size_type>(_finish - pos);
+    pointer old_finish = _finish;
+    if (elems_after > n) {
+      _finish = mystl::uninitialized_move(_finish - n, _finish, _finish);
+      move_backward(pos, old_finish - n, old_finish);
+      copy_range(first, last, pos);
+    } else {
+      ForwardIterator mid = first;
+      mystl::advance(mid, elems_after);
+      _finish = mystl::uninitialized_copy(mid, last, _finish);
+      _finish = mystl::uninitialized_move(pos, old_finish, _finish);
+      copy_range(first, mid, pos);
+    }
+    return pos;
+  }
+
+  template <class InputIterator>
+  static void copy_range(InputIterator first, InputIterator last,
+                         pointer dest) {
+    for (; first != last; ++first, ++dest) {
+      *dest = *first;
+    }
+  }
+
+  // 在已构造的元素之间平移：平凡拷贝的类型经 mystl::copy 整块 memmove，
+  // 其他类型逐个移动赋值
+  static pointer move_forward(pointer first, pointer last, pointer dest) {
+    if constexpr (is_trivially_copyable<T>::value) {
+      return mystl::copy(first, last, dest);
+    } else {
+      for (; first != last; ++first, ++dest) {
+        *dest = mystl::move(*first);
+      }
+      return dest;
+    }
+  }
+
+  static void move_backward(pointer first, pointer last, pointer dest_last) {
+    if constexpr (is_trivially_copyable<T>::value) {
+      mystl::copy(first, last, dest_last - (last - first));
+    } else {
+      while (first != last) {
+        *--dest_last = mystl::move(*--last);
+      }
+    }
+  }
+
   pointer _start = nullptr;   // 指向数据区起始位置
   pointer _finish = nullptr;  // 指向有效元素的末尾（即下一个待插入位置）
   pointer _end_of_storage = nullptr;  // 指向整个内存缓冲区的末尾
   Alloc allocator;
 };
+
+// 元素在堆上，对象本身只有三个指针和分配器，可以整体 memcpy
+template <class T, class Alloc>
+struct is_trivially_relocatable<vector<T, Alloc>>
+    : public is_trivially_relocatable<Alloc> {};
 }  // namespace mystl
 
 #endif
\ No newline at end of file
@@ -0,0 +1,157 @@
+#include "gtest/gtest.h"
+#include <mystl/concurrent_unordered_map.h>
+#include <mystl/__memory/node_pool_allocator.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 单线程下的基本语义
+TEST(ConcurrentUnorderedMapTest, BasicOperations) {
+  mystl::concurrent_unordered_map<int, std::string> map(8);
+  EXPECT_EQ(map.shard_count(), 8u);
+  EXPECT_TRUE(map.empty());
+
+  EXPECT_TRUE(map.insert({1, "one"}));
+  EXPECT_FALSE(map.insert({1, "uno"}));
+  EXPECT_TRUE(map.try_emplace(2, 3, 'x'));
+  EXPECT_FALSE(map.try_emplace(2, "ignored"));
+  EXPECT_EQ(map.find(1).value(), "one");
+  EXPECT_EQ(map.find(2).value(), "xxx");
+  EXPECT_FALSE(map.find(3).has_value());
+  EXPECT_TRUE(map.contains(2));
+  EXPECT_EQ(map.count(3), 0u);
+
+  EXPECT_FALSE(map.insert_or_assign(1, "ONE"));
+  EXPECT_TRUE(map.insert_or_assign(3, "three"));
+  EXPECT_EQ(map.find(1).value(), "ONE");
+
+  EXPECT_TRUE(map.update(3, [](std::string& s) { s += "!"; }));
+  EXPECT_FALSE(map.update(4, [](std::string& s) { s += "!"; }));
+  size_t len = 0;
+  EXPECT_TRUE(map.visit(3, [&](const std::string& s) { len = s.size(); }));
+  EXPECT_EQ(len, 6u);
+
+  EXPECT_EQ(map.size(), 3u);
+  EXPECT_EQ(map.erase(2), 1u);
+  EXPECT_EQ(map.erase(2), 0u);
+  EXPECT_EQ(map.size(), 2u);
+
+  map.clear();
+  EXPECT_TRUE(map.empty());
+}
+
+// 分片数向上取整为 2 的幂，键分散到多个分片
+TEST(ConcurrentUnorderedMapTest, ShardsAndForEach) {
+  mystl::concurrent_unordered_map<int, int> single(1);
+  EXPECT_EQ(single.shard_count(), 1u);
+  mystl::concurrent_unordered_map<int, int> map(5);
+  EXPECT_EQ(map.shard_count(), 8u);
+  map.reserve(1000);
+  for (int i = 0; i < 1000; ++i) {
+    map.insert({i, i});
+    single.insert({i, i});
+  }
+  map.for_each([](std::pair<const int, int>& kv) { kv.second *= 2; });
+  long long sum = 0;
+  size_t n = 0;
+  const auto& cmap = map;
+  cmap.for_each([&](const std::pair<const int, int>& kv) {
+    EXPECT_EQ(kv.second, kv.first * 2);
+    sum += kv.second;
+    ++n;
+  });
+  EXPECT_EQ(n, 1000u);
+  EXPECT_EQ(sum, 999LL * 1000);
+  EXPECT_EQ(single.size(), 1000u);
+}
+
+// 多线程：每个线程插入自己的键段，同时对共享计数器做 update
+TEST(ConcurrentUnorderedMapTest, ConcurrentInsertUpdateErase) {
+  mystl::concurrent_unordered_map<int, long long> map;
+  map.set_incremental_rehash(true);
+  const int threads = 8;
+  const int per_thread = 20000;
+  const int counters = 16;
+  for (int c = 0; c < counters; ++c) {
+    map.insert({-1 - c, 0});
+  }
+
+  std::vector<std::thread> pool;
+  for (int t = 0; t < threads; ++t) {
+    pool.emplace_back([&map, t] {
+      for (int i = 0; i < per_thread; ++i) {
+        int key = t * per_thread + i;
+        map.insert({key, key});
+        map.update(-1 - (i % counters), [](long long& v) { ++v; });
+        if (i % 3 == 0) {
+          map.erase(key);
+        }
+        EXPECT_EQ(map.find(key).has_value(), i % 3 != 0);
+      }
+    });
+  }
+  for (std::thread& th : pool) {
+    th.join();
+  }
+
+  long long total = 0;
+  for (int c = 0; c < counters; ++c) {
+    total += map.find(-1 - c).value();
+  }
+  EXPECT_EQ(total, static_cast<long long>(threads) * per_thread);
+  size_t expected = counters;
+  for (int i = 0; i < per_thread; ++i) {
+    expected += i % 3 != 0 ? threads : 0;
+  }
+  EXPECT_EQ(map.size(), expected);
+}
+
+// 并发读写同一批键：读者看到的要么不存在，要么是完整写入的值
+TEST(ConcurrentUnorderedMapTest, ReadersSeeConsistentValues) {
+  mystl::concurrent_unordered_map<int, std::string> map(4);
+  std::atomic<bool> stop{false};
+  std::thread writer([&] {
+    for (int round = 0; round < 200; ++round) {
+      for (int k = 0; k < 100; ++k) {
+        map.insert_or_assign(k, std::string(64, static_cast<char>('a' + round % 26)));
+        if (k % 7 == 0) {
+          map.erase(k);
+        }
+      }
+    }
+    stop = true;
+  });
+  std::thread reader([&] {
+    while (!stop) {
+      for (int k = 0; k < 100; ++k) {
+        map.visit(k, [](const std::string& s) {
+          EXPECT_EQ(s.size(), 64u);
+          EXPECT_EQ(s.find_first_not_of(s[0]), std::string::npos);
+        });
+      }
+    }
+  });
+  writer.join();
+  reader.join();
+}
+
+// 有状态分配器：各分片使用独立的池
+TEST(ConcurrentUnorderedMapTest, PoolAllocatorPerShard) {
+  using alloc_type = mystl::node_pool_allocator<std::pair<const int, int>>;
+  mystl::concurrent_unordered_map<int, int, std::hash<int>, std::equal_to<int>,
+                                  alloc_type>
+      map(4);
+  std::vector<std::thread> pool;
+  for (int t = 0; t < 4; ++t) {
+    pool.emplace_back([&map, t] {
+      for (int i = 0; i < 10000; ++i) {
+        map.insert({t * 10000 + i, i});
+      }
+    });
+  }
+  for (std::thread& th : pool) {
+    th.join();
+  }
+  EXPECT_EQ(map.size(), 40000u);
+}
@@ -516,3 +516,19 @@ TEST(DequeTest, IteratorSubscript) {
   EXPECT_EQ(it[4], 5);
 }
 
+// 测试内存占用统计：块内空位为 slack，块映射为 overhead
+TEST(DequeTest, MemoryUsage) {
+  mystl::deque<int> d;
+  EXPECT_EQ(mystl::footprint(d).total_bytes(), 0);
+
+  const size_t block = mystl::deque<int>::block_size;
+  for (size_t i = 0; i < block + 1; ++i) {
+    d.push_back(static_cast<int>(i));
+  }
+  mystl::memory_footprint f = d.memory_usage();
+  EXPECT_EQ(f.payload_bytes, (block + 1) * sizeof(int));
+  EXPECT_EQ((f.payload_bytes + f.slack_bytes) % (block * sizeof(int)), 0);
+  EXPECT_GE(f.payload_bytes + f.slack_bytes, 2 * block * sizeof(int));
+  EXPECT_GE(f.overhead_bytes, 2 * sizeof(int*));
+  EXPECT_GE(f.allocations, 3);  // 至少两个块加一个块映射
+}
@@ -0,0 +1,148 @@
+#include "gtest/gtest.h"
+#include <mystl/filtered_unordered_map.h>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// 过滤器不漏报，误判率接近目标
+TEST(BlockedBloomFilterTest, NoFalseNegatives) {
+  for (double rate : {0.1, 0.01, 0.001}) {
+    const size_t n = 100000;
+    mystl::blocked_bloom_filter filter(n, rate);
+    std::hash<uint64_t> hash;
+    for (uint64_t i = 0; i < n; ++i) {
+      filter.insert(hash(i * 7));
+    }
+    for (uint64_t i = 0; i < n; ++i) {
+      ASSERT_TRUE(filter.may_contain(hash(i * 7))) << i;
+    }
+    size_t positives = 0;
+    const size_t probes = 200000;
+    for (uint64_t i = 0; i < probes; ++i) {
+      positives += filter.may_contain(hash(i * 7 + 3));
+    }
+    double observed = static_cast<double>(positives) / probes;
+    EXPECT_LT(observed, rate * 2) << rate;
+  }
+}
+
+TEST(BlockedBloomFilterTest, InvalidRateThrows) {
+  EXPECT_THROW(mystl::blocked_bloom_filter(10, 0.0), std::invalid_argument);
+  EXPECT_THROW(mystl::blocked_bloom_filter(10, 1.0), std::invalid_argument);
+  mystl::blocked_bloom_filter empty;
+  EXPECT_TRUE(empty.may_contain(42));
+}
+
+// 基本操作与 std::unordered_map 一致，统计计数器正确
+TEST(FilteredUnorderedMapTest, LookupsAndStats) {
+  mystl::filtered_unordered_map<std::string, int> map;
+  for (int i = 0; i < 1000; ++i) {
+    map["deny-" + std::to_string(i)] = i;
+  }
+  EXPECT_EQ(map.size(), 1000u);
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(map.at("deny-" + std::to_string(i)), i);
+  }
+  mystl::filter_stats s = map.stats();
+  EXPECT_EQ(s.lookups, 1000u);
+  EXPECT_EQ(s.filtered, 0u);
+  EXPECT_EQ(s.false_positives, 0u);
+
+  map.reset_stats();
+  for (int i = 0; i < 10000; ++i) {
+    EXPECT_FALSE(map.contains("allow-" + std::to_string(i)));
+  }
+  s = map.stats();
+  EXPECT_EQ(s.lookups, 10000u);
+  EXPECT_EQ(s.filtered + s.false_positives, 10000u);
+  EXPECT_GT(s.filter_hit_rate, 0.95);
+  EXPECT_LT(s.observed_false_positive_rate, 0.03);
+  EXPECT_GE(s.filter_capacity, map.size());
+  EXPECT_GT(s.filter_bytes, 0u);
+  EXPECT_THROW(map.at("allow-1"), std::out_of_range);
+}
+
+// 删除后不再能找到；过滤器随增长重建后仍不漏报
+TEST(FilteredUnorderedMapTest, RandomOperations) {
+  mystl::filtered_unordered_map<uint64_t, uint64_t> map(0, 0.001);
+  std::unordered_map<uint64_t, uint64_t> ref;
+  std::mt19937_64 rng(20);
+  for (int step = 0; step < 200000; ++step) {
+    uint64_t k = rng() % 50000;
+    switch (rng() % 5) {
+      case 0:
+        EXPECT_EQ(map.erase(k), ref.erase(k));
+        break;
+      case 1:
+        EXPECT_EQ(map.count(k), ref.count(k));
+        break;
+      case 2:
+        EXPECT_EQ(map.insert_or_assign(k, step).second,
+                  ref.insert_or_assign(k, step).second);
+        break;
+      default:
+        EXPECT_EQ(map.try_emplace(k, step).second,
+                  ref.try_emplace(k, step).second);
+    }
+  }
+  ASSERT_EQ(map.size(), ref.size());
+  for (const auto& kv : ref) {
+    auto it = map.find(kv.first);
+    ASSERT_NE(it, map.end());
+    EXPECT_EQ(it->second, kv.second);
+  }
+  size_t visited = 0;
+  for (const auto& kv : map) {
+    EXPECT_EQ(ref.at(kv.first), kv.second);
+    ++visited;
+  }
+  EXPECT_EQ(visited, ref.size());
+}
+
+// clear 清空过滤器；swap、移动后查找仍然正确
+TEST(FilteredUnorderedMapTest, ClearSwapMove) {
+  mystl::filtered_unordered_map<int, int> a{{1, 10}, {2, 20}};
+  mystl::filtered_unordered_map<int, int> b(1000, 0.05);
+  for (int i = 0; i < 500; ++i) {
+    b.emplace(i * 3, i);
+  }
+  swap(a, b);
+  EXPECT_EQ(a.size(), 500u);
+  EXPECT_EQ(b.at(2), 20);
+  EXPECT_EQ(a.at(300), 100);
+  EXPECT_DOUBLE_EQ(a.false_positive_rate(), 0.05);
+
+  mystl::filtered_unordered_map<int, int> c(std::move(a));
+  EXPECT_EQ(c.at(3), 1);
+  c.clear();
+  EXPECT_TRUE(c.empty());
+  c.reset_stats();
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_FALSE(c.contains(i * 3));
+  }
+  EXPECT_EQ(c.stats().false_positives, 0u);
+  c[7] = 70;
+  EXPECT_EQ(c.at(7), 70);
+
+  c.reserve(100000);
+  EXPECT_GE(c.stats().filter_capacity, 100000u);
+  EXPECT_EQ(c.at(7), 70);
+}
+
+// 与其他容器一样元素个数在前；只传浮点数（误判率）不能通过编译
+TEST(FilteredUnorderedMapTest, SizeFirstConstructor) {
+  using map_type = mystl::filtered_unordered_map<int, int>;
+  static_assert(std::is_constructible_v<map_type, int>);
+  static_assert(!std::is_constructible_v<map_type, double>);
+  map_type map(1000);
+  EXPECT_DOUBLE_EQ(map.false_positive_rate(),
+                   map_type::default_false_positive_rate);
+  for (int i = 0; i < 1000; ++i) {
+    map.emplace(i, i);
+  }
+  EXPECT_EQ(map.at(999), 999);
+}
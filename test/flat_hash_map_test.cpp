@@ -0,0 +1,378 @@
+#include "gtest/gtest.h"
+#include <mystl/flat_hash_map.h>
+#include <mystl/flat_hash_set.h>
+#include <random>
+#include <string>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+
+// 测试默认构造：空表不分配内存，find/begin 仍然可用
+TEST(FlatHashMapTest, DefaultConstructor) {
+  mystl::flat_hash_map<int, int> map;
+  EXPECT_EQ(map.size(), 0);
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.bucket_count(), 0);
+  EXPECT_EQ(map.find(1), map.end());
+  EXPECT_EQ(map.begin(), map.end());
+}
+
+// 测试插入与查找
+TEST(FlatHashMapTest, InsertAndFind) {
+  mystl::flat_hash_map<int, std::string> map;
+  auto [it1, inserted1] = map.insert({1, "one"});
+  EXPECT_TRUE(inserted1);
+  EXPECT_EQ(it1->second, "one");
+
+  auto [it2, inserted2] = map.insert({1, "another"});
+  EXPECT_FALSE(inserted2);
+  EXPECT_EQ(it2->second, "one");
+
+  map.emplace(2, "two");
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(map.find(2)->second, "two");
+  EXPECT_EQ(map.find(3), map.end());
+  EXPECT_TRUE(map.contains(1));
+  EXPECT_EQ(map.count(3), 0);
+}
+
+// 测试 operator[] 与 at
+TEST(FlatHashMapTest, OperatorBracketAndAt) {
+  mystl::flat_hash_map<std::string, int> map;
+  map["a"] = 1;
+  map["b"] = 2;
+  ++map["a"];
+  EXPECT_EQ(map.at("a"), 2);
+  EXPECT_EQ(map.at("b"), 2);
+  EXPECT_THROW(map.at("c"), std::out_of_range);
+  EXPECT_EQ(map.size(), 2);
+}
+
+// 测试扩容后所有元素仍可找到，且负载因子不超过 7/8
+TEST(FlatHashMapTest, GrowthKeepsElements) {
+  mystl::flat_hash_map<int, int> map;
+  for (int i = 0; i < 10000; ++i) {
+    map[i] = i * 2;
+  }
+  EXPECT_EQ(map.size(), 10000);
+  EXPECT_LE(map.load_factor(), map.max_load_factor());
+  for (int i = 0; i < 10000; ++i) {
+    auto it = map.find(i);
+    ASSERT_NE(it, map.end());
+    EXPECT_EQ(it->second, i * 2);
+  }
+
+  size_t n = 0;
+  for (const auto& kv : map) {
+    EXPECT_EQ(kv.second, kv.first * 2);
+    ++n;
+  }
+  EXPECT_EQ(n, map.size());
+}
+
+// 测试删除：墓碑不影响后续查找，且可被复用
+TEST(FlatHashMapTest, EraseAndReinsert) {
+  mystl::flat_hash_map<int, int> map;
+  for (int i = 0; i < 1000; ++i) {
+    map[i] = i;
+  }
+  for (int i = 0; i < 1000; i += 2) {
+    EXPECT_EQ(map.erase(i), 1);
+  }
+  EXPECT_EQ(map.erase(0), 0);
+  EXPECT_EQ(map.size(), 500);
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(map.contains(i), i % 2 == 1);
+  }
+
+  size_t capacity = map.bucket_count();
+  for (int round = 0; round < 10; ++round) {
+    for (int i = 0; i < 1000; i += 2) {
+      map[i] = i;
+    }
+    for (int i = 0; i < 1000; i += 2) {
+      map.erase(i);
+    }
+  }
+  // 反复插入删除同样数量的元素不应无限扩容
+  EXPECT_EQ(map.bucket_count(), capacity);
+  EXPECT_EQ(map.size(), 500);
+}
+
+// 测试按迭代器删除
+TEST(FlatHashMapTest, EraseByIterator) {
+  mystl::flat_hash_map<int, int> map{{1, 1}, {2, 2}, {3, 3}, {4, 4}};
+  for (auto it = map.begin(); it != map.end();) {
+    if (it->first % 2 == 0) {
+      it = map.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_TRUE(map.contains(1));
+  EXPECT_TRUE(map.contains(3));
+
+  map.erase(map.begin(), map.end());
+  EXPECT_TRUE(map.empty());
+}
+
+// 测试拷贝、移动、交换与比较
+TEST(FlatHashMapTest, CopyMoveSwap) {
+  mystl::flat_hash_map<int, std::string> a{{1, "one"}, {2, "two"}};
+  mystl::flat_hash_map<int, std::string> b(a);
+  EXPECT_EQ(a, b);
+
+  b[3] = "three";
+  EXPECT_NE(a, b);
+
+  mystl::flat_hash_map<int, std::string> c(std::move(b));
+  EXPECT_EQ(c.size(), 3);
+  EXPECT_TRUE(b.empty());
+
+  a.swap(c);
+  EXPECT_EQ(a.size(), 3);
+  EXPECT_EQ(c.size(), 2);
+
+  c = a;
+  EXPECT_EQ(c, a);
+
+  a.clear();
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.find(1), a.end());
+}
+
+// 测试 reserve 之后插入不再扩容
+TEST(FlatHashMapTest, Reserve) {
+  mystl::flat_hash_map<int, int> map;
+  map.reserve(1000);
+  size_t capacity = map.bucket_count();
+  EXPECT_GE(capacity, 1000);
+  for (int i = 0; i < 1000; ++i) {
+    map[i] = i;
+  }
+  EXPECT_EQ(map.bucket_count(), capacity);
+}
+
+// 随机操作与 std::unordered_map 对拍
+TEST(FlatHashMapTest, RandomOperationsMatchStd) {
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> key_dist(0, 2000);
+  std::uniform_int_distribution<int> op_dist(0, 2);
+
+  mystl::flat_hash_map<int, int> map;
+  std::unordered_map<int, int> ref;
+  for (int step = 0; step < 50000; ++step) {
+    int k = key_dist(rng);
+    switch (op_dist(rng)) {
+      case 0:
+        map[k] = step;
+        ref[k] = step;
+        break;
+      case 1:
+        EXPECT_EQ(map.erase(k), ref.erase(k));
+        break;
+      default: {
+        auto it = map.find(k);
+        auto rit = ref.find(k);
+        ASSERT_EQ(it == map.end(), rit == ref.end());
+        if (rit != ref.end()) {
+          EXPECT_EQ(it->second, rit->second);
+        }
+      }
+    }
+  }
+  EXPECT_EQ(map.size(), ref.size());
+}
+
+// 异构查找：底层 flat_hash_table 与 hash_table 一样支持 is_transparent 约定
+struct FlatRecord {
+  int key;
+  std::string value;
+};
+
+struct FlatRecordHash {
+  using is_transparent = void;
+  size_t operator()(int k) const { return std::hash<int>()(k); }
+  size_t operator()(const FlatRecord& r) const {
+    return std::hash<int>()(r.key);
+  }
+};
+
+struct FlatRecordEqual {
+  using is_transparent = void;
+  bool operator()(const FlatRecord& lhs, int rhs) const {
+    return lhs.key == rhs;
+  }
+  bool operator()(const FlatRecord& lhs, const FlatRecord& rhs) const {
+    return lhs.key == rhs.key;
+  }
+};
+
+TEST(FlatHashTableTest, TransparentLookup) {
+  mystl::flat_hash_table<FlatRecord, FlatRecordHash, FlatRecordEqual,
+                         std::allocator<FlatRecord>>
+      table{FlatRecordHash(), FlatRecordEqual()};
+  table.insert_unique({1, "apple"});
+  table.insert_unique({10, "orange"});
+  EXPECT_FALSE(table.insert_unique({1, "cherry"}).second);
+
+  auto it = table.find(10);
+  ASSERT_NE(it, table.end());
+  EXPECT_EQ(it->value, "orange");
+  EXPECT_EQ(table.erase_unique(1), 1);
+  EXPECT_EQ(table.find(1), table.end());
+}
+
+// flat_hash_map / flat_hash_set 的公有接口同样支持透明哈希
+struct FlatStringHash {
+  using is_transparent = void;
+  size_t operator()(std::string_view s) const {
+    return std::hash<std::string_view>()(s);
+  }
+};
+
+struct FlatStringEqual {
+  using is_transparent = void;
+  bool operator()(std::string_view lhs, std::string_view rhs) const {
+    return lhs == rhs;
+  }
+};
+
+TEST(FlatHashMapTest, TransparentLookup) {
+  mystl::flat_hash_map<std::string, int, FlatStringHash, FlatStringEqual> map{
+      {"one", 1}, {"two", 2}};
+  std::string_view two = "two";
+  ASSERT_NE(map.find(two), map.end());
+  EXPECT_EQ(map.at(two), 2);
+  EXPECT_EQ(map.count("one"), 1);
+  EXPECT_FALSE(map.contains(std::string_view("three")));
+  EXPECT_EQ(map.erase(two), 1);
+  EXPECT_EQ(map.size(), 1);
+
+  mystl::flat_hash_set<std::string, FlatStringHash, FlatStringEqual> set{
+      "a", "b"};
+  EXPECT_TRUE(set.contains(std::string_view("a")));
+  EXPECT_EQ(set.erase(std::string_view("b")), 1);
+  EXPECT_EQ(set.find(std::string_view("b")), set.end());
+}
+
+#if TINYSTL_FLAT_HASH_HAVE_SSE2
+// SSE2 与标量实现在随机控制字节上的匹配结果必须一致
+TEST(FlatHashTableTest, GroupImplementationsAgree) {
+  std::mt19937 rng(7);
+  const mystl::flat_ctrl_t specials[] = {mystl::flat_ctrl_empty,
+                                         mystl::flat_ctrl_deleted,
+                                         mystl::flat_ctrl_sentinel};
+  for (int round = 0; round < 1000; ++round) {
+    mystl::flat_ctrl_t ctrl[16];
+    for (auto& c : ctrl) {
+      int r = static_cast<int>(rng() % 160);
+      c = r < 128 ? static_cast<mystl::flat_ctrl_t>(r) : specials[r % 3];
+    }
+    mystl::flat_group_portable portable(ctrl);
+    mystl::flat_group_sse2 sse2(ctrl);
+    mystl::flat_ctrl_t h2 = static_cast<mystl::flat_ctrl_t>(rng() % 128);
+    EXPECT_EQ(portable.match(h2).mask(), sse2.match(h2).mask());
+    EXPECT_EQ(portable.match_empty().mask(), sse2.match_empty().mask());
+    EXPECT_EQ(portable.match_empty_or_deleted().mask(),
+              sse2.match_empty_or_deleted().mask());
+    EXPECT_EQ(portable.count_leading_empty_or_deleted(),
+              sse2.count_leading_empty_or_deleted());
+  }
+}
+#endif
+
+// flat_hash_set 基本操作
+TEST(FlatHashSetTest, Basic) {
+  mystl::flat_hash_set<std::string> set{"a", "b", "c"};
+  EXPECT_EQ(set.size(), 3);
+  EXPECT_FALSE(set.insert("a").second);
+  EXPECT_TRUE(set.insert("d").second);
+  EXPECT_TRUE(set.contains("d"));
+  EXPECT_EQ(set.erase("b"), 1);
+  EXPECT_FALSE(set.contains("b"));
+
+  size_t n = 0;
+  for (const auto& key : set) {
+    EXPECT_TRUE(set.contains(key));
+    ++n;
+  }
+  EXPECT_EQ(n, 3);
+
+  mystl::flat_hash_set<std::string> copy(set);
+  EXPECT_EQ(copy, set);
+}
+
+// 扩容时第 resize_throw_after 次调用哈希函数抛出，用于检验 resize 的异常安全
+static int resize_throw_after = -1;
+
+struct ResizeThrowingHash {
+  size_t operator()(int k) const {
+    if (resize_throw_after >= 0 && resize_throw_after-- == 0) {
+      throw std::runtime_error("hash");
+    }
+    return std::hash<int>()(k);
+  }
+};
+
+// 移动构造可能抛出的值类型：扩容时只能拷贝
+struct ThrowingMove {
+  int v = 0;
+  ThrowingMove(int x) : v(x) {}
+  ThrowingMove(const ThrowingMove&) = default;
+  ThrowingMove(ThrowingMove&& other) noexcept(false) : v(other.v) {}
+  ThrowingMove& operator=(const ThrowingMove&) = default;
+};
+
+// 插入直到某次插入触发扩容且扩容中途哈希函数抛出，返回抛出前的槽位数
+template <class Map, class Make>
+static size_t InsertUntilResizeThrows(Map& map, Make make) {
+  for (int i = static_cast<int>(map.size());; ++i) {
+    size_t bc = map.bucket_count();
+    resize_throw_after = 1;  // 第一次调用给新键，第二次在扩容中
+    try {
+      map.emplace(i, make(i));
+    } catch (const std::runtime_error&) {
+      resize_throw_after = -1;
+      return bc;
+    }
+    resize_throw_after = -1;
+  }
+}
+
+// 移动可能抛出：扩容失败时原表不变
+TEST(FlatHashMapTest, ResizeFailureKeepsTableWithThrowingMove) {
+  mystl::flat_hash_map<int, ThrowingMove, ResizeThrowingHash> map;
+  for (int i = 0; i < 20; ++i) {
+    map.emplace(i, i);
+  }
+  size_t bc =
+      InsertUntilResizeThrows(map, [](int i) { return ThrowingMove(i); });
+  size_t n = map.size();
+  EXPECT_GT(n, 20);
+  EXPECT_EQ(map.bucket_count(), bc);
+  for (int i = 0; i < static_cast<int>(n); ++i) {
+    auto it = map.find(i);
+    ASSERT_NE(it, map.end());
+    EXPECT_EQ(it->second.v, i);
+  }
+  size_t count = 0;
+  for (auto it = map.begin(); it != map.end(); ++it) {
+    ++count;
+  }
+  EXPECT_EQ(count, n);
+}
+
+// 移动不抛出：元素已被移走后哈希函数抛出，表被清空但保持可用
+TEST(FlatHashMapTest, ResizeFailureClearsTableWithNothrowMove) {
+  mystl::flat_hash_map<int, std::string, ResizeThrowingHash> map;
+  for (int i = 0; i < 20; ++i) {
+    map.emplace(i, std::to_string(i));
+  }
+  InsertUntilResizeThrows(map, [](int i) { return std::to_string(i); });
+  EXPECT_EQ(map.size(), 0);
+  EXPECT_EQ(map.begin(), map.end());
+  map.emplace(1, "one");
+  EXPECT_EQ(map.find(1)->second, "one");
+}
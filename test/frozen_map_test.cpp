@@ -0,0 +1,180 @@
+#include "gtest/gtest.h"
+#include <mystl/frozen_map.h>
+#include <mystl/unordered_map.h>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// 所有键哈希值相同：无法构造完美哈希
+struct ConstantHash {
+  size_t operator()(int) const { return 42; }
+};
+
+enum class Color { red, green, blue, black };
+
+// 编译期构造，查找结果可以用于 static_assert
+constexpr auto kColorNames = mystl::make_frozen_map<std::string_view, Color>(
+    {{"red", Color::red},
+     {"green", Color::green},
+     {"blue", Color::blue},
+     {"black", Color::black}});
+
+constexpr auto kHttpStatus = mystl::make_frozen_map<int, std::string_view>(
+    {{200, "OK"},
+     {201, "Created"},
+     {204, "No Content"},
+     {301, "Moved Permanently"},
+     {304, "Not Modified"},
+     {400, "Bad Request"},
+     {401, "Unauthorized"},
+     {403, "Forbidden"},
+     {404, "Not Found"},
+     {500, "Internal Server Error"},
+     {502, "Bad Gateway"},
+     {503, "Service Unavailable"}});
+
+static_assert(kColorNames.size() == 4);
+static_assert(kColorNames.at("green") == Color::green);
+static_assert(!kColorNames.contains("purple"));
+static_assert(kHttpStatus.at(404) == "Not Found");
+static_assert(kHttpStatus.find(418) == kHttpStatus.end());
+
+}  // namespace
+
+// 从 unordered_map 构造：所有键都能一次找到，数组恰好 n 个元素
+TEST(FrozenMapTest, FromUnorderedMap) {
+  mystl::unordered_map<uint64_t, uint64_t> source;
+  std::mt19937_64 rng(1);
+  while (source.size() < 100000) {
+    uint64_t k = rng();
+    source[k] = k / 3;
+  }
+  mystl::frozen_map<uint64_t, uint64_t> map(source);
+  EXPECT_EQ(map.size(), source.size());
+  EXPECT_EQ(static_cast<size_t>(map.end() - map.begin()), source.size());
+  for (const auto& kv : source) {
+    auto it = map.find(kv.first);
+    ASSERT_NE(it, map.end());
+    EXPECT_EQ(it->first, kv.first);
+    EXPECT_EQ(it->second, kv.second);
+  }
+  // 遍历恰好覆盖每个键一次
+  size_t visited = 0;
+  for (const auto& kv : map) {
+    EXPECT_EQ(source.at(kv.first), kv.second);
+    ++visited;
+  }
+  EXPECT_EQ(visited, source.size());
+  for (int i = 0; i < 10000; ++i) {
+    uint64_t k = rng();
+    EXPECT_EQ(map.contains(k), source.contains(k));
+  }
+}
+
+// 小规模：0 到若干个元素
+TEST(FrozenMapTest, SmallSizes) {
+  mystl::frozen_map<int, int> empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(empty.find(0), empty.end());
+  EXPECT_EQ(empty.count(1), 0u);
+  EXPECT_THROW(empty.at(1), std::out_of_range);
+
+  for (int n = 1; n <= 64; ++n) {
+    std::vector<std::pair<int, int>> items;
+    for (int i = 0; i < n; ++i) {
+      items.emplace_back(i * 3, -i);
+    }
+    mystl::frozen_map<int, int> map(items.begin(), items.end());
+    ASSERT_EQ(map.size(), static_cast<size_t>(n));
+    for (int i = 0; i < n; ++i) {
+      EXPECT_EQ(map.at(i * 3), -i);
+      EXPECT_FALSE(map.contains(i * 3 + 1));
+    }
+  }
+}
+
+// 重复的键保留第一次出现的值
+TEST(FrozenMapTest, DuplicateKeysKeepFirst) {
+  mystl::frozen_map<std::string, int> map{
+      {"a", 1}, {"b", 2}, {"a", 3}, {"c", 4}, {"b", 5}};
+  EXPECT_EQ(map.size(), 3u);
+  EXPECT_EQ(map.at("a"), 1);
+  EXPECT_EQ(map.at("b"), 2);
+  EXPECT_EQ(map.at("c"), 4);
+  EXPECT_FALSE(map.contains("d"));
+}
+
+// 字符串键
+TEST(FrozenMapTest, StringKeys) {
+  mystl::unordered_map<std::string, size_t> source;
+  for (size_t i = 0; i < 5000; ++i) {
+    source.emplace("config.section" + std::to_string(i % 37) + ".key" +
+                       std::to_string(i),
+                   i);
+  }
+  mystl::frozen_map<std::string, size_t> map(source);
+  for (const auto& kv : source) {
+    EXPECT_EQ(map.at(kv.first), kv.second);
+  }
+  EXPECT_FALSE(map.contains("config.section0.key1"));
+}
+
+// 不同的键哈希值完全相同时拒绝构造
+TEST(FrozenMapTest, IdenticalHashesThrow) {
+  std::vector<std::pair<int, int>> items{{1, 1}, {2, 2}};
+  using map_type = mystl::frozen_map<int, int, ConstantHash>;
+  EXPECT_THROW(map_type(items.begin(), items.end()), std::invalid_argument);
+  // 相同的键不算冲突
+  std::vector<std::pair<int, int>> same{{1, 1}, {1, 2}};
+  map_type map(same.begin(), same.end());
+  EXPECT_EQ(map.size(), 1u);
+  EXPECT_EQ(map.at(1), 1);
+}
+
+// 拷贝、移动与交换
+TEST(FrozenMapTest, CopyMoveSwap) {
+  mystl::frozen_map<int, std::string> a{{1, "one"}, {2, "two"}};
+  mystl::frozen_map<int, std::string> b(a);
+  EXPECT_EQ(b.at(2), "two");
+
+  mystl::frozen_map<int, std::string> c{{3, "three"}};
+  c = a;
+  EXPECT_EQ(c.size(), 2u);
+  EXPECT_EQ(c.at(1), "one");
+  EXPECT_FALSE(c.contains(3));
+
+  mystl::frozen_map<int, std::string> d(std::move(b));
+  EXPECT_EQ(d.at(1), "one");
+  EXPECT_TRUE(b.empty());
+  EXPECT_FALSE(b.contains(1));
+
+  mystl::frozen_map<int, std::string> e{{7, "seven"}};
+  swap(d, e);
+  EXPECT_EQ(d.at(7), "seven");
+  EXPECT_EQ(e.at(2), "two");
+}
+
+// 编译期构造的映射在运行期同样可用
+TEST(StaticFrozenMapTest, RuntimeLookup) {
+  EXPECT_EQ(kColorNames.at(std::string("blue")), Color::blue);
+  EXPECT_EQ(kColorNames.find("white"), kColorNames.end());
+  EXPECT_THROW(kColorNames.at("white"), std::out_of_range);
+
+  size_t visited = 0;
+  for (const auto& kv : kHttpStatus) {
+    EXPECT_EQ(kHttpStatus.at(kv.first), kv.second);
+    ++visited;
+  }
+  EXPECT_EQ(visited, kHttpStatus.size());
+  for (int code = 0; code < 1000; ++code) {
+    bool known = code == 200 || code == 201 || code == 204 || code == 301 ||
+                 code == 304 || code == 400 || code == 401 || code == 403 ||
+                 code == 404 || code == 500 || code == 502 || code == 503;
+    EXPECT_EQ(kHttpStatus.contains(code), known) << code;
+  }
+}
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include <mystl/functional.h>
+#include <mystl/string.h>
+#include <mystl/unordered_map.h>
+#include <algorithm>
+#include <cstdint>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+enum class Flag : uint8_t { a = 1, b = 2 };
+
+// 桶数为 2 的幂时只取低位，统计最大的桶
+template <class Hash, class Key>
+size_t MaxBucketLoad(const std::vector<Key>& keys, size_t bucket_count) {
+  std::vector<size_t> load(bucket_count);
+  Hash hash;
+  size_t max_load = 0;
+  for (const Key& k : keys) {
+    max_load = std::max(max_load, ++load[hash(k) & (bucket_count - 1)]);
+  }
+  return max_load;
+}
+
+}  // namespace
+
+// 整数：等步长的键在 2 的幂桶数下仍然均匀
+TEST(HashTest, IntegersSpreadOverPowerOfTwoBuckets) {
+  std::vector<uint64_t> keys;
+  for (uint64_t i = 0; i < 4096; ++i) {
+    keys.push_back(i * 4096);
+  }
+  // 恒等哈希会把它们全部放进桶 0；这里平均每桶 4 个，最大桶远小于总数
+  EXPECT_LE((MaxBucketLoad<mystl::hash<uint64_t>>(keys, 1024)), 20u);
+}
+
+// 各种整数类型与枚举都可用，结果确定
+TEST(HashTest, IntegralAndEnum) {
+  mystl::hash<int> h;
+  EXPECT_EQ(h(42), h(42));
+  EXPECT_NE(h(1), h(2));
+  EXPECT_NE(mystl::hash<Flag>()(Flag::a), mystl::hash<Flag>()(Flag::b));
+  std::set<size_t> seen;
+  for (int i = 0; i < 10000; ++i) {
+    seen.insert(h(i));
+  }
+  EXPECT_EQ(seen.size(), 10000u);
+}
+
+// 指针：按 64 字节对齐的地址也能分散到低位
+TEST(HashTest, Pointers) {
+  std::vector<const char*> ptrs;
+  static char buffer[64 * 1024];
+  for (size_t i = 0; i < sizeof(buffer); i += 64) {
+    ptrs.push_back(buffer + i);
+  }
+  EXPECT_LE((MaxBucketLoad<mystl::hash<const char*>>(ptrs, 256)), 16u);
+}
+
+// 字符串：string 与 string_view 内容相同则哈希值相同
+TEST(HashTest, StringsAndViews) {
+  mystl::hash<std::string> hs;
+  mystl::hash<std::string_view> hv;
+  std::string s = "the quick brown fox jumps over the lazy dog";
+  EXPECT_EQ(hs(s), hv(std::string_view(s)));
+  EXPECT_EQ(hs(s), mystl::hash_bytes(s.data(), s.size()));
+  EXPECT_NE(hs(s), hs(s + "."));
+  EXPECT_NE(hs(""), hs(std::string(1, '\0')));
+  EXPECT_NE(mystl::hash_bytes(s.data(), s.size(), 1),
+            mystl::hash_bytes(s.data(), s.size(), 2));
+}
+
+// mystl::string 与内容相同的 std::string 哈希值相同
+TEST(HashTest, MystlString) {
+  mystl::hash<mystl::string> h;
+  mystl::string s("the quick brown fox");
+  EXPECT_EQ(h(s), mystl::hash<std::string>()("the quick brown fox"));
+  EXPECT_NE(h(s), h(mystl::string("the quick brown fox.")));
+}
+
+// string 哈希声明 is_transparent：配合 std::equal_to<> 用 string_view 查找
+TEST(HashTest, TransparentStringLookup) {
+  mystl::unordered_map<std::string, int, mystl::hash<std::string>,
+                       std::equal_to<>>
+      map;
+  map.emplace("alpha", 1);
+  map.emplace("beta", 2);
+  EXPECT_EQ(map.find(std::string_view("beta"))->second, 2);
+  EXPECT_TRUE(map.contains(std::string_view("alpha")));
+  EXPECT_EQ(map.count(std::string_view("gamma")), 0u);
+}
+
+// 覆盖各个长度分支：0..200 字节，逐个翻转每个字节都会改变哈希值
+TEST(HashTest, BytesAllLengths) {
+  std::vector<unsigned char> data(200);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<unsigned char>(i * 131 + 7);
+  }
+  std::set<uint64_t> seen;
+  for (size_t len = 0; len <= data.size(); ++len) {
+    uint64_t base = mystl::hash_bytes(data.data(), len);
+    EXPECT_TRUE(seen.insert(base).second) << len;
+    for (size_t i = 0; i < len; ++i) {
+      data[i] ^= 1;
+      EXPECT_NE(mystl::hash_bytes(data.data(), len), base) << len << " " << i;
+      data[i] ^= 1;
+    }
+  }
+}
+
+// 其他类型退回 std::hash
+TEST(HashTest, FallsBackToStdHash) {
+  EXPECT_EQ(mystl::hash<double>()(1.5), std::hash<double>()(1.5));
+}
+
+// 作为 unordered_map 的哈希函数：rehash 到 2 的幂后链长仍然很短
+TEST(HashTest, UnorderedMapWithPowerOfTwoBuckets) {
+  mystl::unordered_map<uint64_t, int, mystl::hash<uint64_t>> map;
+  map.rehash(1 << 14);
+  ASSERT_EQ(map.bucket_count(), 1u << 14);
+  for (uint64_t i = 0; i < 8192; ++i) {
+    map.emplace(i << 16, static_cast<int>(i));
+  }
+  size_t max_bucket = 0;
+  for (size_t b = 0; b < map.bucket_count(); ++b) {
+    max_bucket = std::max(max_bucket, map.bucket_size(b));
+  }
+  EXPECT_LE(max_bucket, 10u);
+  EXPECT_EQ(map.at(uint64_t(100) << 16), 100);
+}
@@ -0,0 +1,75 @@
+#include "gtest/gtest.h"
+// mystl/vector.h 引入无约束的 mystl::swap：先包含它，检查各容器的
+// swap、移动与拷贝赋值不会因 ADL 同时找到 std::swap 而产生歧义
+#include <mystl/vector.h>
+#include <mystl/flat_hash_map.h>
+#include <mystl/frozen_map.h>
+#include <mystl/functional.h>
+#include <mystl/lru_cache.h>
+#include <mystl/mapped_hash_map.h>
+#include <mystl/unordered_map.h>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <utility>
+
+// lru_cache：移动赋值经由 swap
+TEST(IncludeOrderTest, LruCache) {
+  mystl::lru_cache<int, std::string> a(4);
+  mystl::lru_cache<int, std::string> b(2);
+  a.put(1, "one");
+  b.put(2, "two");
+  a.swap(b);
+  EXPECT_EQ(a.capacity(), 2u);
+  EXPECT_EQ(*a.get(2), "two");
+  b = std::move(a);
+  EXPECT_EQ(*b.get(2), "two");
+}
+
+// flat_hash_map：拷贝赋值经由拷贝后 swap
+TEST(IncludeOrderTest, FlatHashMap) {
+  mystl::flat_hash_map<int, std::string> a{{1, "one"}, {2, "two"}};
+  mystl::flat_hash_map<int, std::string> b;
+  b = a;
+  EXPECT_EQ(b.at(2), "two");
+  mystl::flat_hash_map<int, std::string> c{{3, "three"}};
+  c.swap(a);
+  EXPECT_EQ(a.size(), 1u);
+  EXPECT_EQ(c.size(), 2u);
+}
+
+// mapped_hash_map：移动构造与移动赋值都经由 swap
+TEST(IncludeOrderTest, MappedHashMap) {
+  std::string path = ::testing::TempDir() + "tinystl_include_order.snap";
+  mystl::unordered_map<uint64_t, uint64_t> map{{1, 10}, {2, 20}};
+  mystl::write_hash_snapshot(map, path);
+  mystl::mapped_hash_map<uint64_t, uint64_t> a(path);
+  mystl::mapped_hash_map<uint64_t, uint64_t> b(std::move(a));
+  EXPECT_FALSE(a.is_open());
+  EXPECT_EQ(*b.find(2), 20u);
+  a = std::move(b);
+  EXPECT_EQ(*a.find(1), 10u);
+  std::remove(path.c_str());
+}
+
+// frozen_map：以 mystl::hash 为哈希函数时拷贝赋值与移动赋值经由 swap
+TEST(IncludeOrderTest, FrozenMapWithMystlHash) {
+  using map_type = mystl::frozen_map<int, int, mystl::hash<int>>;
+  map_type a{{1, 10}, {2, 20}, {3, 30}};
+  map_type b;
+  b = a;
+  EXPECT_EQ(b.at(3), 30);
+  map_type c;
+  c = std::move(b);
+  EXPECT_EQ(c.at(1), 10);
+}
+
+// unordered_map 的节点句柄：swap 经由成员 swap
+TEST(IncludeOrderTest, NodeHandle) {
+  mystl::unordered_map<int, std::string> map{{1, "one"}, {2, "two"}};
+  auto a = map.extract(1);
+  auto b = map.extract(2);
+  swap(a, b);
+  EXPECT_EQ(a.key(), 2);
+  EXPECT_EQ(b.mapped(), "one");
+}
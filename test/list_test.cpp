@@ -92,4 +92,20 @@ TEST(ListTest, Iterator) {
     ++it;
     ++it;
     EXPECT_EQ(it, l.end());
-}
\ No newline at end of file
+}
+// 测试内存占用统计：每个节点的 prev/next 计入 overhead
+TEST(ListTest, MemoryUsage) {
+  mystl::list<int> l;
+  EXPECT_EQ(mystl::footprint(l).total_bytes(), 0);
+
+  for (int i = 0; i < 10; ++i) {
+    l.push_back(i);
+  }
+  mystl::memory_footprint f = l.memory_usage();
+  EXPECT_EQ(f.payload_bytes, 10 * sizeof(int));
+  EXPECT_EQ(f.slack_bytes, 0);
+  EXPECT_GE(f.overhead_bytes, 10 * 2 * sizeof(void*));
+  EXPECT_EQ(f.allocations, 10);
+  EXPECT_EQ(f.payload_bytes + f.overhead_bytes,
+            10 * sizeof(mystl::list_node<int>));
+}
@@ -0,0 +1,239 @@
+#include "gtest/gtest.h"
+#include <mystl/lru_cache.h>
+#include <list>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// 按最近使用顺序列出所有键
+template <class Cache>
+std::vector<typename Cache::key_type> Keys(const Cache& cache) {
+  std::vector<typename Cache::key_type> keys;
+  cache.for_each([&](const auto& k, const auto&) { keys.push_back(k); });
+  return keys;
+}
+
+}  // namespace
+
+// get 更新最近使用顺序，put 超出容量时淘汰最久未使用的键
+TEST(LruCacheTest, EvictsLeastRecentlyUsed) {
+  mystl::lru_cache<int, std::string> cache(3);
+  std::vector<std::pair<int, std::string>> evicted;
+  cache.set_eviction_callback([&](const int& k, std::string& v) {
+    evicted.emplace_back(k, v);
+  });
+  EXPECT_TRUE(cache.put(1, "one"));
+  EXPECT_TRUE(cache.put(2, "two"));
+  EXPECT_TRUE(cache.put(3, "three"));
+  EXPECT_EQ(Keys(cache), (std::vector<int>{3, 2, 1}));
+
+  ASSERT_NE(cache.get(1), nullptr);
+  EXPECT_EQ(*cache.get(1), "one");
+  EXPECT_EQ(Keys(cache), (std::vector<int>{1, 3, 2}));
+
+  cache.put(4, "four");
+  EXPECT_EQ(cache.size(), 3u);
+  EXPECT_FALSE(cache.contains(2));
+  ASSERT_EQ(evicted.size(), 1u);
+  EXPECT_EQ(evicted[0].first, 2);
+  EXPECT_EQ(evicted[0].second, "two");
+
+  // 覆盖已有的键不淘汰，只移到表头
+  cache.put(3, "THREE");
+  EXPECT_EQ(Keys(cache), (std::vector<int>{3, 4, 1}));
+  EXPECT_EQ(*cache.peek(3), "THREE");
+  EXPECT_EQ(evicted.size(), 1u);
+
+  // peek 不改变顺序
+  cache.peek(1);
+  EXPECT_EQ(Keys(cache), (std::vector<int>{3, 4, 1}));
+
+  EXPECT_EQ(cache.get(2), nullptr);
+  mystl::cache_stats s = cache.stats();
+  EXPECT_EQ(s.hits, 2u);
+  EXPECT_EQ(s.misses, 1u);
+  EXPECT_EQ(s.evictions, 1u);
+}
+
+// erase、clear、缩小容量
+TEST(LruCacheTest, EraseClearAndShrink) {
+  mystl::lru_cache<std::string, int> cache(4);
+  for (int i = 0; i < 4; ++i) {
+    cache.put(std::to_string(i), i);
+  }
+  EXPECT_TRUE(cache.erase("2"));
+  EXPECT_FALSE(cache.erase("2"));
+  EXPECT_EQ(Keys(cache), (std::vector<std::string>{"3", "1", "0"}));
+
+  int evictions = 0;
+  cache.set_eviction_callback([&](const std::string&, int&) { ++evictions; });
+  cache.set_capacity(1);
+  EXPECT_EQ(evictions, 2);
+  EXPECT_EQ(Keys(cache), (std::vector<std::string>{"3"}));
+
+  cache.clear();
+  EXPECT_TRUE(cache.empty());
+  EXPECT_EQ(evictions, 2);
+  cache.put("x", 1);
+  cache.put("y", 2);
+  EXPECT_EQ(Keys(cache), (std::vector<std::string>{"y"}));
+
+  mystl::lru_cache<int, int> zero(0);
+  EXPECT_FALSE(zero.put(1, 1));
+  EXPECT_TRUE(zero.empty());
+}
+
+// 随机操作与 unordered_map + std::list 实现的 LRU 对拍
+TEST(LruCacheTest, MatchesReferenceLru) {
+  const size_t capacity = 100;
+  mystl::lru_cache<int, int> cache(capacity);
+  std::list<std::pair<int, int>> order;
+  std::unordered_map<int, std::list<std::pair<int, int>>::iterator> index;
+  std::mt19937 rng(21);
+  for (int step = 0; step < 100000; ++step) {
+    int k = static_cast<int>(rng() % 300);
+    if (rng() % 3 == 0) {
+      cache.put(k, step);
+      auto it = index.find(k);
+      if (it != index.end()) {
+        order.erase(it->second);
+      }
+      order.emplace_front(k, step);
+      index[k] = order.begin();
+      if (order.size() > capacity) {
+        index.erase(order.back().first);
+        order.pop_back();
+      }
+    } else {
+      int* v = cache.get(k);
+      auto it = index.find(k);
+      ASSERT_EQ(v != nullptr, it != index.end());
+      if (v != nullptr) {
+        EXPECT_EQ(*v, it->second->second);
+        order.splice(order.begin(), order, it->second);
+      }
+    }
+  }
+  std::vector<int> expected;
+  for (const auto& kv : order) {
+    expected.push_back(kv.first);
+  }
+  EXPECT_EQ(Keys(cache), expected);
+}
+
+// 移动与交换后链表仍然完整
+TEST(LruCacheTest, MoveAndSwap) {
+  mystl::lru_cache<int, int> a(3);
+  a.put(1, 1);
+  a.put(2, 2);
+  mystl::lru_cache<int, int> b(std::move(a));
+  EXPECT_EQ(Keys(b), (std::vector<int>{2, 1}));
+  EXPECT_TRUE(a.empty());
+  a.put(9, 9);
+  EXPECT_EQ(Keys(a), (std::vector<int>{9}));
+
+  swap(a, b);
+  EXPECT_EQ(Keys(a), (std::vector<int>{2, 1}));
+  EXPECT_EQ(Keys(b), (std::vector<int>{9}));
+  a.put(3, 3);
+  a.put(4, 4);
+  EXPECT_EQ(Keys(a), (std::vector<int>{4, 3, 2}));
+
+  mystl::lru_cache<int, int> empty(5);
+  b = std::move(empty);
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(b.capacity(), 5u);
+}
+
+// TinyLFU：一次性扫描不会冲掉反复访问的热点键
+TEST(LruCacheTest, TinyLfuResistsScans) {
+  const size_t capacity = 100;
+  mystl::lru_cache<int, int> lru(capacity);
+  mystl::lru_cache<int, int> lfu(capacity, mystl::cache_admission::tiny_lfu);
+  EXPECT_EQ(lfu.admission(), mystl::cache_admission::tiny_lfu);
+  auto access = [](mystl::lru_cache<int, int>& cache, int k) {
+    if (cache.get(k) == nullptr) {
+      cache.put(k, k);
+    }
+  };
+  for (int round = 0; round < 20; ++round) {
+    for (int k = 0; k < 50; ++k) {
+      access(lru, k);
+      access(lfu, k);
+    }
+    // 每轮穿插 200 个只出现一次的键
+    for (int k = 0; k < 200; ++k) {
+      int once = 1000000 + round * 1000 + k;
+      access(lru, once);
+      access(lfu, once);
+    }
+  }
+  lru.reset_stats();
+  lfu.reset_stats();
+  for (int k = 0; k < 50; ++k) {
+    access(lru, k);
+    access(lfu, k);
+  }
+  EXPECT_EQ(lru.stats().hits, 0u);
+  EXPECT_GE(lfu.stats().hits, 45u);
+}
+
+// 分片缓存：多个线程同时读写，容量按分片分配
+TEST(ConcurrentLruCacheTest, ConcurrentAccess) {
+  mystl::concurrent_lru_cache<int, int> cache(1024, 8);
+  EXPECT_EQ(cache.shard_count(), 8u);
+  EXPECT_EQ(cache.capacity(), 1024u);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&cache, t] {
+      std::mt19937 rng(t);
+      for (int i = 0; i < 20000; ++i) {
+        int k = static_cast<int>(rng() % 2000);
+        auto v = cache.get(k);
+        if (v) {
+          EXPECT_EQ(*v, k * 2);
+        } else {
+          cache.put(k, k * 2);
+        }
+      }
+    });
+  }
+  for (std::thread& th : threads) {
+    th.join();
+  }
+  EXPECT_LE(cache.size(), cache.capacity());
+  mystl::cache_stats s = cache.stats();
+  EXPECT_EQ(s.hits + s.misses, 80000u);
+  EXPECT_GT(s.hits, 0u);
+
+  cache.put(5, 10);
+  EXPECT_TRUE(cache.contains(5));
+  EXPECT_TRUE(cache.erase(5));
+  EXPECT_FALSE(cache.get(5).has_value());
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0u);
+}
+
+// 分片缓存：小容量时减少分片数，各分片容量之和等于请求的容量
+TEST(ConcurrentLruCacheTest, SmallCapacityBound) {
+  mystl::concurrent_lru_cache<int, int> tiny(10);
+  EXPECT_EQ(tiny.shard_count(), 1u);
+  EXPECT_EQ(tiny.capacity(), 10u);
+  for (int k = 0; k < 100; ++k) {
+    tiny.put(k, k);
+  }
+  EXPECT_EQ(tiny.size(), 10u);
+
+  mystl::concurrent_lru_cache<int, int> cache(100, 64);
+  EXPECT_EQ(cache.shard_count(), 8u);
+  EXPECT_EQ(cache.capacity(), 100u);
+  for (int k = 0; k < 10000; ++k) {
+    cache.put(k, k);
+  }
+  EXPECT_EQ(cache.size(), 100u);
+}
@@ -0,0 +1,204 @@
+#include "gtest/gtest.h"
+#include <mystl/mapped_hash_map.h>
+#include <mystl/unordered_map.h>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <system_error>
+#include <unistd.h>
+
+namespace {
+
+// 每个测试使用独立的临时文件，析构时删除
+class TempPath {
+ public:
+  explicit TempPath(const char* name)
+      : path_(::testing::TempDir() + "tinystl_" + name + "_" +
+              std::to_string(::getpid()) + ".snap") {}
+  ~TempPath() { std::remove(path_.c_str()); }
+  const std::string& str() const { return path_; }
+
+ private:
+  std::string path_;
+};
+
+struct Point {
+  int32_t x;
+  int32_t y;
+};
+
+// 不同的哈希函数类型：标识不同，打开时应被拒绝
+struct OtherHash {
+  size_t operator()(uint64_t k) const { return static_cast<size_t>(k * 31); }
+};
+
+}  // namespace
+
+TEST(MappedHashMapTest, RoundTrip) {
+  TempPath path("round_trip");
+  mystl::unordered_map<uint64_t, Point> map;
+  for (uint64_t i = 0; i < 10000; ++i) {
+    map[i * 7919] = Point{static_cast<int32_t>(i), -static_cast<int32_t>(i)};
+  }
+  mystl::write_hash_snapshot(map, path.str());
+
+  mystl::mapped_hash_map<uint64_t, Point> view(path.str());
+  EXPECT_TRUE(view.is_open());
+  EXPECT_EQ(view.size(), map.size());
+  EXPECT_GE(view.bucket_count(), 1u);
+  for (const auto& kv : map) {
+    const Point* p = view.find(kv.first);
+    ASSERT_NE(p, nullptr);
+    EXPECT_EQ(p->x, kv.second.x);
+    EXPECT_EQ(p->y, kv.second.y);
+  }
+  EXPECT_EQ(view.find(1), nullptr);
+  EXPECT_FALSE(view.contains(7918));
+  EXPECT_EQ(view.count(7919), 1u);
+  EXPECT_EQ(view.at(7919).x, 1);
+  EXPECT_THROW(view.at(2), std::out_of_range);
+
+  size_t visited = 0;
+  int64_t sum = 0;
+  view.for_each([&](uint64_t k, const Point& p) {
+    ++visited;
+    sum += p.x;
+    EXPECT_EQ(k, static_cast<uint64_t>(p.x) * 7919);
+  });
+  EXPECT_EQ(visited, map.size());
+  EXPECT_EQ(sum, 9999LL * 10000 / 2);
+}
+
+TEST(MappedHashMapTest, EmptyMap) {
+  TempPath path("empty");
+  mystl::unordered_map<int, int> map;
+  mystl::write_hash_snapshot(map, path.str());
+
+  mystl::mapped_hash_map<int, int> view(path.str());
+  EXPECT_TRUE(view.empty());
+  EXPECT_EQ(view.find(0), nullptr);
+  EXPECT_FALSE(view.contains(42));
+}
+
+TEST(MappedHashMapTest, MoveAndDefault) {
+  TempPath path("move");
+  mystl::unordered_map<int, int> map{{1, 10}, {2, 20}};
+  mystl::write_hash_snapshot(map, path.str());
+
+  mystl::mapped_hash_map<int, int> empty;
+  EXPECT_FALSE(empty.is_open());
+  EXPECT_EQ(empty.find(1), nullptr);
+  EXPECT_EQ(empty.bucket_count(), 0u);
+
+  mystl::mapped_hash_map<int, int> a(path.str());
+  mystl::mapped_hash_map<int, int> b(std::move(a));
+  EXPECT_FALSE(a.is_open());
+  EXPECT_EQ(*b.find(2), 20);
+  empty = std::move(b);
+  EXPECT_EQ(*empty.find(1), 10);
+  EXPECT_EQ(b.find(1), nullptr);
+}
+
+TEST(MappedHashMapTest, RejectsMismatchedTypesAndHash) {
+  TempPath path("mismatch");
+  mystl::unordered_map<uint64_t, uint64_t> map{{1, 2}, {3, 4}};
+  mystl::write_hash_snapshot(map, path.str());
+
+  using wrong_value = mystl::mapped_hash_map<uint64_t, uint32_t>;
+  EXPECT_THROW(wrong_value view(path.str()), mystl::hash_snapshot_error);
+  using wrong_hash = mystl::mapped_hash_map<uint64_t, uint64_t, OtherHash>;
+  EXPECT_THROW(wrong_hash view(path.str()), mystl::hash_snapshot_error);
+  // 显式的标识必须与写入时一致
+  using ok = mystl::mapped_hash_map<uint64_t, uint64_t>;
+  EXPECT_THROW(ok view(path.str(), 12345), mystl::hash_snapshot_error);
+  ok view(path.str());
+  EXPECT_EQ(*view.find(3), 4u);
+}
+
+TEST(MappedHashMapTest, RejectsCorruptFiles) {
+  TempPath path("corrupt");
+  using view_type = mystl::mapped_hash_map<int, int>;
+  EXPECT_THROW(view_type view(path.str()), std::system_error);  // 不存在
+
+  {
+    std::ofstream out(path.str(), std::ios::binary);
+    out << "definitely not a snapshot, but long enough to hold a header......"
+           "..............................";
+  }
+  EXPECT_THROW(view_type view(path.str()), mystl::hash_snapshot_error);
+
+  // 截断一个合法文件
+  mystl::unordered_map<int, int> map;
+  for (int i = 0; i < 1000; ++i) {
+    map[i] = i;
+  }
+  mystl::write_hash_snapshot(map, path.str());
+  std::string bytes;
+  {
+    std::ifstream in(path.str(), std::ios::binary);
+    bytes.assign(std::istreambuf_iterator<char>(in),
+                 std::istreambuf_iterator<char>());
+  }
+  {
+    std::ofstream out(path.str(), std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), static_cast<std::streamsize>(bytes.size() - 8));
+  }
+  EXPECT_THROW(view_type view(path.str()), mystl::hash_snapshot_error);
+}
+
+// 中间的桶边界损坏：打开时不检查，查找也不能读出映射范围
+TEST(MappedHashMapTest, CorruptBucketBoundsStayInRange) {
+  TempPath path("corrupt_bucket");
+  mystl::unordered_map<int, int> map;
+  for (int i = 0; i < 1000; ++i) {
+    map[i] = i;
+  }
+  mystl::write_hash_snapshot(map, path.str());
+  std::string bytes;
+  {
+    std::ifstream in(path.str(), std::ios::binary);
+    bytes.assign(std::istreambuf_iterator<char>(in),
+                 std::istreambuf_iterator<char>());
+  }
+  mystl::hash_snapshot_header h;
+  std::memcpy(&h, bytes.data(), sizeof(h));
+  const uint64_t bad = ~uint64_t(0);
+  std::memcpy(&bytes[h.buckets_offset + h.bucket_count / 2 * sizeof(bad)],
+              &bad, sizeof(bad));
+  {
+    std::ofstream out(path.str(), std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+  }
+
+  mystl::mapped_hash_map<int, int> view(path.str());
+  size_t found = 0;
+  for (int i = 0; i < 1000; ++i) {
+    const int* v = view.find(i);
+    if (v != nullptr) {
+      EXPECT_EQ(*v, i);
+      ++found;
+    }
+  }
+  EXPECT_GT(found, 0u);
+  // 不存在的键会走完整个桶，必须停在元素末尾
+  for (int i = 1000; i < 100000; ++i) {
+    EXPECT_EQ(view.find(i), nullptr);
+  }
+}
+
+TEST(MappedHashMapTest, RewriteReplacesFile) {
+  TempPath path("rewrite");
+  mystl::unordered_map<int, int> map{{1, 1}};
+  mystl::write_hash_snapshot(map, path.str());
+  mystl::mapped_hash_map<int, int> old_view(path.str());
+
+  // 改名替换：已打开的视图仍映射旧文件，新打开的视图看到新内容
+  map[1] = 2;
+  mystl::write_hash_snapshot(map, path.str());
+  mystl::mapped_hash_map<int, int> new_view(path.str());
+  EXPECT_EQ(*old_view.find(1), 1);
+  EXPECT_EQ(*new_view.find(1), 2);
+}
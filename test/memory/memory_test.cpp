@@ -112,4 +112,45 @@ TEST(MemoryTest, UninitializedCopyNonTrivial) {
   mystl::destroy(p, p + 3);
   EXPECT_EQ(Counter::destructor_calls, 3);
   alloc.deallocate(p, 3);
-}
\ No newline at end of file
+}
+// 测试分配器取整模型
+TEST(MemoryTest, MallocRounding) {
+  EXPECT_EQ(mystl::malloc_rounding(0), 0);
+  // 小于最小 chunk 的申请按最小 chunk 计
+  EXPECT_EQ(mystl::malloc_rounding(1), 4 * sizeof(size_t) - 1);
+  for (size_t n : {1, 7, 24, 25, 100, 4000, 200000}) {
+    size_t chunk = n + mystl::malloc_rounding(n);
+    EXPECT_GE(chunk, n + sizeof(size_t));
+    EXPECT_EQ(chunk % (2 * sizeof(size_t)), 0);
+  }
+  // 池中的节点只按 8 字节级别取整
+  using pool_rounding =
+      mystl::allocation_rounding<mystl::node_pool_allocator<char[20]>>;
+  EXPECT_EQ(pool_rounding::bytes(1), 4);
+}
+
+// 测试 allocator::reallocate：跨越 malloc 阈值前后都保留原有元素，
+// 非平凡拷贝的类型不启用
+TEST(MemoryTest, AllocatorReallocate) {
+  EXPECT_TRUE(mystl::allocator<int>::can_reallocate());
+  EXPECT_FALSE(mystl::allocator<Counter>::can_reallocate());
+  EXPECT_TRUE(mystl::allocator_can_reallocate<mystl::allocator<int>>::value);
+  EXPECT_FALSE(mystl::allocator_can_reallocate<std::allocator<int>>::value);
+
+  mystl::allocator<int> alloc;
+  int* p = alloc.reallocate(nullptr, 0, 4);
+  for (int i = 0; i < 4; ++i) {
+    p[i] = i;
+  }
+  p = alloc.reallocate(p, 4, 1 << 20);
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(p[i], i);
+  }
+  p[(1 << 20) - 1] = 7;
+  p = alloc.reallocate(p, 1 << 20, 1 << 21);
+  EXPECT_EQ(p[3], 3);
+  EXPECT_EQ(p[(1 << 20) - 1], 7);
+  p = alloc.reallocate(p, 1 << 21, 2);
+  EXPECT_EQ(p[1], 1);
+  EXPECT_EQ(alloc.reallocate(p, 2, 0), nullptr);
+}
@@ -0,0 +1,160 @@
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <mystl/__memory/node_pool_allocator.h>
+#include <mystl/unordered_map.h>
+
+namespace {
+
+template <class K, class V>
+using pool_map =
+    mystl::unordered_map<K, V, std::hash<K>, std::equal_to<K>,
+                         mystl::node_pool_allocator<std::pair<const K, V>>>;
+
+}  // namespace
+
+// 释放的块回到空闲链表，下一次同尺寸申请直接复用
+TEST(NodePoolAllocatorTest, ReusesFreedBlocks) {
+  mystl::node_pool_allocator<std::uint64_t> alloc;
+  std::uint64_t* a = alloc.allocate(1);
+  std::uint64_t* b = alloc.allocate(1);
+  EXPECT_NE(a, b);
+  alloc.deallocate(a, 1);
+  EXPECT_EQ(alloc.allocate(1), a);
+
+  size_t reserved = alloc.pool()->bytes_reserved();
+  EXPECT_GT(reserved, 0);
+  for (int i = 0; i < 100; ++i) {
+    alloc.deallocate(b, 1);
+    b = alloc.allocate(1);
+  }
+  EXPECT_EQ(alloc.pool()->bytes_reserved(), reserved);
+}
+
+// 块地址满足对象对齐要求
+TEST(NodePoolAllocatorTest, Alignment) {
+  struct alignas(16) Aligned {
+    char data[24];
+  };
+  mystl::node_pool_allocator<Aligned> alloc;
+  for (int i = 0; i < 100; ++i) {
+    Aligned* p = alloc.allocate(1);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % alignof(Aligned), 0u);
+  }
+}
+
+// 多个对象与超大对象不走池
+TEST(NodePoolAllocatorTest, ArraysBypassPool) {
+  mystl::node_pool_allocator<int> alloc;
+  int* arr = alloc.allocate(1000);
+  for (int i = 0; i < 1000; ++i) {
+    arr[i] = i;
+  }
+  alloc.deallocate(arr, 1000);
+  EXPECT_EQ(alloc.pool()->bytes_reserved(), 0u);
+
+  struct Big {
+    char data[512];
+  };
+  mystl::node_pool_allocator<Big> big_alloc;
+  Big* p = big_alloc.allocate(1);
+  big_alloc.deallocate(p, 1);
+  EXPECT_EQ(big_alloc.pool()->bytes_reserved(), 0u);
+}
+
+// rebind 后的分配器共享池；默认构造与容器拷贝得到新池
+TEST(NodePoolAllocatorTest, SharingAndEquality) {
+  mystl::node_pool_allocator<int> a;
+  mystl::node_pool_allocator<double> b(a);
+  EXPECT_TRUE(a == b);
+  EXPECT_EQ(a.pool(), b.pool());
+
+  mystl::node_pool_allocator<int> c;
+  EXPECT_TRUE(a != c);
+
+  c = a;
+  EXPECT_TRUE(a == c);
+  EXPECT_TRUE(a != a.select_on_container_copy_construction());
+}
+
+// 作为 unordered_map 的分配器：反复插入删除不再增加内存占用
+TEST(NodePoolAllocatorTest, UnorderedMapChurn) {
+  pool_map<int, std::string> map;
+  for (int i = 0; i < 1000; ++i) {
+    map[i] = std::to_string(i);
+  }
+  size_t reserved = map.get_allocator().pool()->bytes_reserved();
+  EXPECT_GT(reserved, 0u);
+
+  for (int round = 0; round < 20; ++round) {
+    for (int i = 0; i < 1000; i += 2) {
+      EXPECT_EQ(map.erase(i), 1);
+    }
+    for (int i = 0; i < 1000; i += 2) {
+      map.emplace(i, std::to_string(i));
+    }
+  }
+  EXPECT_EQ(map.get_allocator().pool()->bytes_reserved(), reserved);
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(map.at(i), std::to_string(i));
+  }
+}
+
+// 拷贝、移动、交换之后元素仍然可用
+TEST(NodePoolAllocatorTest, UnorderedMapCopyMoveSwap) {
+  pool_map<int, int> a;
+  for (int i = 0; i < 100; ++i) {
+    a[i] = i;
+  }
+  pool_map<int, int> b(a);
+  EXPECT_TRUE(a.get_allocator() != b.get_allocator());
+  EXPECT_EQ(a, b);
+
+  pool_map<int, int> c(std::move(a));
+  EXPECT_EQ(c, b);
+
+  pool_map<int, int> d;
+  d[-1] = -1;
+  d.swap(c);
+  EXPECT_EQ(d, b);
+  EXPECT_EQ(c.size(), 1u);
+
+  c = std::move(d);
+  EXPECT_EQ(c, b);
+  c.erase(0);
+  c[1000] = 1000;
+  EXPECT_EQ(c.size(), 100u);
+
+  b = c;
+  EXPECT_EQ(b, c);
+}
+
+// 两张表的池不同：merge 与 insert(node_type&&) 改为在目标池中分配新节点
+TEST(NodePoolAllocatorTest, UnorderedMapMergeAcrossPools) {
+  pool_map<int, std::string> a;
+  pool_map<int, std::string> b;
+  ASSERT_TRUE(a.get_allocator() != b.get_allocator());
+  for (int i = 0; i < 200; ++i) {
+    a.emplace(i, std::to_string(i));
+    b.emplace(i + 100, "b");
+  }
+  a.merge(b);
+  EXPECT_EQ(a.size(), 300u);
+  EXPECT_EQ(b.size(), 100u);
+  EXPECT_EQ(a.at(250), "b");
+
+  auto nh = b.extract(b.begin());
+  nh.key() = -1;
+  auto r = a.insert(std::move(nh));
+  EXPECT_TRUE(r.inserted);
+  EXPECT_TRUE(r.node.empty());
+  EXPECT_EQ(a.at(-1), "b");
+  EXPECT_EQ(b.size(), 99u);
+
+  // 销毁来源表后目标表中的元素仍然有效
+  b = pool_map<int, std::string>();
+  for (int i = 0; i < 300; ++i) {
+    EXPECT_EQ(a.at(i), i < 200 ? std::to_string(i) : "b");
+  }
+}
@@ -1,6 +1,7 @@
 #include "gtest/gtest.h"
 #include <vector>
 #include <mystl/__memory/split_buffer.h>
+#include <mystl/__memory/shared_ptr.h>
 namespace mystl {
 
 // 测试默认构造函数
@@ -343,5 +344,45 @@ TEST(SplitBufferTest, Swap) {
   EXPECT_EQ(buf2.front(), 1);
 }
 
-}  // namespace mystl
+// 测试内存占用统计：前后两端的空闲空间都是 slack
+TEST(SplitBufferTest, MemoryUsage) {
+  split_buffer<int> empty;
+  EXPECT_EQ(empty.memory_usage().total_bytes(), 0);
+
+  std::allocator<int> alloc;
+  split_buffer<int> buf(10, 4, alloc);
+  buf.emplace_back(1);
+  buf.emplace_back(2);
+  memory_footprint f = footprint(buf);
+  EXPECT_EQ(f.payload_bytes, 2 * sizeof(int));
+  EXPECT_EQ(f.slack_bytes, 8 * sizeof(int));
+  EXPECT_EQ(f.allocations, 1);
+  EXPECT_EQ(f.rounding_bytes, malloc_rounding(10 * sizeof(int)));
+}
 
+// 测试可平凡重定位元素在两端扩容与平移时保持完整
+TEST(SplitBufferTest, RelocatingGrowth) {
+  shared_ptr<int> owner(new int(1));
+  {
+    split_buffer<shared_ptr<int>> buf;
+    for (int i = 0; i < 40; ++i) {
+      if (i % 3 == 0) {
+        buf.emplace_front(owner);
+      } else {
+        buf.emplace_back(owner);
+      }
+    }
+    buf.pop_front();
+    buf.emplace_back(owner);
+    buf.pop_back();
+    buf.pop_back();
+    buf.emplace_front(owner);
+    EXPECT_EQ(static_cast<long>(buf.size()) + 1, owner.use_count());
+    buf.shrink_to_fit();
+    EXPECT_EQ(buf.capacity(), buf.size());
+    EXPECT_EQ(static_cast<long>(buf.size()) + 1, owner.use_count());
+  }
+  EXPECT_EQ(owner.use_count(), 1);
+}
+
+}  // namespace mystl
@@ -0,0 +1,119 @@
+#include "gtest/gtest.h"
+#include <mystl/rcu_unordered_map.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using rcu_map = mystl::rcu_unordered_map<int, std::string>;
+
+// 读区间内看到的是进入时的版本，退出后再进入才看到新版本
+TEST(RcuUnorderedMapTest, SectionSeesSnapshot) {
+  rcu_map map;
+  auto reader = map.register_reader();
+  map.insert_or_assign(1, "one");
+  {
+    auto s = reader.read();
+    ASSERT_NE(s.find(1), nullptr);
+    EXPECT_EQ(*s.find(1), "one");
+    map.update([](rcu_map::map_type& m) {
+      m[1] = "uno";
+      m[2] = "dos";
+    });
+    EXPECT_EQ(*s.find(1), "one");
+    EXPECT_FALSE(s.contains(2));
+    EXPECT_EQ(s.size(), 1u);
+  }
+  auto s = reader.read();
+  EXPECT_EQ(*s.find(1), "uno");
+  EXPECT_EQ(s->at(2), "dos");
+  EXPECT_EQ(s.find(3), nullptr);
+}
+
+// 旧版本在仍有读者持有时不回收，读者退出后回收
+TEST(RcuUnorderedMapTest, ReclaimWaitsForReaders) {
+  rcu_map map;
+  auto r1 = map.register_reader();
+  auto r2 = map.register_reader();
+  {
+    auto outer = r1.read();
+    {
+      auto inner = r1.read();  // 嵌套区间
+    }
+    map.insert_or_assign(1, "a");
+    map.insert_or_assign(2, "b");
+    EXPECT_EQ(map.reclaim(), 2u);
+    EXPECT_TRUE(outer.get().empty());
+    r2.quiescent();
+  }
+  // r1 已退出，r2 已声明静止
+  EXPECT_EQ(map.reclaim(), 0u);
+
+  // 空闲但未注销的读者推迟回收；注销后即可回收
+  map.erase(1);
+  EXPECT_EQ(map.reclaim(), 1u);
+  { auto s = r1.read(); }
+  r2 = rcu_map::reader();
+  EXPECT_EQ(map.reclaim(), 0u);
+
+  auto s = r1.read();
+  EXPECT_EQ(s.size(), 1u);
+  EXPECT_EQ(*s.find(2), "b");
+}
+
+// 整体替换
+TEST(RcuUnorderedMapTest, Assign) {
+  rcu_map map(rcu_map::map_type{{1, "x"}});
+  auto reader = map.register_reader();
+  {
+    auto s = reader.read();
+    EXPECT_EQ(*s.find(1), "x");
+  }
+  rcu_map::map_type next;
+  for (int i = 0; i < 100; ++i) {
+    next.emplace(i, std::to_string(i));
+  }
+  map.assign(std::move(next));
+  auto s = reader.read();
+  EXPECT_EQ(s.size(), 100u);
+  EXPECT_EQ(*s.find(42), "42");
+}
+
+// 多个读者与一个写者并发：每个版本内容自洽（所有值等于版本号）
+TEST(RcuUnorderedMapTest, ConcurrentReadersAndWriter) {
+  mystl::rcu_unordered_map<int, int> map;
+  map.update([](auto& m) {
+    for (int i = 0; i < 64; ++i) {
+      m[i] = 0;
+    }
+  });
+  std::atomic<bool> stop{false};
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 4; ++t) {
+    readers.emplace_back([&] {
+      auto reader = map.register_reader();
+      while (!stop.load(std::memory_order_relaxed)) {
+        auto s = reader.read();
+        const int* first = s.find(0);
+        ASSERT_NE(first, nullptr);
+        for (int i = 0; i < 64; ++i) {
+          const int* v = s.find(i);
+          ASSERT_NE(v, nullptr);
+          EXPECT_EQ(*v, *first);
+        }
+      }
+    });
+  }
+  for (int version = 1; version <= 200; ++version) {
+    map.update([version](auto& m) {
+      for (auto it = m.begin(); it != m.end(); ++it) {
+        it->second = version;
+      }
+    });
+  }
+  stop = true;
+  for (std::thread& th : readers) {
+    th.join();
+  }
+  EXPECT_EQ(map.reclaim(), 0u);
+}
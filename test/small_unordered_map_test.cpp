@@ -0,0 +1,297 @@
+#include "gtest/gtest.h"
+#include <mystl/small_unordered_map.h>
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// 统计所有分配（节点与桶数组）；g_fail_at 为非负时第 g_fail_at 次分配抛出
+int g_allocations = 0;
+int g_fail_at = -1;
+
+template <class T>
+struct CountingAllocator {
+  using value_type = T;
+
+  CountingAllocator() = default;
+  template <class U>
+  CountingAllocator(const CountingAllocator<U>&) {}
+
+  T* allocate(size_t n) {
+    if (g_allocations++ == g_fail_at) {
+      throw std::bad_alloc();
+    }
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T* p, size_t n) { std::allocator<T>().deallocate(p, n); }
+
+  template <class U>
+  bool operator==(const CountingAllocator<U>&) const { return true; }
+  template <class U>
+  bool operator!=(const CountingAllocator<U>&) const { return false; }
+};
+
+// 与 std::unordered_map 逐项比较
+template <class Small, class Ref>
+void ExpectSameContents(const Small& map, const Ref& ref) {
+  ASSERT_EQ(map.size(), ref.size());
+  size_t visited = 0;
+  for (const auto& kv : map) {
+    auto it = ref.find(kv.first);
+    ASSERT_NE(it, ref.end());
+    EXPECT_EQ(it->second, kv.second);
+    ++visited;
+  }
+  EXPECT_EQ(visited, ref.size());
+}
+
+}  // namespace
+
+// 内联阶段：插入、查找、访问，不发生任何分配
+TEST(SmallUnorderedMapTest, InlineStageDoesNotAllocate) {
+  using map_type =
+      mystl::small_unordered_map<int, int, 8, std::hash<int>,
+                                 std::equal_to<int>,
+                                 CountingAllocator<std::pair<const int, int>>>;
+  g_allocations = 0;
+  map_type map;
+  for (int i = 0; i < 8; ++i) {
+    EXPECT_TRUE(map.emplace(i * 10, i).second);
+  }
+  EXPECT_FALSE(map.emplace(30, 99).second);
+  EXPECT_EQ(map.at(30), 3);
+  map[70] += 1;
+  EXPECT_EQ(map[70], 8);
+  EXPECT_TRUE(map.is_inline());
+  EXPECT_EQ(map.size(), 8u);
+  EXPECT_EQ(g_allocations, 0);
+
+  // 第 9 个元素触发迁移
+  map[80] = 8;
+  EXPECT_FALSE(map.is_inline());
+  EXPECT_GT(g_allocations, 0);
+  for (int i = 0; i < 9; ++i) {
+    EXPECT_EQ(map.at(i * 10), i == 7 ? 8 : i);
+  }
+
+  // clear 之后回到内联存储
+  map.clear();
+  EXPECT_TRUE(map.is_inline());
+  EXPECT_TRUE(map.empty());
+  int before = g_allocations;
+  map[1] = 1;
+  EXPECT_EQ(g_allocations, before);
+}
+
+// 不同键类型：32/64 位整数走 SIMD 比较，字符串走通用比较
+template <class Key, class MakeKey>
+void CheckInsertFindErase(MakeKey make_key) {
+  mystl::small_unordered_map<Key, int, 6> map;
+  std::unordered_map<Key, int> ref;
+  for (int i = 0; i < 6; ++i) {
+    map.try_emplace(make_key(i), i);
+    ref.emplace(make_key(i), i);
+  }
+  ExpectSameContents(map, ref);
+  for (int i = 0; i < 12; ++i) {
+    EXPECT_EQ(map.contains(make_key(i)), i < 6) << i;
+  }
+  EXPECT_EQ(map.erase(make_key(2)), 1u);
+  EXPECT_EQ(map.erase(make_key(2)), 0u);
+  ref.erase(make_key(2));
+  ExpectSameContents(map, ref);
+  EXPECT_FALSE(map.contains(make_key(2)));
+  EXPECT_TRUE(map.contains(make_key(5)));
+}
+
+TEST(SmallUnorderedMapTest, KeyTypes) {
+  CheckInsertFindErase<int32_t>([](int i) { return -i * 7; });
+  CheckInsertFindErase<uint32_t>([](int i) { return 0xfffffff0u + i; });
+  CheckInsertFindErase<int64_t>([](int i) { return int64_t(i) << 32; });
+  CheckInsertFindErase<uint64_t>([](int i) { return ~uint64_t(i); });
+  CheckInsertFindErase<std::string>(
+      [](int i) { return "key-" + std::to_string(i); });
+}
+
+// 按位比较时高低 32 位都要相等
+TEST(SmallUnorderedMapTest, WideKeysCompareBothHalves) {
+  mystl::small_unordered_map<uint64_t, int, 4> map;
+  map[0x100000001ULL] = 1;
+  map[0x200000001ULL] = 2;
+  EXPECT_FALSE(map.contains(1));
+  EXPECT_FALSE(map.contains(0x100000002ULL));
+  EXPECT_EQ(map.at(0x200000001ULL), 2);
+  // 删除后留在镜像数组里的旧值不会被匹配
+  map.erase(0x200000001ULL);
+  EXPECT_FALSE(map.contains(0x200000001ULL));
+}
+
+// 边遍历边删除：erase 返回的迭代器可以继续遍历
+TEST(SmallUnorderedMapTest, EraseWhileIterating) {
+  for (int n : {5, 20}) {
+    mystl::small_unordered_map<int, int, 8> map;
+    for (int i = 0; i < n; ++i) {
+      map[i] = i;
+    }
+    for (auto it = map.begin(); it != map.end();) {
+      if (it->first % 2 == 0) {
+        it = map.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    EXPECT_EQ(map.size(), static_cast<size_t>(n / 2));
+    for (const auto& kv : map) {
+      EXPECT_EQ(kv.first % 2, 1);
+    }
+  }
+}
+
+// 区间删除：内联阶段后面的元素前移
+TEST(SmallUnorderedMapTest, EraseRange) {
+  mystl::small_unordered_map<std::string, int, 8> map;
+  for (int i = 0; i < 6; ++i) {
+    map[std::to_string(i)] = i;
+  }
+  auto first = map.begin();
+  ++first;
+  auto last = first;
+  ++last;
+  ++last;
+  auto it = map.erase(first, last);
+  EXPECT_EQ(map.size(), 4u);
+  EXPECT_EQ(it->first, "3");
+  map.erase(map.begin(), map.end());
+  EXPECT_TRUE(map.empty());
+}
+
+// 拷贝、移动、交换：两边分别处于内联或哈希表阶段
+TEST(SmallUnorderedMapTest, CopyMoveSwap) {
+  using map_type = mystl::small_unordered_map<std::string, std::string, 4>;
+  auto make = [](int n) {
+    map_type m;
+    for (int i = 0; i < n; ++i) {
+      m[std::to_string(i)] = std::string(20, static_cast<char>('a' + i));
+    }
+    return m;
+  };
+  const int sizes[] = {0, 1, 3, 4, 9};
+  for (int na : sizes) {
+    for (int nb : sizes) {
+      map_type a = make(na);
+      map_type b = make(nb);
+      map_type a_copy(a);
+      map_type b_copy = b;
+      EXPECT_EQ(a, a_copy);
+      a.swap(b);
+      EXPECT_EQ(a, b_copy) << na << " " << nb;
+      EXPECT_EQ(b, a_copy) << na << " " << nb;
+      EXPECT_EQ(a.is_inline(), nb <= 4);
+
+      map_type moved(std::move(a));
+      EXPECT_EQ(moved, b_copy);
+      EXPECT_TRUE(a.empty());
+      a = b;
+      EXPECT_EQ(a, a_copy);
+      b = std::move(moved);
+      EXPECT_EQ(b, b_copy);
+    }
+  }
+}
+
+// 随机操作与 std::unordered_map 对拍，反复跨越内联容量
+TEST(SmallUnorderedMapTest, RandomOperations) {
+  mystl::small_unordered_map<int, int, 4> map;
+  std::unordered_map<int, int> ref;
+  std::mt19937 rng(17);
+  for (int step = 0; step < 20000; ++step) {
+    int key = static_cast<int>(rng() % 12);
+    switch (rng() % 6) {
+      case 0:
+      case 1:
+        map[key] = step;
+        ref[key] = step;
+        break;
+      case 2:
+        EXPECT_EQ(map.insert_or_assign(key, -step).second,
+                  ref.insert_or_assign(key, -step).second);
+        break;
+      case 3:
+        EXPECT_EQ(map.erase(key), ref.erase(key));
+        break;
+      case 4:
+        EXPECT_EQ(map.count(key), ref.count(key));
+        break;
+      case 5:
+        if (rng() % 50 == 0) {
+          map.clear();
+          ref.clear();
+        }
+        break;
+    }
+    ASSERT_EQ(map.size(), ref.size());
+  }
+  ExpectSameContents(map, ref);
+}
+
+// reserve 超过内联容量时提前迁移
+TEST(SmallUnorderedMapTest, ReserveMigrates) {
+  mystl::small_unordered_map<int, int, 4> map{{1, 1}, {2, 2}};
+  map.reserve(3);
+  EXPECT_TRUE(map.is_inline());
+  map.reserve(100);
+  EXPECT_FALSE(map.is_inline());
+  EXPECT_EQ(map.at(2), 2);
+  EXPECT_THROW(map.at(3), std::out_of_range);
+}
+
+// 迁移中途分配失败：元素都可拷贝时内联元素保持原状
+TEST(SmallUnorderedMapTest, MigrateFailureKeepsInlineElements) {
+  using map_type = mystl::small_unordered_map<
+      std::string, std::string, 4, std::hash<std::string>,
+      std::equal_to<std::string>,
+      CountingAllocator<std::pair<const std::string, std::string>>>;
+  map_type map;
+  for (int i = 0; i < 4; ++i) {
+    map.emplace(std::string(32, 'a' + i), std::to_string(i));
+  }
+  std::unordered_map<std::string, std::string> ref(map.begin(), map.end());
+
+  // 桶数组之后的第 3 个节点分配失败
+  g_allocations = 0;
+  g_fail_at = 3;
+  EXPECT_THROW(map.emplace(std::string(32, 'z'), "z"), std::bad_alloc);
+  g_fail_at = -1;
+  EXPECT_TRUE(map.is_inline());
+  ExpectSameContents(map, ref);
+
+  map.emplace(std::string(32, 'z'), "z");
+  ref.emplace(std::string(32, 'z'), "z");
+  EXPECT_FALSE(map.is_inline());
+  ExpectSameContents(map, ref);
+}
+
+// 带提示的插入：提示被忽略，std::inserter 可用
+TEST(SmallUnorderedMapTest, HintedInsert) {
+  mystl::small_unordered_map<int, int, 4> map;
+  std::vector<std::pair<const int, int>> src{{1, 1}, {2, 2}, {3, 3},
+                                             {4, 4}, {5, 5}, {1, 9}};
+  std::copy(src.begin(), src.end(), std::inserter(map, map.end()));
+  EXPECT_EQ(map.size(), 5u);
+  EXPECT_EQ(map.at(1), 1);
+
+  auto it = map.insert(map.begin(), std::pair<const int, int>(6, 6));
+  EXPECT_EQ(it->second, 6);
+  it = map.emplace_hint(map.end(), 7, 7);
+  EXPECT_EQ(it->first, 7);
+  it = map.emplace_hint(map.end(), 7, 8);
+  EXPECT_EQ(it->second, 7);
+  EXPECT_EQ(map.size(), 7u);
+}
@@ -224,3 +224,19 @@ TEST(StringTest, Swap) {
   EXPECT_STREQ(s1.c_str(), "hello");
   EXPECT_STREQ(s2.c_str(), "world");
 }
+
+// 测试内存占用统计：短字符串不占堆内存
+TEST(StringTest, MemoryUsage) {
+  mystl::string small("hi");
+  mystl::memory_footprint fs = mystl::footprint(small);
+  EXPECT_EQ(fs.total_bytes(), 0);
+  EXPECT_EQ(fs.allocations, 0);
+
+  mystl::string large(100, 'x');
+  mystl::memory_footprint fl = large.memory_usage();
+  EXPECT_EQ(fl.payload_bytes, 100);
+  EXPECT_EQ(fl.slack_bytes, large.capacity() - 100);
+  EXPECT_EQ(fl.overhead_bytes, 1);  // 结尾的空字符
+  EXPECT_EQ(fl.allocations, 1);
+  EXPECT_EQ(fl.rounding_bytes, mystl::malloc_rounding(large.capacity() + 1));
+}
@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+#include <mystl/deque.h>
+#include <mystl/list.h>
+#include <mystl/memory.h>
+#include <mystl/string.h>
+#include <mystl/type_traits.h>
+#include <mystl/vector.h>
+#include <string>
+
+namespace {
+struct Widget {
+  mystl::unique_ptr<int> p;
+  mystl::string name;
+};
+
+struct SelfRef {
+  SelfRef* self = this;
+  SelfRef() = default;
+  SelfRef(const SelfRef&) : self(this) {}
+};
+}  // namespace
+
+TINYSTL_DECLARE_TRIVIALLY_RELOCATABLE(Widget);
+
+TEST(TypeTraitsTest, IsTriviallyRelocatable) {
+    EXPECT_TRUE(mystl::is_trivially_relocatable<int>::value);
+    EXPECT_TRUE(mystl::is_trivially_relocatable<int*>::value);
+    EXPECT_FALSE(mystl::is_trivially_relocatable<SelfRef>::value);
+
+    // mystl 自己的容器与智能指针
+    EXPECT_TRUE(mystl::is_trivially_relocatable_v<mystl::vector<SelfRef>>);
+    EXPECT_TRUE(mystl::is_trivially_relocatable_v<mystl::deque<SelfRef>>);
+    EXPECT_TRUE(mystl::is_trivially_relocatable_v<mystl::string>);
+    EXPECT_TRUE(mystl::is_trivially_relocatable_v<mystl::unique_ptr<int>>);
+    EXPECT_TRUE(mystl::is_trivially_relocatable_v<mystl::shared_ptr<int>>);
+    EXPECT_TRUE(mystl::is_trivially_relocatable_v<mystl::weak_ptr<int>>);
+    EXPECT_TRUE(mystl::is_trivially_relocatable_v<
+                mystl::split_buffer<SelfRef>>);
+
+    // 哨兵节点内嵌在对象中，list 不能重定位
+    EXPECT_FALSE(mystl::is_trivially_relocatable_v<mystl::list<int>>);
+    // 标准库类型不做假设
+    EXPECT_FALSE(mystl::is_trivially_relocatable_v<std::string>);
+
+    EXPECT_TRUE(mystl::is_trivially_relocatable_v<Widget>);
+}
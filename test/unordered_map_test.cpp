@@ -1,8 +1,17 @@
 #include "gtest/gtest.h"
+#include <mystl/functional.h>
 #include <mystl/unordered_map.h>
+#include <algorithm>
+#include <cstdint>
+#include <list>
+#include <stdexcept>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <type_traits>
+#include <unordered_map>
+#include <random>
 
 // 测试默认构造函数
 TEST(UnorderedMapTest, DefaultConstructor) {
@@ -59,6 +68,30 @@ TEST(UnorderedMapTest, CopyConstructor) {
   EXPECT_EQ(original.size(), 2);  // 原对象不应被修改
 }
 
+// 测试大表拷贝：桶数与原表一致，元素完整；指定分配器的拷贝构造
+TEST(UnorderedMapTest, CopyConstructorLarge) {
+  mystl::unordered_map<int, int> original;
+  for (int i = 0; i < 5000; ++i) {
+    original[i] = i * 2;
+  }
+  original.erase(17);
+
+  mystl::unordered_map<int, int> copy(original);
+  EXPECT_EQ(copy.size(), original.size());
+  EXPECT_EQ(copy.bucket_count(), original.bucket_count());
+  for (int i = 0; i < 5000; ++i) {
+    EXPECT_EQ(copy.count(i), i == 17 ? 0u : 1u);
+  }
+  EXPECT_EQ(copy.at(4999), 9998);
+  EXPECT_TRUE(copy.insert({17, 34}).second);
+  EXPECT_FALSE(copy.insert({18, 0}).second);
+
+  mystl::unordered_map<int, int> with_alloc(original,
+                                            original.get_allocator());
+  EXPECT_EQ(with_alloc.size(), original.size());
+  EXPECT_EQ(with_alloc.at(1234), 2468);
+}
+
 // 测试移动构造函数
 TEST(UnorderedMapTest, MoveConstructor) {
   mystl::unordered_map<int, std::string> original;
@@ -193,6 +226,69 @@ TEST(UnorderedMapTest, Emplace) {
   EXPECT_EQ(map.size(), 2);
 }
 
+// 记录构造次数的 mapped_type
+struct CountedValue {
+  static int constructions;
+  int v;
+  explicit CountedValue(int x) : v(x) { ++constructions; }
+  CountedValue(const CountedValue& other) : v(other.v) { ++constructions; }
+  CountedValue& operator=(const CountedValue&) = default;
+};
+int CountedValue::constructions = 0;
+
+// 测试 try_emplace：命中时不构造 mapped_type，也不移走参数
+TEST(UnorderedMapTest, TryEmplace) {
+  mystl::unordered_map<int, CountedValue> map;
+  CountedValue::constructions = 0;
+  auto [it1, inserted1] = map.try_emplace(1, 10);
+  EXPECT_TRUE(inserted1);
+  EXPECT_EQ(it1->second.v, 10);
+  EXPECT_EQ(CountedValue::constructions, 1);
+
+  auto [it2, inserted2] = map.try_emplace(1, 20);
+  EXPECT_FALSE(inserted2);
+  EXPECT_EQ(it2, it1);
+  EXPECT_EQ(it2->second.v, 10);
+  EXPECT_EQ(CountedValue::constructions, 1);
+
+  mystl::unordered_map<std::string, std::unique_ptr<int>> owners;
+  std::string key = "k";
+  auto p = std::make_unique<int>(1);
+  EXPECT_TRUE(owners.try_emplace(key, std::move(p)).second);
+  EXPECT_EQ(p, nullptr);
+  p = std::make_unique<int>(2);
+  EXPECT_FALSE(owners.try_emplace(std::move(key), std::move(p)).second);
+  EXPECT_NE(p, nullptr);     // 命中：参数未被移走
+  EXPECT_EQ(key, "k");       // 命中：键也未被移走
+  EXPECT_EQ(*owners["k"], 1);
+
+  auto it3 = map.try_emplace(map.begin(), 2, 30);
+  EXPECT_EQ(it3->second.v, 30);
+  EXPECT_EQ(map.try_emplace(map.end(), 2, 40), it3);
+  EXPECT_EQ(map.size(), 2u);
+}
+
+// 测试 insert_or_assign：不存在时插入，存在时赋值
+TEST(UnorderedMapTest, InsertOrAssign) {
+  mystl::unordered_map<std::string, std::string> map;
+  auto [it1, inserted1] = map.insert_or_assign("a", "1");
+  EXPECT_TRUE(inserted1);
+  EXPECT_EQ(it1->second, "1");
+
+  std::string value = "2";
+  auto [it2, inserted2] = map.insert_or_assign("a", std::move(value));
+  EXPECT_FALSE(inserted2);
+  EXPECT_EQ(it2, it1);
+  EXPECT_EQ(map.at("a"), "2");
+
+  std::string key = "b";
+  auto it3 = map.insert_or_assign(map.end(), key, "3");
+  EXPECT_EQ(it3->first, "b");
+  EXPECT_EQ(map.insert_or_assign(map.begin(), std::move(key), "4"), it3);
+  EXPECT_EQ(map.at("b"), "4");
+  EXPECT_EQ(map.size(), 2u);
+}
+
 // 测试 find
 TEST(UnorderedMapTest, Find) {
   mystl::unordered_map<int, std::string> map;
@@ -296,14 +392,20 @@ TEST(UnorderedMapTest, EraseRange) {
   map[3] = "three";
   map[4] = "four";
 
-  auto it1 = map.find(2);
-  auto it2 = map.find(4);
+  // 遍历顺序由哈希决定，这里删除迭代顺序上的前两个元素
+  auto it1 = map.begin();
+  auto it2 = it1;
+  int erased1 = (it2++)->first;
+  int erased2 = (it2++)->first;
+  auto it3 = it2;
+  int kept1 = (it3++)->first;
+  int kept2 = it3->first;
   map.erase(it1, it2);
   EXPECT_EQ(map.size(), 2);
-  EXPECT_EQ(map.find(2), map.end());
-  EXPECT_EQ(map.find(3), map.end());
-  EXPECT_NE(map.find(1), map.end());
-  EXPECT_NE(map.find(4), map.end());
+  EXPECT_EQ(map.find(erased1), map.end());
+  EXPECT_EQ(map.find(erased2), map.end());
+  EXPECT_NE(map.find(kept1), map.end());
+  EXPECT_NE(map.find(kept2), map.end());
 }
 
 // 测试 clear
@@ -641,3 +743,1086 @@ TEST(UnorderedMapTest, MultipleInsertAndErase) {
   }
 }
 
+
+// 测试快速取模：乘法结果必须与硬件取模完全一致
+TEST(HashBucketPolicyTest, FastModMatchesModulo) {
+  std::mt19937_64 rng(2024);
+  for (size_t i = 0; i < mystl::hash_prime_list_size; ++i) {
+    mystl::hash_prime_bucket_policy policy;
+    size_t bc = mystl::hash_prime_list[i];
+    policy.reset(bc);
+    for (int j = 0; j < 2000; ++j) {
+      uint64_t h = rng();
+      uint32_t folded = static_cast<uint32_t>(h ^ (h >> 32));
+      ASSERT_EQ(policy.constrain(static_cast<size_t>(h)), folded % bc);
+    }
+    ASSERT_EQ(policy.constrain(0), 0u);
+    ASSERT_EQ(policy.constrain(bc), 0u);
+    ASSERT_EQ(policy.constrain(bc - 1), bc - 1);
+  }
+}
+
+// 测试桶数取整：质数策略取表中质数，2 的幂策略取 2 的幂
+TEST(HashBucketPolicyTest, RoundBucketCount) {
+  EXPECT_EQ(mystl::hash_prime_bucket_policy::round_bucket_count(1), 3u);
+  EXPECT_EQ(mystl::hash_prime_bucket_policy::round_bucket_count(100), 193u);
+  EXPECT_EQ(mystl::hash_prime_bucket_policy::round_bucket_count(193), 193u);
+  EXPECT_EQ(mystl::hash_power2_bucket_policy::round_bucket_count(1), 2u);
+  EXPECT_EQ(mystl::hash_power2_bucket_policy::round_bucket_count(100), 128u);
+  EXPECT_EQ(mystl::hash_default_bucket_policy::round_bucket_count(1), 2u);
+  EXPECT_EQ(mystl::hash_default_bucket_policy::round_bucket_count(64), 64u);
+  EXPECT_EQ(mystl::hash_default_bucket_policy::round_bucket_count(100), 101u);
+  EXPECT_EQ(mystl::hash_mask_bucket_policy::round_bucket_count(100), 128u);
+}
+
+// 默认策略在 reset 时预先判断 2 的幂，映射结果必须与 constrain_hash 一致
+TEST(HashBucketPolicyTest, DefaultPolicyMatchesConstrainHash) {
+  std::mt19937_64 rng(7);
+  const size_t counts[] = {2, 3, 4, 13, 64, 97, 1024, 1543};
+  for (size_t bc : counts) {
+    mystl::hash_default_bucket_policy policy;
+    policy.reset(bc);
+    for (int j = 0; j < 2000; ++j) {
+      size_t h = static_cast<size_t>(rng()) >> (j % 64);
+      ASSERT_EQ(policy.constrain(h), mystl::constrain_hash(h, bc)) << bc;
+    }
+  }
+  // 掩码策略直接取低位
+  mystl::hash_mask_bucket_policy mask;
+  mask.reset(256);
+  EXPECT_EQ(mask.constrain(0x12345), 0x45u);
+}
+
+// 三种桶数策略（以及三种哈希值缓存策略）下 unordered_map 的行为必须一致
+template <class Policy, class Cache = mystl::hash_cache_full,
+          class Hash = std::hash<int>>
+void CheckMapWithPolicy() {
+  using map_type = mystl::unordered_map<int, int, Hash,
+                                        std::equal_to<int>,
+                                        std::allocator<std::pair<const int, int>>,
+                                        Policy, Cache>;
+  map_type map;
+  for (int i = 0; i < 5000; ++i) {
+    map[i * 16] = i;  // 等步长的键，容易在掩码下冲突
+  }
+  EXPECT_EQ(map.size(), 5000u);
+  for (int i = 0; i < 5000; ++i) {
+    auto it = map.find(i * 16);
+    ASSERT_NE(it, map.end());
+    EXPECT_EQ(it->second, i);
+  }
+  EXPECT_EQ(map.find(1), map.end());
+
+  // 局部迭代器遍历每个桶，总数应等于元素个数，且每个元素都在自己的桶里
+  size_t total = 0;
+  for (size_t b = 0; b < map.bucket_count(); ++b) {
+    size_t in_bucket = 0;
+    for (auto it = map.begin(b); it != map.end(b); ++it) {
+      EXPECT_EQ(map.bucket(it->first), b);
+      ++in_bucket;
+    }
+    EXPECT_EQ(in_bucket, map.bucket_size(b));
+    total += in_bucket;
+  }
+  EXPECT_EQ(total, map.size());
+
+  for (int i = 0; i < 5000; i += 2) {
+    EXPECT_EQ(map.erase(i * 16), 1u);
+  }
+  map.rehash(map.bucket_count() * 3);
+  for (int i = 0; i < 5000; ++i) {
+    EXPECT_EQ(map.count(i * 16), static_cast<size_t>(i % 2));
+  }
+
+  // 批量查找与逐个 find 结果一致（含已删除的键与从未插入的键）
+  std::vector<int> keys;
+  for (int i = 0; i < 6000; ++i) {
+    keys.push_back(i * 16);
+  }
+  std::vector<typename map_type::iterator> found(keys.size());
+  map.find_batch(keys.data(), keys.size(), found.data());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    EXPECT_EQ(found[i], map.find(keys[i]));
+  }
+
+  map_type moved(std::move(map));
+  EXPECT_EQ(moved.size(), 2500u);
+  EXPECT_EQ(map.find(16), map.end());
+}
+
+TEST(HashBucketPolicyTest, DefaultPolicyMap) {
+  CheckMapWithPolicy<mystl::hash_default_bucket_policy>();
+}
+
+TEST(HashBucketPolicyTest, PrimePolicyMap) {
+  CheckMapWithPolicy<mystl::hash_prime_bucket_policy>();
+}
+
+TEST(HashBucketPolicyTest, Power2PolicyMap) {
+  CheckMapWithPolicy<mystl::hash_power2_bucket_policy>();
+}
+
+TEST(HashBucketPolicyTest, MaskPolicyMap) {
+  CheckMapWithPolicy<mystl::hash_mask_bucket_policy, mystl::hash_cache_full,
+                     mystl::hash<int>>();
+  CheckMapWithPolicy<mystl::hash_mask_bucket_policy, mystl::hash_cache_none,
+                     mystl::hash<int>>();
+}
+
+// ==================== 哈希值缓存策略 ====================
+TEST(HashCachePolicyTest, MapWithEachPolicy) {
+  CheckMapWithPolicy<mystl::hash_default_bucket_policy,
+                     mystl::hash_cache_fingerprint>();
+  CheckMapWithPolicy<mystl::hash_prime_bucket_policy,
+                     mystl::hash_cache_fingerprint>();
+  CheckMapWithPolicy<mystl::hash_power2_bucket_policy,
+                     mystl::hash_cache_fingerprint>();
+  CheckMapWithPolicy<mystl::hash_default_bucket_policy,
+                     mystl::hash_cache_none>();
+  CheckMapWithPolicy<mystl::hash_prime_bucket_policy,
+                     mystl::hash_cache_none>();
+  CheckMapWithPolicy<mystl::hash_power2_bucket_policy,
+                     mystl::hash_cache_none>();
+}
+
+template <class K, class V, class Cache>
+using cached_map =
+    mystl::unordered_map<K, V, std::hash<K>, std::equal_to<K>,
+                         std::allocator<std::pair<const K, V>>,
+                         mystl::hash_default_bucket_policy, Cache>;
+
+template <class Map>
+size_t NodeBytes() {
+  Map map;
+  map.emplace(typename Map::key_type(), typename Map::mapped_type());
+  return map.stats().node_bytes;
+}
+
+TEST(HashCachePolicyTest, NodeSize) {
+  // 不保存哈希值：每个节点省下一个 size_t
+  EXPECT_EQ((NodeBytes<cached_map<std::uint64_t, std::uint64_t,
+                                  mystl::hash_cache_none>>()),
+            (NodeBytes<cached_map<std::uint64_t, std::uint64_t,
+                                  mystl::hash_cache_full>>()) -
+                sizeof(size_t));
+  EXPECT_EQ((NodeBytes<cached_map<int, int, mystl::hash_cache_none>>()),
+            (NodeBytes<cached_map<int, int, mystl::hash_cache_full>>()) -
+                sizeof(size_t));
+  // 指纹放在 next 指针之后，值类型对齐为 4 时可以和元素共用补齐空间
+  EXPECT_LE((NodeBytes<cached_map<int, int, mystl::hash_cache_fingerprint>>()),
+            (NodeBytes<cached_map<int, int, mystl::hash_cache_full>>()));
+  EXPECT_LE((NodeBytes<cached_map<std::string, int,
+                                  mystl::hash_cache_fingerprint>>()),
+            (NodeBytes<cached_map<std::string, int,
+                                  mystl::hash_cache_full>>()));
+}
+
+TEST(HashCachePolicyTest, FingerprintReduce) {
+  using fp = mystl::hash_cache_fingerprint;
+  for (std::uint64_t h : {std::uint64_t(0), std::uint64_t(12345),
+                          std::uint64_t(0x123456789abcdef0ULL),
+                          ~std::uint64_t(0)}) {
+    size_t r = fp::reduce(static_cast<size_t>(h));
+    EXPECT_LE(r, size_t(0xffffffffu));
+    EXPECT_EQ(fp::reduce(r), r);
+  }
+}
+
+// 完整哈希值不同但指纹相同的键：指纹只用于快速拒绝，最终以键比较为准
+struct FoldCollisionHash {
+  size_t operator()(int k) const {
+    std::uint64_t x = static_cast<std::uint64_t>(k);
+    return static_cast<size_t>((x << 32) | x);  // 高低两半相同，指纹恒为 0
+  }
+};
+
+TEST(HashCachePolicyTest, FingerprintCollisions) {
+  mystl::unordered_map<int, int, FoldCollisionHash, std::equal_to<int>,
+                       std::allocator<std::pair<const int, int>>,
+                       mystl::hash_default_bucket_policy,
+                       mystl::hash_cache_fingerprint>
+      map;
+  for (int i = 0; i < 200; ++i) {
+    map[i] = i * 2;
+  }
+  EXPECT_EQ(map.size(), 200u);
+  for (int i = 0; i < 200; ++i) {
+    ASSERT_NE(map.find(i), map.end());
+    EXPECT_EQ(map.at(i), i * 2);
+  }
+  EXPECT_EQ(map.find(200), map.end());
+  EXPECT_EQ(map.erase(7), 1u);
+  EXPECT_FALSE(map.contains(7));
+  EXPECT_EQ(map.size(), 199u);
+}
+
+TEST(HashCachePolicyTest, StringKeysWithFingerprint) {
+  cached_map<std::string, int, mystl::hash_cache_fingerprint> map;
+  std::unordered_map<std::string, int> ref;
+  for (int i = 0; i < 3000; ++i) {
+    std::string key = "key-" + std::to_string(i * 7919);
+    map.emplace(key, i);
+    ref.emplace(key, i);
+  }
+  for (int i = 0; i < 3000; i += 3) {
+    std::string key = "key-" + std::to_string(i * 7919);
+    EXPECT_EQ(map.erase(key), ref.erase(key));
+  }
+  ASSERT_EQ(map.size(), ref.size());
+  for (const auto& kv : ref) {
+    auto it = map.find(kv.first);
+    ASSERT_NE(it, map.end());
+    EXPECT_EQ(it->second, kv.second);
+  }
+  auto copy = map;
+  EXPECT_EQ(copy, map);
+}
+
+TEST(HashCachePolicyTest, NodeHandlesWithoutCachedHash) {
+  using map_type = cached_map<int, std::string, mystl::hash_cache_none>;
+  map_type a{{1, "one"}, {2, "two"}, {3, "three"}};
+  map_type b{{3, "drei"}, {4, "vier"}};
+
+  auto nh = a.extract(2);
+  ASSERT_FALSE(nh.empty());
+  nh.key() = 20;
+  EXPECT_TRUE(b.insert(std::move(nh)).inserted);
+  EXPECT_EQ(b.at(20), "two");
+
+  b.merge(a);
+  EXPECT_EQ(b.size(), 4u);
+  EXPECT_EQ(b.at(1), "one");
+  EXPECT_EQ(b.at(3), "drei");
+  ASSERT_EQ(a.size(), 1u);
+  EXPECT_EQ(a.at(3), "three");
+}
+
+// ==================== 异构查找 ====================
+// 计数键：记录构造次数，用来确认异构查找没有构造临时键
+struct CountedKey {
+  static inline int constructed = 0;
+  std::string name;
+
+  explicit CountedKey(std::string_view s) : name(s) { ++constructed; }
+  CountedKey(const CountedKey& other) : name(other.name) { ++constructed; }
+  CountedKey(CountedKey&& other) noexcept : name(std::move(other.name)) {}
+};
+
+struct CountedKeyHash {
+  using is_transparent = void;
+  size_t operator()(std::string_view s) const {
+    return std::hash<std::string_view>()(s);
+  }
+  size_t operator()(const CountedKey& k) const { return (*this)(k.name); }
+};
+
+struct CountedKeyEqual {
+  using is_transparent = void;
+  bool operator()(const CountedKey& lhs, const CountedKey& rhs) const {
+    return lhs.name == rhs.name;
+  }
+  bool operator()(const CountedKey& lhs, std::string_view rhs) const {
+    return lhs.name == rhs;
+  }
+  bool operator()(std::string_view lhs, const CountedKey& rhs) const {
+    return lhs == rhs.name;
+  }
+};
+
+template <class Map, class K, class = void>
+struct has_find_with : std::false_type {};
+
+template <class Map, class K>
+struct has_find_with<
+    Map, K, std::void_t<decltype(std::declval<const Map&>().find(
+                std::declval<const K&>()))>> : std::true_type {};
+
+TEST(UnorderedMapTest, TransparentLookup) {
+  mystl::unordered_map<CountedKey, int, CountedKeyHash, CountedKeyEqual> map;
+  map.emplace(CountedKey("apple"), 1);
+  map.emplace(CountedKey("banana"), 2);
+  map.emplace(CountedKey("cherry"), 3);
+
+  int before = CountedKey::constructed;
+  std::string_view banana = "banana";
+  auto it = map.find(banana);
+  ASSERT_NE(it, map.end());
+  EXPECT_EQ(it->second, 2);
+  EXPECT_EQ(std::as_const(map).find(std::string_view("cherry"))->second, 3);
+  EXPECT_EQ(map.find(std::string_view("durian")), map.end());
+  EXPECT_EQ(map.count(std::string_view("apple")), 1);
+  EXPECT_TRUE(map.contains(std::string_view("apple")));
+  EXPECT_FALSE(map.contains(std::string_view("durian")));
+  EXPECT_EQ(map.at(std::string_view("apple")), 1);
+  EXPECT_THROW(map.at(std::string_view("durian")), std::out_of_range);
+  EXPECT_EQ(map.bucket(banana), map.bucket(it->first));
+  EXPECT_EQ(map.erase(banana), 1);
+  EXPECT_EQ(map.erase(banana), 0);
+  EXPECT_EQ(map.size(), 2);
+  // 以上查找与删除都不应构造任何 CountedKey
+  EXPECT_EQ(CountedKey::constructed, before);
+
+  // 按迭代器删除仍选择迭代器重载
+  map.erase(map.find(std::string_view("apple")));
+  EXPECT_EQ(map.size(), 1);
+}
+
+TEST(UnorderedMapTest, TransparentLookupRequiresBothTags) {
+  using plain_map = mystl::unordered_map<std::string, int>;
+  using transparent_map =
+      mystl::unordered_map<CountedKey, int, CountedKeyHash, CountedKeyEqual>;
+  using hash_only_map = mystl::unordered_map<CountedKey, int, CountedKeyHash,
+                                             std::equal_to<CountedKey>>;
+  // string_view 不能隐式转换为 std::string，只有透明表才接受它
+  EXPECT_FALSE((has_find_with<plain_map, std::string_view>::value));
+  EXPECT_TRUE((has_find_with<transparent_map, std::string_view>::value));
+  EXPECT_FALSE((has_find_with<hash_only_map, std::string_view>::value));
+}
+
+// ==================== 批量查找 ====================
+TEST(UnorderedMapTest, FindBatch) {
+  mystl::unordered_map<int, int> map;
+  std::vector<int> keys{1, 2, 3};
+  std::vector<mystl::unordered_map<int, int>::iterator> out(keys.size());
+  // 空表：全部为 end()
+  map.find_batch(keys.data(), keys.size(), out.data());
+  for (auto it : out) {
+    EXPECT_EQ(it, map.end());
+  }
+
+  for (int i = 0; i < 1000; ++i) {
+    map[i * 3] = i;
+  }
+  // 覆盖不满一组、恰好一组、跨组等各种长度
+  for (size_t n : {0u, 1u, 15u, 16u, 17u, 33u, 500u}) {
+    keys.clear();
+    for (size_t i = 0; i < n; ++i) {
+      keys.push_back(static_cast<int>(i * 7));
+    }
+    out.assign(n, map.end());
+    map.find_batch(keys.data(), n, out.data());
+    for (size_t i = 0; i < n; ++i) {
+      auto expected = map.find(keys[i]);
+      ASSERT_EQ(out[i], expected);
+      if (expected != map.end()) {
+        EXPECT_EQ(out[i]->second, keys[i] / 3);
+      }
+    }
+  }
+
+  // 返回的迭代器可以直接修改元素
+  int key = 9;
+  map.find_batch(&key, 1, out.data());
+  out[0]->second = -1;
+  EXPECT_EQ(map.at(9), -1);
+
+  const auto& cmap = map;
+  std::vector<mystl::unordered_map<int, int>::const_iterator> const_out(2);
+  int ckeys[] = {9, 10};
+  cmap.find_batch(ckeys, 2, const_out.data());
+  EXPECT_EQ(const_out[0]->second, -1);
+  EXPECT_EQ(const_out[1], cmap.end());
+}
+
+TEST(UnorderedMapTest, FindBatchTransparent) {
+  mystl::unordered_map<CountedKey, int, CountedKeyHash, CountedKeyEqual> map;
+  map.emplace(CountedKey("apple"), 1);
+  map.emplace(CountedKey("banana"), 2);
+
+  int before = CountedKey::constructed;
+  std::string_view keys[] = {"banana", "durian", "apple"};
+  decltype(map)::iterator out[3];
+  map.find_batch(keys, 3, out);
+  EXPECT_EQ(out[0]->second, 2);
+  EXPECT_EQ(out[1], map.end());
+  EXPECT_EQ(out[2]->second, 1);
+  EXPECT_EQ(CountedKey::constructed, before);
+}
+
+// ==================== 渐进式 rehash ====================
+// 每个元素都能通过 find 找到，遍历恰好访问 size() 个元素
+template <class Map, class Ref>
+void ExpectSameContents(Map& map, const Ref& ref) {
+  ASSERT_EQ(map.size(), ref.size());
+  size_t n = 0;
+  for (auto it = map.begin(); it != map.end(); ++it) {
+    auto rit = ref.find(it->first);
+    ASSERT_NE(rit, ref.end());
+    EXPECT_EQ(it->second, rit->second);
+    ++n;
+  }
+  EXPECT_EQ(n, ref.size());
+  for (const auto& kv : ref) {
+    auto it = map.find(kv.first);
+    ASSERT_NE(it, map.end());
+    EXPECT_EQ(it->second, kv.second);
+  }
+}
+
+// 完成迁移后桶接口与普通 rehash 一致
+template <class Map>
+void ExpectBucketsConsistent(const Map& map) {
+  size_t total = 0;
+  for (size_t b = 0; b < map.bucket_count(); ++b) {
+    for (auto it = map.begin(b); it != map.end(b); ++it) {
+      EXPECT_EQ(map.bucket(it->first), b);
+      ++total;
+    }
+  }
+  EXPECT_EQ(total, map.size());
+}
+
+template <class Policy, class Cache = mystl::hash_cache_full>
+void CheckIncrementalRehash() {
+  using map_type =
+      mystl::unordered_map<int, int, std::hash<int>, std::equal_to<int>,
+                           std::allocator<std::pair<const int, int>>, Policy,
+                           Cache>;
+  map_type map;
+  map.set_incremental_rehash(true);
+  EXPECT_TRUE(map.incremental_rehash());
+  std::unordered_map<int, int> ref;
+
+  std::mt19937 rng(2024);
+  std::uniform_int_distribution<int> key_dist(0, 60000);
+  bool saw_migration = false;
+  for (int step = 0; step < 200000; ++step) {
+    int k = key_dist(rng);
+    switch (rng() % 8) {
+      case 0:
+      case 1:
+        EXPECT_EQ(map.erase(k), ref.erase(k));
+        break;
+      case 2: {
+        auto it = map.find(k);
+        auto rit = ref.find(k);
+        ASSERT_EQ(it == map.end(), rit == ref.end());
+        if (rit != ref.end()) {
+          EXPECT_EQ(it->second, rit->second);
+        }
+        break;
+      }
+      case 3:
+        EXPECT_EQ(map.emplace(k, step).second, ref.emplace(k, step).second);
+        break;
+      default:
+        map[k] = step;
+        ref[k] = step;
+    }
+    saw_migration = saw_migration || map.rehash_in_progress();
+    if (step % 20000 == 0) {
+      ExpectSameContents(map, ref);
+    }
+  }
+  EXPECT_TRUE(saw_migration);
+  ExpectSameContents(map, ref);
+  map.finish_rehash();
+  EXPECT_FALSE(map.rehash_in_progress());
+  ExpectBucketsConsistent(map);
+}
+
+TEST(IncrementalRehashTest, RandomOperationsDefaultPolicy) {
+  CheckIncrementalRehash<mystl::hash_default_bucket_policy>();
+}
+
+TEST(IncrementalRehashTest, RandomOperationsPrimePolicy) {
+  CheckIncrementalRehash<mystl::hash_prime_bucket_policy>();
+}
+
+TEST(IncrementalRehashTest, RandomOperationsPower2Policy) {
+  CheckIncrementalRehash<mystl::hash_power2_bucket_policy>();
+}
+
+TEST(IncrementalRehashTest, RandomOperationsFingerprint) {
+  CheckIncrementalRehash<mystl::hash_prime_bucket_policy,
+                         mystl::hash_cache_fingerprint>();
+}
+
+TEST(IncrementalRehashTest, RandomOperationsNoCachedHash) {
+  CheckIncrementalRehash<mystl::hash_power2_bucket_policy,
+                         mystl::hash_cache_none>();
+}
+
+// 插入直到处于迁移阶段中途（准备阶段只持续很少几次插入），返回参照表
+static std::unordered_map<int, int> FillUntilMigrating(
+    mystl::unordered_map<int, int>& map) {
+  std::unordered_map<int, int> ref;
+  map.set_incremental_rehash(true);
+  int in_progress = 0;
+  for (int i = 0; i < 20000 || in_progress < 100; ++i) {
+    map[i] = i;
+    ref[i] = i;
+    in_progress = map.rehash_in_progress() ? in_progress + 1 : 0;
+  }
+  return ref;
+}
+
+TEST(IncrementalRehashTest, LookupsFinishMigration) {
+  mystl::unordered_map<int, int> map;
+  std::unordered_map<int, int> ref = FillUntilMigrating(map);
+  ASSERT_TRUE(map.rehash_in_progress());
+  // 不再插入：只靠查找推进，迁移也会结束
+  for (int i = 0; map.rehash_in_progress(); ++i) {
+    ASSERT_LT(i, 1000000);
+    EXPECT_NE(map.find(i % 20000), map.end());
+  }
+  ExpectSameContents(map, ref);
+  ExpectBucketsConsistent(map);
+}
+
+TEST(IncrementalRehashTest, SmallMaxLoadFactorStaysBounded) {
+  mystl::unordered_map<int, int> map;
+  map.max_load_factor(0.05f);
+  map.set_incremental_rehash(true);
+  for (int i = 0; i < 20000; ++i) {
+    map[i] = i;
+    ASSERT_LE(map.load_factor(), map.max_load_factor() * 2.0f + 1e-6f);
+  }
+  map.finish_rehash();
+  EXPECT_LE(map.load_factor(), map.max_load_factor());
+  ExpectBucketsConsistent(map);
+}
+
+TEST(IncrementalRehashTest, CopyMoveSwapDuringMigration) {
+  mystl::unordered_map<int, int> map;
+  auto ref = FillUntilMigrating(map);
+  ASSERT_TRUE(map.rehash_in_progress());
+
+  mystl::unordered_map<int, int> copy(map);
+  ExpectSameContents(copy, ref);
+  EXPECT_TRUE(copy == map);
+
+  mystl::unordered_map<int, int> moved(std::move(map));
+  EXPECT_TRUE(moved.rehash_in_progress());
+  ExpectSameContents(moved, ref);
+  EXPECT_EQ(map.find(1), map.end());
+
+  mystl::unordered_map<int, int> other{{-1, -1}};
+  other.swap(moved);
+  ExpectSameContents(other, ref);
+  EXPECT_EQ(moved.size(), 1u);
+
+  moved = std::move(other);
+  ExpectSameContents(moved, ref);
+  for (int i = 0; i < 1000; ++i) {
+    moved[-i - 2] = i;
+    ref[-i - 2] = i;
+  }
+  ExpectSameContents(moved, ref);
+  moved.finish_rehash();
+  ExpectBucketsConsistent(moved);
+}
+
+TEST(IncrementalRehashTest, EraseWhileIteratingDuringMigration) {
+  mystl::unordered_map<int, int> map;
+  auto ref = FillUntilMigrating(map);
+  ASSERT_TRUE(map.rehash_in_progress());
+
+  // 删除不推进迁移，遍历顺序保持稳定，每个元素恰好访问一次
+  size_t original_size = map.size();
+  size_t visited = 0;
+  for (auto it = map.begin(); it != map.end();) {
+    ++visited;
+    if (it->first % 3 == 0) {
+      ref.erase(it->first);
+      it = map.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  EXPECT_EQ(visited, original_size);
+  ExpectSameContents(map, ref);
+
+  std::vector<int> keys{0, 1, 2, 3, 4, 5, -5};
+  std::vector<mystl::unordered_map<int, int>::iterator> out(keys.size());
+  map.find_batch(keys.data(), keys.size(), out.data());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    EXPECT_EQ(out[i], map.find(keys[i]));
+  }
+
+  map.clear();
+  EXPECT_FALSE(map.rehash_in_progress());
+  EXPECT_TRUE(map.empty());
+  map[1] = 1;
+  EXPECT_EQ(map.at(1), 1);
+}
+
+// 显式 rehash/reserve 与关闭开关都会先完成迁移
+TEST(IncrementalRehashTest, ExplicitRehashFinishesMigration) {
+  mystl::unordered_map<int, int> map;
+  auto ref = FillUntilMigrating(map);
+  map.reserve(map.size() * 4);
+  EXPECT_FALSE(map.rehash_in_progress());
+  ExpectSameContents(map, ref);
+  ExpectBucketsConsistent(map);
+
+  mystl::unordered_map<int, int> map2;
+  ref = FillUntilMigrating(map2);
+  map2.set_incremental_rehash(false);
+  EXPECT_FALSE(map2.rehash_in_progress());
+  ExpectSameContents(map2, ref);
+  ExpectBucketsConsistent(map2);
+}
+
+// ==================== 统计信息 ====================
+TEST(UnorderedMapTest, StatsEmpty) {
+  mystl::unordered_map<int, int> map;
+  mystl::hash_table_stats s = map.stats();
+  EXPECT_EQ(s.size, 0u);
+  EXPECT_EQ(s.bucket_count, 0u);
+  EXPECT_TRUE(s.chain_length_histogram.empty());
+  EXPECT_EQ(s.avg_probes_successful, 0.0);
+  EXPECT_EQ(s.node_bytes, 0u);
+  EXPECT_EQ(s.bucket_bytes, 0u);
+}
+
+// 统计值与用 bucket_size() 手工计算的结果一致
+TEST(UnorderedMapTest, StatsMatchBucketSizes) {
+  mystl::unordered_map<int, int> map;
+  for (int i = 0; i < 5000; ++i) {
+    map[i * 7] = i;
+  }
+  mystl::hash_table_stats s = map.stats();
+  EXPECT_EQ(s.size, map.size());
+  EXPECT_EQ(s.bucket_count, map.bucket_count());
+  EXPECT_FLOAT_EQ(s.load_factor, map.load_factor());
+
+  size_t buckets = 0;
+  size_t nodes = 0;
+  for (size_t len = 0; len < s.chain_length_histogram.size(); ++len) {
+    buckets += s.chain_length_histogram[len];
+    nodes += len * s.chain_length_histogram[len];
+  }
+  EXPECT_EQ(buckets, map.bucket_count());
+  EXPECT_EQ(nodes, map.size());
+  EXPECT_GT(s.chain_length_histogram.back(), 0u);
+
+  size_t max_len = 0;
+  size_t empty = 0;
+  for (size_t b = 0; b < map.bucket_count(); ++b) {
+    max_len = std::max(max_len, map.bucket_size(b));
+    empty += map.bucket_size(b) == 0;
+  }
+  EXPECT_EQ(s.max_chain_length, max_len);
+  EXPECT_EQ(s.empty_buckets, empty);
+  EXPECT_DOUBLE_EQ(s.empty_bucket_ratio,
+                   static_cast<double>(empty) / map.bucket_count());
+  EXPECT_GE(s.avg_probes_successful, 1.0);
+  EXPECT_LE(s.avg_probes_successful, static_cast<double>(max_len));
+  EXPECT_DOUBLE_EQ(s.avg_probes_unsuccessful,
+                   static_cast<double>(map.size()) / map.bucket_count());
+  EXPECT_GT(s.node_bytes, map.size() * sizeof(std::pair<const int, int>));
+  EXPECT_EQ(s.bucket_bytes, map.bucket_count() * sizeof(void*));
+}
+
+// 所有键落入同一个桶时，统计信息应当暴露出退化的链
+struct ConstantHash {
+  size_t operator()(int) const { return 42; }
+};
+
+TEST(UnorderedMapTest, StatsDetectsBadHash) {
+  mystl::unordered_map<int, int, ConstantHash> map;
+  for (int i = 0; i < 100; ++i) {
+    map[i] = i;
+  }
+  mystl::hash_table_stats s = map.stats();
+  EXPECT_EQ(s.max_chain_length, 100u);
+  EXPECT_EQ(s.empty_buckets, map.bucket_count() - 1);
+  EXPECT_DOUBLE_EQ(s.avg_probes_successful, 50.5);
+}
+
+// ==================== 节点句柄（extract / insert / merge） ====================
+// 只统计节点分配（桶数组是指针数组，不计入）
+static int g_node_allocations = 0;
+
+template <class T>
+struct NodeCountingAllocator {
+  using value_type = T;
+
+  NodeCountingAllocator() = default;
+  template <class U>
+  NodeCountingAllocator(const NodeCountingAllocator<U>&) {}
+
+  T* allocate(size_t n) {
+    if (!std::is_pointer_v<T>) {
+      ++g_node_allocations;
+    }
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T* p, size_t n) { std::allocator<T>().deallocate(p, n); }
+
+  template <class U>
+  bool operator==(const NodeCountingAllocator<U>&) const { return true; }
+  template <class U>
+  bool operator!=(const NodeCountingAllocator<U>&) const { return false; }
+};
+
+template <class Policy = mystl::hash_default_bucket_policy>
+using counting_map =
+    mystl::unordered_map<int, std::string, std::hash<int>, std::equal_to<int>,
+                         NodeCountingAllocator<std::pair<const int, std::string>>,
+                         Policy>;
+
+TEST(UnorderedMapTest, ExtractAndInsertNode) {
+  mystl::unordered_map<int, std::string> a{{1, "one"}, {2, "two"}, {3, "three"}};
+  const std::string* addr = &a.at(2);
+
+  auto nh = a.extract(2);
+  ASSERT_FALSE(nh.empty());
+  EXPECT_TRUE(static_cast<bool>(nh));
+  EXPECT_EQ(nh.key(), 2);
+  EXPECT_EQ(nh.mapped(), "two");
+  EXPECT_EQ(a.size(), 2u);
+  EXPECT_FALSE(a.contains(2));
+  EXPECT_TRUE(a.extract(42).empty());
+
+  // 修改键后插入另一张表，元素地址不变
+  nh.key() = 20;
+  mystl::unordered_map<int, std::string> b;
+  auto r = b.insert(std::move(nh));
+  EXPECT_TRUE(r.inserted);
+  EXPECT_TRUE(r.node.empty());
+  EXPECT_TRUE(nh.empty());
+  EXPECT_EQ(r.position->first, 20);
+  EXPECT_EQ(&r.position->second, addr);
+  EXPECT_EQ(b.find(20), r.position);
+
+  // 键已存在：节点原样退回
+  auto dup = a.extract(a.find(1));
+  dup.key() = 20;
+  r = b.insert(std::move(dup));
+  EXPECT_FALSE(r.inserted);
+  ASSERT_FALSE(r.node.empty());
+  EXPECT_EQ(r.node.mapped(), "one");
+  EXPECT_EQ(r.position, b.find(20));
+  EXPECT_EQ(b.size(), 1u);
+  auto back = std::move(r.node);
+
+  // 空句柄插入什么也不做；带 hint 的版本返回插入位置
+  r = b.insert(decltype(a)::node_type());
+  EXPECT_FALSE(r.inserted);
+  EXPECT_TRUE(r.node.empty());
+  EXPECT_EQ(r.position, b.end());
+  back.key() = 1;
+  auto it = b.insert(b.begin(), std::move(back));
+  EXPECT_TRUE(back.empty());
+  EXPECT_EQ(it->second, "one");
+  EXPECT_EQ(b.size(), 2u);
+  EXPECT_EQ(a.size(), 1u);
+}
+
+TEST(UnorderedMapTest, MergeWithoutAllocation) {
+  counting_map<> a;
+  counting_map<> b;
+  for (int i = 0; i < 1000; ++i) {
+    a.emplace(i, std::to_string(i));
+  }
+  for (int i = 500; i < 1500; ++i) {
+    b.emplace(i, "b");
+  }
+  b.reserve(2000);
+  a.reserve(2000);
+  const std::string* addr = &b.at(1200);
+
+  int before = g_node_allocations;
+  a.merge(b);
+  EXPECT_EQ(g_node_allocations, before);
+
+  EXPECT_EQ(a.size(), 1500u);
+  EXPECT_EQ(b.size(), 500u);
+  EXPECT_EQ(&a.at(1200), addr);
+  for (int i = 0; i < 1500; ++i) {
+    EXPECT_EQ(a.at(i), i < 1000 ? std::to_string(i) : "b");
+  }
+  // 冲突的键留在 source 中
+  for (int i = 500; i < 1000; ++i) {
+    EXPECT_EQ(b.at(i), "b");
+  }
+
+  // extract + insert 同样不分配
+  auto nh = b.extract(b.begin());
+  nh.key() = -1;
+  a.insert(std::move(nh));
+  EXPECT_EQ(g_node_allocations, before);
+  EXPECT_EQ(a.at(-1), "b");
+  ExpectBucketsConsistent(a);
+}
+
+// 哈希函数与桶策略不同的表之间合并：哈希值重新计算
+struct SeededHash {
+  size_t seed = 0;
+  size_t operator()(int k) const { return std::hash<int>()(k) ^ seed; }
+};
+
+TEST(UnorderedMapTest, MergeAcrossHashAndPolicy) {
+  using source_type =
+      mystl::unordered_map<int, int, SeededHash, std::equal_to<int>,
+                           std::allocator<std::pair<const int, int>>,
+                           mystl::hash_power2_bucket_policy>;
+  using target_type =
+      mystl::unordered_map<int, int, SeededHash, std::equal_to<int>,
+                           std::allocator<std::pair<const int, int>>,
+                           mystl::hash_prime_bucket_policy>;
+  source_type source(0, SeededHash{0x9e3779b9u});
+  target_type target(0, SeededHash{12345});
+  std::unordered_map<int, int> ref;
+  for (int i = 0; i < 3000; ++i) {
+    source.emplace(i, i);
+    ref.emplace(i, i);
+  }
+  for (int i = 2000; i < 4000; ++i) {
+    target.emplace(i, -i);
+    ref[i] = -i;
+  }
+  target.merge(std::move(source));
+  EXPECT_EQ(source.size(), 1000u);
+  ExpectSameContents(target, ref);
+  ExpectBucketsConsistent(target);
+  for (int i = 2000; i < 3000; ++i) {
+    EXPECT_EQ(source.at(i), i);
+  }
+}
+
+// 目标表与来源表都处于渐进式 rehash 迁移阶段
+TEST(IncrementalRehashTest, MergeDuringMigration) {
+  mystl::unordered_map<int, int> a;
+  std::unordered_map<int, int> ref = FillUntilMigrating(a);
+  mystl::unordered_map<int, int> b;
+  b.set_incremental_rehash(true);
+  for (int i = -30000; i < 100; ++i) {
+    b.emplace(i, i);
+    if (i >= 0) {
+      continue;
+    }
+    ref.emplace(i, i);
+  }
+  ASSERT_TRUE(a.rehash_in_progress());
+  a.merge(b);
+  EXPECT_EQ(b.size(), 100u);
+  ExpectSameContents(a, ref);
+
+  auto nh = a.extract(-1);
+  EXPECT_EQ(nh.mapped(), -1);
+  ref.erase(-1);
+  ExpectSameContents(a, ref);
+  a.finish_rehash();
+  ExpectBucketsConsistent(a);
+}
+
+// ==================== 批量插入 ====================
+// 前向范围：只扩容一次，重复键保留先出现的值，已有的键不被覆盖
+TEST(UnorderedMapTest, BulkInsertForwardRange) {
+  std::list<std::pair<int, std::string>> src;
+  for (int i = 0; i < 5000; ++i) {
+    src.emplace_back(i % 4000, std::to_string(i));
+  }
+  mystl::unordered_map<int, std::string> map(src.begin(), src.end());
+  mystl::unordered_map<int, std::string> reserved;
+  reserved.reserve(src.size());
+  EXPECT_EQ(map.bucket_count(), reserved.bucket_count());
+  EXPECT_EQ(map.size(), 4000u);
+  for (int i = 0; i < 4000; ++i) {
+    EXPECT_EQ(map.at(i), std::to_string(i));
+  }
+
+  std::vector<std::pair<int, std::string>> more = {{1, "x"}, {-1, "y"}};
+  map.insert(more.begin(), more.end());
+  EXPECT_EQ(map.at(1), "1");
+  EXPECT_EQ(map.at(-1), "y");
+  ExpectBucketsConsistent(map);
+
+  // 拷贝构造同样走批量路径
+  mystl::unordered_map<int, std::string> copy(map);
+  EXPECT_EQ(copy, map);
+}
+
+// 元素的 first 不是 key_type 时先转换再插入
+TEST(UnorderedMapTest, BulkInsertConvertibleRange) {
+  std::vector<std::pair<const char*, int>> src = {{"a", 1}, {"b", 2}, {"a", 3}};
+  mystl::unordered_map<std::string, int> map;
+  map.insert_bulk(src.begin(), src.end());
+  EXPECT_EQ(map.size(), 2u);
+  EXPECT_EQ(map.at("a"), 1);
+  EXPECT_EQ(map.at("b"), 2);
+}
+
+// 多线程计算哈希值，结果与逐个插入一致；跨越多个块
+TEST(UnorderedMapTest, BulkInsertParallelHash) {
+  std::vector<std::pair<std::string, int>> src;
+  std::unordered_map<std::string, int> ref;
+  std::mt19937 rng(99);
+  for (int i = 0; i < 300000; ++i) {
+    std::string key = "key" + std::to_string(rng() % 250000);
+    src.emplace_back(key, i);
+    ref.emplace(key, i);
+  }
+  mystl::unordered_map<std::string, int> map;
+  map[src[0].first] = -1;
+  ref[src[0].first] = -1;
+  map.insert_bulk(src.begin(), src.end(), 4);
+  ExpectSameContents(map, ref);
+  ExpectBucketsConsistent(map);
+}
+
+// 哈希函数在工作线程中抛出的异常传回调用方，表保持可用
+struct ThrowingHash {
+  size_t operator()(int k) const {
+    if (k == 123456) {
+      throw std::runtime_error("bad key");
+    }
+    return std::hash<int>()(k);
+  }
+};
+
+TEST(UnorderedMapTest, BulkInsertParallelHashThrows) {
+  std::vector<std::pair<int, int>> src;
+  for (int i = 0; i < 200000; ++i) {
+    src.emplace_back(i, i);
+  }
+  mystl::unordered_map<int, int, ThrowingHash> map;
+  EXPECT_THROW(map.insert_bulk(src.begin(), src.end(), 4), std::runtime_error);
+  for (auto it = map.begin(); it != map.end(); ++it) {
+    EXPECT_EQ(it->first, it->second);
+  }
+  map.clear();
+  map.insert_bulk(src.begin(), src.begin() + 1000, 4);
+  EXPECT_EQ(map.size(), 1000u);
+}
+
+// 渐进式 rehash 迁移途中批量插入：先完成迁移再一次扩容
+TEST(IncrementalRehashTest, BulkInsertDuringMigration) {
+  mystl::unordered_map<int, int> map;
+  std::unordered_map<int, int> ref = FillUntilMigrating(map);
+  ASSERT_TRUE(map.rehash_in_progress());
+  std::vector<std::pair<int, int>> src;
+  for (int i = -50000; i < 10; ++i) {
+    src.emplace_back(i, -i);
+    ref.emplace(i, -i);
+  }
+  map.insert(src.begin(), src.end());
+  ExpectSameContents(map, ref);
+  ExpectBucketsConsistent(map);
+}
+
+// ==================== 并行 rehash / clear ====================
+template <class Policy, class Cache = mystl::hash_cache_full>
+void CheckParallelRehash() {
+  using map_type =
+      mystl::unordered_map<int, int, std::hash<int>, std::equal_to<int>,
+                           std::allocator<std::pair<const int, int>>, Policy,
+                           Cache>;
+  map_type map;
+  std::unordered_map<int, int> ref;
+  std::mt19937 rng(19);
+  while (ref.size() < 150000) {
+    int k = static_cast<int>(rng());
+    map[k] = k / 3;
+    ref[k] = k / 3;
+  }
+  // 扩容、缩容、reserve 各一次，线程数不整除桶数
+  for (size_t n : {map.bucket_count() * 5, ref.size(), ref.size() * 3}) {
+    map.rehash(n, mystl::parallel_policy(3));
+    EXPECT_GE(map.bucket_count(), n);
+    ExpectSameContents(map, ref);
+    ExpectBucketsConsistent(map);
+  }
+  map.reserve(ref.size() * 8, mystl::par);
+  EXPECT_GE(map.bucket_count(), ref.size() * 8);
+  ExpectBucketsConsistent(map);
+
+  // 重新链接后桶里保存的前驱仍然正确：继续增删
+  for (int step = 0; step < 50000; ++step) {
+    int k = static_cast<int>(rng() % 100000);
+    if (step % 2 == 0) {
+      EXPECT_EQ(map.erase(k), ref.erase(k));
+    } else {
+      map[k] = step;
+      ref[k] = step;
+    }
+  }
+  ExpectSameContents(map, ref);
+  ExpectBucketsConsistent(map);
+
+  map.clear(mystl::parallel_policy(4));
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+  for (size_t b = 0; b < map.bucket_count(); ++b) {
+    EXPECT_EQ(map.bucket_size(b), 0u);
+  }
+  map[7] = 7;
+  EXPECT_EQ(map.at(7), 7);
+  EXPECT_EQ(map.size(), 1u);
+}
+
+TEST(ParallelRehashTest, DefaultPolicy) {
+  CheckParallelRehash<mystl::hash_default_bucket_policy>();
+}
+
+TEST(ParallelRehashTest, PrimePolicy) {
+  CheckParallelRehash<mystl::hash_prime_bucket_policy>();
+}
+
+TEST(ParallelRehashTest, Power2PolicyFingerprint) {
+  CheckParallelRehash<mystl::hash_power2_bucket_policy,
+                      mystl::hash_cache_fingerprint>();
+}
+
+TEST(ParallelRehashTest, MaskPolicyNoCachedHash) {
+  CheckParallelRehash<mystl::hash_mask_bucket_policy,
+                      mystl::hash_cache_none>();
+}
+
+// 并行 clear 析构所有元素；小表和渐进式 rehash 途中退回串行实现
+TEST(ParallelRehashTest, ClearDestroysElements) {
+  auto counter = std::make_shared<int>(0);
+  mystl::unordered_map<int, std::shared_ptr<int>> map;
+  for (int i = 0; i < 100000; ++i) {
+    map.emplace(i, counter);
+  }
+  EXPECT_EQ(counter.use_count(), 100001);
+  map.clear(mystl::parallel_policy(4));
+  EXPECT_EQ(counter.use_count(), 1);
+
+  map.emplace(1, counter);
+  map.clear(mystl::parallel_policy(8));
+  EXPECT_EQ(counter.use_count(), 1);
+
+  mystl::unordered_map<int, int> migrating;
+  FillUntilMigrating(migrating);
+  ASSERT_TRUE(migrating.rehash_in_progress());
+  migrating.clear(mystl::par);
+  EXPECT_TRUE(migrating.empty());
+  EXPECT_FALSE(migrating.rehash_in_progress());
+}
+
+// 内存占用：节点的 next_/hash_ 与桶数组计入 overhead
+TEST(UnorderedMapTest, MemoryUsage) {
+  mystl::unordered_map<int, int> map;
+  mystl::memory_footprint empty = mystl::footprint(map);
+  EXPECT_EQ(empty.payload_bytes, 0);
+  EXPECT_EQ(empty.overhead_bytes, map.bucket_count() * sizeof(void*));
+
+  for (int i = 0; i < 1000; ++i) {
+    map.emplace(i, i);
+  }
+  map.finish_rehash();
+  mystl::memory_footprint f = map.memory_usage();
+  mystl::hash_table_stats s = map.stats();
+  EXPECT_EQ(f.payload_bytes, 1000 * sizeof(std::pair<const int, int>));
+  EXPECT_EQ(f.slack_bytes, 0);
+  EXPECT_EQ(f.payload_bytes + f.overhead_bytes, s.node_bytes + s.bucket_bytes);
+  EXPECT_EQ(f.allocations, 1000 + 1);
+  EXPECT_GT(f.rounding_bytes, 0);
+
+  // 不缓存哈希值时每个节点少一个 hash_
+  mystl::unordered_map<int, int, std::hash<int>, std::equal_to<int>,
+                       std::allocator<std::pair<const int, int>>,
+                       mystl::hash_prime_bucket_policy, mystl::hash_cache_none>
+      lean;
+  for (int i = 0; i < 1000; ++i) {
+    lean.emplace(i, i);
+  }
+  lean.finish_rehash();
+  EXPECT_LT(lean.memory_usage().overhead_bytes - lean.stats().bucket_bytes,
+            f.overhead_bytes - s.bucket_bytes);
+}
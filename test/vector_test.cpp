@@ -1,5 +1,9 @@
 #include "gtest/gtest.h"
 #include <mystl/vector.h>
+#include <mystl/string.h>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
 
 // 测试默认构造函数和基本功能
 TEST(VectorTest, DefaultConstructor) {
@@ -126,4 +130,233 @@ TEST(VectorTest, Swap) {
   EXPECT_EQ(v1[0], 3);
   EXPECT_EQ(v2.size(), 2);
   EXPECT_EQ(v2[0], 1);
-}
\ No newline at end of file
+}
+// 测试内存占用统计
+TEST(VectorTest, MemoryUsage) {
+  mystl::vector<int> v;
+  mystl::memory_footprint empty = mystl::footprint(v);
+  EXPECT_EQ(empty.total_bytes(), 0);
+  EXPECT_EQ(empty.allocations, 0);
+
+  for (int i = 0; i < 5; ++i) {
+    v.push_back(i);
+  }
+  mystl::memory_footprint f = v.memory_usage();
+  EXPECT_EQ(f.payload_bytes, 5 * sizeof(int));
+  EXPECT_EQ(f.slack_bytes, (v.capacity() - 5) * sizeof(int));
+  EXPECT_EQ(f.overhead_bytes, 0);
+  EXPECT_EQ(f.allocations, 1);
+  EXPECT_EQ(f.rounding_bytes,
+            mystl::malloc_rounding(v.capacity() * sizeof(int)));
+}
+
+// 测试可平凡重定位元素的扩容：memcpy 搬迁后不应重复析构
+TEST(VectorTest, RelocatingGrowth) {
+  static_assert(mystl::is_trivially_relocatable_v<mystl::shared_ptr<int>>);
+  mystl::shared_ptr<int> owner(new int(7));
+  {
+    mystl::vector<mystl::shared_ptr<int>> v;
+    for (int i = 0; i < 100; ++i) {
+      v.push_back(owner);
+    }
+    EXPECT_EQ(owner.use_count(), 101);
+    v.shrink_to_fit();
+    EXPECT_EQ(owner.use_count(), 101);
+    EXPECT_EQ(*v[99], 7);
+  }
+  EXPECT_EQ(owner.use_count(), 1);
+
+  mystl::vector<mystl::string> words;
+  for (int i = 0; i < 50; ++i) {
+    words.push_back(mystl::string(40, static_cast<char>('a' + i % 26)));
+  }
+  for (int i = 0; i < 50; ++i) {
+    EXPECT_EQ(words[i].size(), 40);
+    EXPECT_EQ(words[i][0], static_cast<char>('a' + i % 26));
+  }
+}
+
+// 测试 reserve / resize / clear
+TEST(VectorTest, ReserveResizeClear) {
+  mystl::vector<int> v;
+  v.reserve(100);
+  EXPECT_EQ(v.capacity(), 100);
+  EXPECT_TRUE(v.empty());
+  int* data = v.data();
+  for (int i = 0; i < 100; ++i) {
+    v.push_back(i);
+  }
+  EXPECT_EQ(v.data(), data);  // 预留足够时不重新分配
+
+  v.resize(10);
+  EXPECT_EQ(v.size(), 10);
+  EXPECT_EQ(v.back(), 9);
+  v.resize(15, 7);
+  EXPECT_EQ(v.size(), 15);
+  EXPECT_EQ(v[14], 7);
+  v.resize(20);
+  EXPECT_EQ(v[19], 0);
+  EXPECT_EQ(v.capacity(), 100);
+
+  v.clear();
+  EXPECT_TRUE(v.empty());
+  EXPECT_EQ(v.capacity(), 100);
+  EXPECT_THROW(v.reserve(v.max_size() + 1), std::length_error);
+  EXPECT_THROW(v.at(0), std::out_of_range);
+}
+
+// 测试右值 push_back 与 emplace_back：不拷贝
+TEST(VectorTest, EmplaceBackMoves) {
+  struct Tracked {
+    int value;
+    int copies = 0;
+    explicit Tracked(int v) : value(v) {}
+    Tracked(const Tracked& o) : value(o.value), copies(o.copies + 1) {}
+    Tracked(Tracked&& o) noexcept : value(o.value), copies(o.copies) {}
+    Tracked& operator=(Tracked&& o) noexcept {
+      value = o.value;
+      copies = o.copies;
+      return *this;
+    }
+  };
+  mystl::vector<Tracked> v;
+  for (int i = 0; i < 20; ++i) {
+    Tracked& t = v.emplace_back(i);
+    EXPECT_EQ(t.value, i);
+  }
+  v.push_back(Tracked(20));
+  for (const Tracked& t : v) {
+    EXPECT_EQ(t.copies, 0);
+  }
+
+  mystl::vector<mystl::string> words;
+  mystl::string long_word(64, 'w');
+  words.push_back(mystl::move(long_word));
+  EXPECT_TRUE(long_word.empty());
+  EXPECT_EQ(words[0].size(), 64);
+
+  // 参数引用自身元素时，扩容后仍然正确
+  mystl::vector<mystl::string> self;
+  self.push_back(mystl::string(30, 'a'));
+  for (int i = 0; i < 10; ++i) {
+    self.push_back(self[0]);
+  }
+  EXPECT_EQ(self.back(), mystl::string(30, 'a'));
+}
+
+// 测试 insert 各重载
+TEST(VectorTest, Insert) {
+  mystl::vector<int> v = {1, 2, 3};
+  auto it = v.insert(v.begin() + 1, 10);
+  EXPECT_EQ(*it, 10);
+  EXPECT_EQ(v.size(), 4);
+
+  v.insert(v.end(), 2, 20);
+  v.insert(v.begin(), {-2, -1});
+  int expected[] = {-2, -1, 1, 10, 2, 3, 20, 20};
+  ASSERT_EQ(v.size(), 8);
+  for (size_t i = 0; i < 8; ++i) {
+    EXPECT_EQ(v[i], expected[i]);
+  }
+
+  // 范围插入只重新分配一次
+  mystl::vector<int> src(100, 5);
+  mystl::vector<int> dst = {0, 0};
+  dst.insert(dst.begin() + 1, src.begin(), src.end());
+  EXPECT_EQ(dst.size(), 102);
+  EXPECT_EQ(dst.capacity(), 102);
+  EXPECT_EQ(dst[0], 0);
+  EXPECT_EQ(dst[50], 5);
+  EXPECT_EQ(dst[101], 0);
+
+  // 容量足够时在中间插入，覆盖 elems_after 大于和不大于 n 两种情况
+  mystl::vector<mystl::string> s;
+  s.reserve(16);
+  for (char c : {'a', 'b', 'c', 'd'}) {
+    s.push_back(mystl::string(20, c));
+  }
+  s.insert(s.begin() + 1, 2, mystl::string(20, 'x'));  // elems_after = 3
+  s.insert(s.end() - 1, 3, mystl::string(20, 'y'));    // elems_after = 1
+  const char order[] = {'a', 'x', 'x', 'b', 'c', 'y', 'y', 'y', 'd'};
+  ASSERT_EQ(s.size(), 9);
+  for (size_t i = 0; i < 9; ++i) {
+    EXPECT_EQ(s[i], mystl::string(20, order[i]));
+  }
+  s.insert(s.begin(), s[8]);  // 引用自身元素
+  EXPECT_EQ(s[0], mystl::string(20, 'd'));
+}
+
+// 测试 erase
+TEST(VectorTest, Erase) {
+  mystl::vector<int> v = {0, 1, 2, 3, 4, 5, 6, 7};
+  auto it = v.erase(v.begin() + 2);
+  EXPECT_EQ(*it, 3);
+  it = v.erase(v.begin() + 1, v.begin() + 4);
+  EXPECT_EQ(*it, 5);
+  int expected[] = {0, 5, 6, 7};
+  ASSERT_EQ(v.size(), 4);
+  for (size_t i = 0; i < 4; ++i) {
+    EXPECT_EQ(v[i], expected[i]);
+  }
+  EXPECT_EQ(v.erase(v.begin(), v.begin()), v.begin());
+  v.erase(v.begin(), v.end());
+  EXPECT_TRUE(v.empty());
+
+  mystl::shared_ptr<int> owner(new int(1));
+  mystl::vector<mystl::shared_ptr<int>> ptrs;
+  for (int i = 0; i < 10; ++i) {
+    ptrs.push_back(owner);
+  }
+  ptrs.erase(ptrs.begin() + 3, ptrs.begin() + 7);
+  EXPECT_EQ(owner.use_count(), 7);
+  ptrs.erase(ptrs.begin());
+  EXPECT_EQ(owner.use_count(), 6);
+  ptrs.clear();
+  EXPECT_EQ(owner.use_count(), 1);
+}
+
+// 测试平凡拷贝元素通过 allocator::reallocate 原地扩容
+TEST(VectorTest, ReallocateGrowth) {
+  static_assert(mystl::allocator<uint64_t>::can_reallocate());
+  static_assert(!mystl::allocator<mystl::string>::can_reallocate());
+  static_assert(!mystl::allocator<std::string>::can_reallocate());
+
+  mystl::vector<uint64_t> v;
+  for (uint64_t i = 0; i < 100000; ++i) {
+    v.push_back(i * 3);
+  }
+  for (uint64_t i = 0; i < 100000; ++i) {
+    ASSERT_EQ(v[i], i * 3);
+  }
+
+  // 扩容时参数引用自身元素
+  mystl::vector<uint64_t> self = {42};
+  for (int i = 0; i < 20; ++i) {
+    self.push_back(self[0]);
+  }
+  self.resize(self.capacity() + 1, self[0]);
+  for (uint64_t x : self) {
+    EXPECT_EQ(x, 42u);
+  }
+  self.insert(self.begin() + 1, self.capacity(), self.back());
+  EXPECT_EQ(self[1], 42u);
+  EXPECT_EQ(self.back(), 42u);
+
+  v.resize(10);
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), 10);
+  EXPECT_EQ(v[9], 27u);
+  v.clear();
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), 0);
+  v.push_back(1);
+  EXPECT_EQ(v[0], 1u);
+
+  mystl::vector<mystl::string> words;
+  for (int i = 0; i < 100; ++i) {
+    words.emplace_back(30, static_cast<char>('a' + i % 26));
+  }
+  words.push_back(words[0]);
+  EXPECT_EQ(words.back(), mystl::string(30, 'a'));
+  EXPECT_EQ(words[99], mystl::string(30, static_cast<char>('a' + 99 % 26)));
+}